@@ -0,0 +1,252 @@
+//
+//
+//
+
+#include "DCCbus.h"
+#include "DCCcore.h"
+
+/*
+Command bus.  Before this module the keypad, jogwheel, WiThrottle and DCCweb each wrote to loco[], turnout[],
+power and dccSE directly, each with its own copy of the speed/power logic.  Now they post a BUSCOMMAND and
+DCCcore applies it on the next 10mS tick, giving one place for ordering, rate limiting and latency measurement.
+
+The ring is single producer/single consumer in practice.  On the ESP8266 the AsyncTCP and websocket callbacks
+run in the same cooperative context as loop(), never from an interrupt, so no locking is required.
+
+When the ring is nearly full, only eStop, stop-all and power-off commands are accepted.  Anything else is
+dropped and counted.
+
+2026-10-19 absolute speed commands are latest-wins.  A throttle slider posts a speed for nearly every pixel
+it moves, so if a speed command for the same loco is still waiting in the ring, its value is overwritten
+rather than a second command being queued.  Any step, direction or eStop for that loco, or a stop-all or
+power change, closes the latch so that commands are never reordered.
+*/
+
+using namespace nsDCCbus;
+
+static BUSCOMMAND m_queue[BUS_QUEUE_SIZE];
+static uint8_t m_head = 0;  //next write position
+static uint8_t m_tail = 0;  //next read position
+static uint8_t m_count = 0;
+static BUSSTATS m_stats;
+static uint8_t m_speedAt[MAX_LOCO];  //ring index+1 of the speed command pending per loco slot, 0 if none
+
+
+/*safety related commands may use the reserved slots*/
+bool nsDCCbus::isCritical(const BUSCOMMAND &c) {
+	switch (c.type) {
+	case BUS_LOCO_ESTOP:
+	case BUS_ESTOP_ALL:
+	case BUS_STOP_ALL:
+		return true;
+	case BUS_POWER:
+		return c.value == 0;
+	}
+	return false;
+}
+
+/*queue a command, returns false if it was dropped*/
+bool nsDCCbus::post(BUSCOMMAND &c) {
+	if (coalesce(c)) return true;
+	uint8_t limit = isCritical(c) ? BUS_QUEUE_SIZE : BUS_QUEUE_SIZE - BUS_RESERVED;
+	if (m_count >= limit) {
+		m_stats.dropped++;
+		trace(Serial.printf("bus drop type %d\r\n", c.type);)
+		return false;
+	}
+	c.stamp = micros();
+	m_queue[m_head] = c;
+	if (c.type == BUS_LOCO_SPEED && c.slot >= 0 && c.slot < MAX_LOCO) m_speedAt[c.slot] = m_head + 1;
+	m_head = (m_head + 1) % BUS_QUEUE_SIZE;
+	m_count++;
+	m_stats.posted++;
+	m_stats.depth = m_count;
+	if (m_count > m_stats.highWater) m_stats.highWater = m_count;
+	return true;
+}
+
+/*merge an absolute speed into one already queued for the same loco. The queued command keeps its
+position and stamp, so latency is measured from the first of the merged commands.
+Other commands which affect speed close the latch. returns true if c was merged*/
+bool nsDCCbus::coalesce(const BUSCOMMAND &c) {
+	switch (c.type) {
+	case BUS_LOCO_SPEED:
+		break;
+	case BUS_LOCO_STEP:
+	case BUS_LOCO_DIR:
+	case BUS_LOCO_ESTOP:
+		if (c.slot >= 0 && c.slot < MAX_LOCO) m_speedAt[c.slot] = 0;
+		return false;
+	case BUS_STOP_ALL:
+	case BUS_ESTOP_ALL:
+	case BUS_POWER:
+		memset(m_speedAt, 0, sizeof(m_speedAt));
+		return false;
+	default:
+		return false;
+	}
+
+	if (c.slot < 0 || c.slot >= MAX_LOCO || m_speedAt[c.slot] == 0) return false;
+	BUSCOMMAND &q = m_queue[m_speedAt[c.slot] - 1];
+	if (q.type != BUS_LOCO_SPEED || q.slot != c.slot || q.address != c.address || q.flags != c.flags) {
+		m_speedAt[c.slot] = 0;
+		return false;
+	}
+	q.value = c.value;
+	q.source = c.source;
+	m_stats.coalesced++;
+	return true;
+}
+
+/*take the oldest command, returns false if the queue is empty*/
+bool nsDCCbus::pop(BUSCOMMAND &c) {
+	if (m_count == 0) return false;
+	c = m_queue[m_tail];
+	if (c.type == BUS_LOCO_SPEED && c.slot >= 0 && c.slot < MAX_LOCO && m_speedAt[c.slot] == m_tail + 1) m_speedAt[c.slot] = 0;
+	m_tail = (m_tail + 1) % BUS_QUEUE_SIZE;
+	m_count--;
+	m_stats.depth = m_count;
+	m_stats.applied++;
+	//caller applies the command immediately, so this is the post-to-apply latency
+	m_stats.lastLatency_us = micros() - c.stamp;
+	if (m_stats.lastLatency_us > m_stats.maxLatency_us) m_stats.maxLatency_us = m_stats.lastLatency_us;
+	return true;
+}
+
+const BUSSTATS &nsDCCbus::getStats(void) {
+	return m_stats;
+}
+
+void nsDCCbus::clearStats(void) {
+	memset(&m_stats, 0, sizeof(m_stats));
+	m_stats.depth = m_count;
+}
+
+
+#pragma region Command_builders
+
+/*loco commands carry the slot address so DCCcore can discard them if the slot was reassigned in the meantime*/
+bool nsDCCbus::postLoco(uint8_t type, int8_t slot, int16_t value, uint8_t source) {
+	if (slot < 0 || slot >= MAX_LOCO) return false;
+	BUSCOMMAND c = {};
+	c.type = type;
+	c.source = source;
+	c.slot = slot;
+	c.address = loco[slot].address;
+	c.flags = loco[slot].useLongAddress ? BUSF_LONG : 0;
+	c.value = value;
+	return post(c);
+}
+
+bool nsDCCbus::locoSpeed(int8_t slot, int16_t speed126, uint8_t source) {
+	if (speed126 < 0) return locoEstop(slot, source);
+	if (speed126 > 126) speed126 = 126;
+	return postLoco(BUS_LOCO_SPEED, slot, speed126, source);
+}
+
+bool nsDCCbus::locoStep(int8_t slot, int8_t delta, uint8_t source) {
+	return postLoco(BUS_LOCO_STEP, slot, delta, source);
+}
+
+bool nsDCCbus::locoDirection(int8_t slot, uint8_t dir, uint8_t source) {
+	return postLoco(BUS_LOCO_DIR, slot, dir, source);
+}
+
+bool nsDCCbus::locoFunction(int8_t slot, uint8_t function, uint8_t source) {
+	return postLoco(BUS_LOCO_FUNCTION, slot, function, source);
+}
+
+bool nsDCCbus::locoEstop(int8_t slot, uint8_t source) {
+	return postLoco(BUS_LOCO_ESTOP, slot, 0, source);
+}
+
+bool nsDCCbus::stopAll(uint8_t source) {
+	BUSCOMMAND c = {};
+	c.type = BUS_STOP_ALL;
+	c.source = source;
+	c.slot = -1;
+	return post(c);
+}
+
+bool nsDCCbus::estopAll(uint8_t source) {
+	BUSCOMMAND c = {};
+	c.type = BUS_ESTOP_ALL;
+	c.source = source;
+	c.slot = -1;
+	return post(c);
+}
+
+/*slot may be -1, in which case DCCcore will find or assign a slot for the address*/
+bool nsDCCbus::setTurnout(int8_t slot, uint16_t address, uint8_t state, uint8_t source) {
+	if (address == 0 || address > 2047) return false;
+	BUSCOMMAND c = {};
+	c.type = BUS_TURNOUT;
+	c.source = source;
+	c.slot = slot;
+	c.address = address;
+	c.value = state;
+	return post(c);
+}
+
+bool nsDCCbus::setPower(bool powerOn, uint8_t source) {
+	BUSCOMMAND c = {};
+	c.type = BUS_POWER;
+	c.source = source;
+	c.slot = -1;
+	c.value = powerOn ? 1 : 0;
+	return post(c);
+}
+
+bool nsDCCbus::writePOM(uint16_t address, uint8_t flags, uint16_t cv, uint8_t data, uint8_t source) {
+	if (address == 0) return false;
+	if (cv == 0 || cv > 1024) return false;
+	BUSCOMMAND c = {};
+	c.type = BUS_POM;
+	c.source = source;
+	c.slot = -1;
+	c.address = address;
+	c.flags = flags;
+	c.cv = cv;
+	c.data = data;
+	return post(c);
+}
+
+//overload for remote POM. addr is L123 or S3, the cv register value passed is the display value i.e. 1-1024
+//val is B23 S0 C2 where the instruction is byte, set, clear for bits
+bool nsDCCbus::writePOM(const char *addr, uint16_t cv, const char *val, uint8_t source) {
+	if (addr == nullptr) return false;
+	if (val == nullptr) return false;
+
+	uint8_t flags = addr[0] == 'L' ? BUSF_LONG : 0;
+	uint16_t address = atoi(addr + 1);
+	uint8_t data;
+
+	switch (val[0]) {
+	case 'B':
+		data = atoi(val + 1);
+		break;
+	case 'S':
+	case 'C':
+		//bit write. data <2-0> represent the bit posn, <7> represents set or clear
+		data = (val[1] - '0') & 0b111;
+		data += val[0] == 'S' ? 0b10000000 : 0;
+		flags |= BUSF_BIT;
+		break;
+	default:
+		return false;
+	}
+	return writePOM(address, flags, cv, data, source);
+}
+
+bool nsDCCbus::service(uint8_t action, uint16_t cv, uint8_t data, uint8_t source) {
+	BUSCOMMAND c = {};
+	c.type = BUS_SERVICE;
+	c.source = source;
+	c.slot = -1;
+	c.value = action;
+	c.cv = cv;
+	c.data = data;
+	return post(c);
+}
+
+#pragma endregion
@@ -0,0 +1,107 @@
+// DCCbus.h
+//Typed command bus.  The keypad, jogwheel, WiThrottle and websocket front-ends post commands here
+//and DCCcore drains them once per 10mS tick.  This is the only path by which a front-end changes
+//loco speed/direction/function, turnout state, track power, POM or service mode.
+
+#ifndef _DCCBUS_h
+#define _DCCBUS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "Global.h"
+
+
+namespace nsDCCbus {
+
+#define BUS_QUEUE_SIZE		32   //pending commands held in the ring
+#define BUS_RESERVED		4    //last few slots are kept free for eStop and power-off
+#define BUS_DRAIN_PER_TICK	8    //max commands DCCcore will apply per 10mS tick
+
+	/*command types. slot refers to loco[] or turnout[], -1 if not known to the sender*/
+	enum BUSCMD {
+		BUS_LOCO_SPEED,		//absolute speed, value is 0-126 (WiThrottle scale). not blocked by eStop
+		BUS_LOCO_STEP,		//relative speed step, value is signed delta. shunter aware, blocked by eStop
+		BUS_LOCO_DIR,		//value 0=reverse 1=forward 2=toggle (nudge if moving)
+		BUS_LOCO_FUNCTION,	//toggle function number value
+		BUS_LOCO_ESTOP,		//eStop a single loco
+		BUS_STOP_ALL,		//zero speed on all locos, no eStop packet
+		BUS_ESTOP_ALL,		//broadcast eStop, zero all locos, restore any trip
+		BUS_TURNOUT,		//value 0=close 1=throw 2=toggle
+		BUS_POWER,			//value 0=off 1=on
+		BUS_POM,			//program on main, see flags
+		BUS_SERVICE			//service mode, value is a SVCACTION
+	};
+
+	/*who posted the command. local commands are replicated across a consist*/
+	enum BUSSOURCE {
+		BUS_LOCAL,
+		BUS_WITHROTTLE,
+		BUS_WEB
+	};
+
+	enum SVCACTION {
+		SVC_ENTER,
+		SVC_EXIT,
+		SVC_DIRECT,		//direct mode byte write
+		SVC_PAGED,		//paged mode byte write
+		SVC_READ		//direct mode bitwise read with byte verify
+	};
+
+	/*flags for BUS_POM*/
+#define BUSF_LONG		0x01
+#define BUSF_ACCESSORY	0x02
+#define BUSF_BIT		0x04  //bit write, data <7> is the value and <2-0> the bit posn
+
+	struct BUSCOMMAND {
+		uint8_t		type;
+		uint8_t		source;
+		int8_t		slot;
+		uint8_t		flags;
+		uint16_t	address;  //loco, turnout or POM address. used to validate slot
+		int16_t		value;
+		uint16_t	cv;
+		uint8_t		data;
+		uint32_t	stamp;    //micros() when posted
+	};
+
+	struct BUSSTATS {
+		uint32_t	posted;
+		uint32_t	applied;
+		uint32_t	dropped;
+		uint32_t	coalesced;	//speed commands merged into one already queued
+		uint32_t	lastLatency_us;
+		uint32_t	maxLatency_us;
+		uint8_t		depth;
+		uint8_t		highWater;
+	};
+
+	/*function prototypes*/
+	bool post(BUSCOMMAND &c);
+	bool pop(BUSCOMMAND &c);
+	const BUSSTATS &getStats(void);
+	void clearStats(void);
+
+	bool locoSpeed(int8_t slot, int16_t speed126, uint8_t source);
+	bool locoStep(int8_t slot, int8_t delta, uint8_t source);
+	bool locoDirection(int8_t slot, uint8_t dir, uint8_t source);
+	bool locoFunction(int8_t slot, uint8_t function, uint8_t source);
+	bool locoEstop(int8_t slot, uint8_t source);
+	bool stopAll(uint8_t source);
+	bool estopAll(uint8_t source);
+	bool setTurnout(int8_t slot, uint16_t address, uint8_t state, uint8_t source);
+	bool setPower(bool powerOn, uint8_t source);
+	bool writePOM(uint16_t address, uint8_t flags, uint16_t cv, uint8_t data, uint8_t source);
+	bool writePOM(const char *addr, uint16_t cv, const char *val, uint8_t source);
+	bool service(uint8_t action, uint16_t cv, uint8_t data, uint8_t source);
+
+	/*local scope, hence declared static*/
+	static bool isCritical(const BUSCOMMAND &c);
+	static bool coalesce(const BUSCOMMAND &c);
+	static bool postLoco(uint8_t type, int8_t slot, int16_t value, uint8_t source);
+
+}
+#endif
@@ -5,6 +5,13 @@
 #include "DCCcore.h"
 #include "DCClayer1.h"
 #include "DCCweb.h"
+#include "WiThrottle.h"
+#include "DCCbus.h"
+#include "TimerWheel.h"
+#include "HeapStats.h"
+#include "DCCstore.h"
+#include "LocoRoster.h"
+#include "RtcSnapshot.h"
 
 #include <LiquidCrystal_I2C.h>   //Github mlinares1998/NewLiquidCrystal
 //https://github.com/mlinares1998/NewLiquidCrystal
@@ -64,11 +71,17 @@ KEYPAD keypad;
 nsJogWheel::JOGWHEEL jogWheel;
 TURNOUT turnout[MAX_TURNOUT];
 LOCO loco[MAX_LOCO];
+uint16_t locoRosterGen = 1;
+uint16_t turnoutRosterGen = 1;
 ACCESSORY accessory;
-bool quarterSecFlag;
 
 
-uint8_t   m_generalTimer;
+//2026-10-19 countdowns are held in the timer wheel, times are in quarter seconds as before
+static nsTimerWheel::TIMER m_generalTimer;
+static nsTimerWheel::TIMER m_cvTimer;
+static nsTimerWheel::TIMER m_pomTimer;
+static nsTimerWheel::TIMER m_eStopTimer[MAX_LOCO];
+#define QUARTER_SEC_MS	250
 uint8_t  m_tick;  //25 ticks in a quarter second
 uint8_t m_eStopDebounce;  //holds debounce scan of local estop button
 
@@ -215,6 +228,8 @@ enum machineSTATE
 
 /*statics*/
 machineSTATE m_machineSE = M_BOOT;
+/*2026-10-19 a warm resume where the track was off, tripped or in eStop before the reset.  M_BOOT leaves it off*/
+static bool m_bootPowerOff = false;
 
 #pragma region Test_and_debug
 /*DEBUG ROUTINES*/
@@ -268,6 +283,90 @@ struct UNITHROTTLE {
 
 LOCO m_tempLoco;
 
+/*2026-10-19 speed packet for a loco, taken out of dccPacketEngine so that dccPrefill can build the same packets.
+returns the packet length.  nudge is applied but not counted down, the caller does that*/
+uint8_t speedPacket(LOCO &loc, volatile uint8_t *data) {
+	uint8_t i, len;
+	/*Build a packet, first step is to calculate NMRA speedCode to send to line*/
+	uint8_t speedCode = loc.speedStep;
+	/*2019-10-11 speedStep is the UI displayed value e.g. 0-28 or 0-128, active braking will halve this value*/
+	if (loc.brake) { speedCode = speedCode / 2; }
+	/*this does not impact the value displayed but does impact the value transmitted to line*/
+				   
+	if (loc.use128) {
+		/*calculate 128 step code. speed value 1 in the UI maps to 2 in NMRA code
+		display code 126 represents max speed and is a NRMA code of 127*/
+		if (speedCode > 0) { speedCode++; }
+		speedCode &= 0b01111111;
+	}
+	else {
+		/*calculate 28 step code. see S-9.2 para 60*/
+		if (speedCode > 0) {
+			speedCode += 3;
+			/*move <0> to <5> then shift result >>1*/
+			speedCode &= 0b00011111;
+			speedCode |= (speedCode & 0x01) << 5;
+			speedCode = speedCode >> 1;
+		}
+	}
+	/*done, how we use this code depends on whether we use baseline or extended packets
+	 *note that an address<127 with a 28 step speed is a baseline packet.  This code does
+	 *not implement addresses<127 as long adddresses.
+	 *Decoders can be set to respond to either short or long address, but never both.
+	 */
+
+	if (loc.useLongAddress) {
+		/*long address format S9.2.1 para 60*/
+		data[0] = loc.address >> 8;
+		data[0] |= 0b11000000;
+		data[1] = loc.address & 0x00FF;
+		i = 2;
+	}
+	else {
+		data[0] = (loc.address & 0x7F);
+		i = 1;
+	}
+
+	if (loc.use128) {
+		/*two speed-bytes*/
+		data[i] = 0b00111111;
+		i++;
+		/*mask in <7> which is direction*/
+		if (loc.forward) { speedCode |= 0b10000000; }
+		/*nudge code, will assert max speed in alternate directions until nudge=0*/
+		if (loc.nudge > 0) {
+			speedCode = 0x7F;
+			if (loc.nudge & 0x01 == 0x00) { speedCode ^= 0b10000000; }
+		}
+		/*special case for eStop*/
+		if (loc.eStopTimer != 0) { speedCode = 0x01; }
+		data[i] = speedCode;
+		i++;
+	}
+	else {
+		/*write single speed byte in legacy mode 010=reverse speed 011=forward*/
+		  /*mask in direction bit <5>*/
+		if (loc.forward) { speedCode |= 0b00100000; }
+		/*nudge code, will assert max speed in alternate directions until nudge=0*/
+		if (loc.nudge > 0) {
+			speedCode = 0x1F;
+			if (loc.nudge & 0x01 == 0x00) { speedCode ^= 0b00100000; }
+		}
+		/*special case for eStop, need to preserve direction*/
+		if (loc.eStopTimer != 0) { speedCode &= 0b00100000; speedCode |= 0x01; }
+		/*set <7-6> = 01*/
+		data[i] = speedCode | 0b01000000;
+		i++;
+	}
+	/*calc checksum and packet length. i points to checksum byte*/
+	data[i] = 0;
+	for (len = 0;len < i;len++) {
+		data[i] ^= data[len];
+	}
+	len++;
+	return len;
+}
+
 //generates dcc packets and queues to DCClayer1
 void dccPacketEngine(void) {
 	/*transmit the loco buffer, if a loco address is zero, transmit idle instead
@@ -309,86 +408,8 @@ void dccPacketEngine(void) {
 			}
 			else
 			{
-				/*Build a packet, first step is to calculate NMRA speedCode to send to line*/
-				uint8_t speedCode = loco[m_locoIndex].speedStep;
-				/*2019-10-11 speedStep is the UI displayed value e.g. 0-28 or 0-128, active braking will halve this value*/
-				if (loco[m_locoIndex].brake) { speedCode = speedCode / 2; }
-				/*this does not impact the value displayed but does impact the value transmitted to line*/
-							   
-				if (loco[m_locoIndex].use128) {
-					/*calculate 128 step code. speed value 1 in the UI maps to 2 in NMRA code
-					display code 126 represents max speed and is a NRMA code of 127*/
-					if (speedCode > 0) { speedCode++; }
-					speedCode &= 0b01111111;
-				}
-				else {
-					/*calculate 28 step code. see S-9.2 para 60*/
-					if (speedCode > 0) {
-						speedCode += 3;
-						/*move <0> to <5> then shift result >>1*/
-						speedCode &= 0b00011111;
-						speedCode |= (speedCode & 0x01) << 5;
-						speedCode = speedCode >> 1;
-					}
-				}
-				/*done, how we use this code depends on whether we use baseline or extended packets
-				 *note that an address<127 with a 28 step speed is a baseline packet.  This code does
-				 *not implement addresses<127 as long adddresses.
-				 *Decoders can be set to respond to either short or long address, but never both.
-				 */
-			
-				if (loco[m_locoIndex].useLongAddress) {
-					/*long address format S9.2.1 para 60*/
-					DCCpacket.data[0] = loco[m_locoIndex].address >> 8;
-					DCCpacket.data[0] |= 0b11000000;
-					DCCpacket.data[1] = loco[m_locoIndex].address & 0x00FF;
-					i = 2;
-				}
-				else {
-					DCCpacket.data[0] = (loco[m_locoIndex].address & 0x7F);
-					i = 1;
-				}
-
-				if (loco[m_locoIndex].use128) {
-					/*two speed-bytes*/
-					DCCpacket.data[i] = 0b00111111;
-					i++;
-					/*mask in <7> which is direction*/
-					if (loco[m_locoIndex].forward) { speedCode |= 0b10000000; }
-					/*nudge code, will assert max speed in alternate directions until nudge=0*/
-					if (loco[m_locoIndex].nudge > 0) {
-						speedCode = 0x7F;
-						if (loco[m_locoIndex].nudge & 0x01 == 0x00) { speedCode ^= 0b10000000; }
-						loco[m_locoIndex].nudge--;
-					}
-					/*special case for eStop*/
-					if (loco[m_locoIndex].eStopTimer != 0) { speedCode = 0x01; }
-					DCCpacket.data[i] = speedCode;
-					i++;
-				}
-				else {
-					/*write single speed byte in legacy mode 010=reverse speed 011=forward*/
-					  /*mask in direction bit <5>*/
-					if (loco[m_locoIndex].forward) { speedCode |= 0b00100000; }
-					/*nudge code, will assert max speed in alternate directions until nudge=0*/
-					if (loco[m_locoIndex].nudge > 0) {
-						speedCode = 0x1F;
-						if (loco[m_locoIndex].nudge & 0x01 == 0x00) { speedCode ^= 0b00100000; }
-						loco[m_locoIndex].nudge--;
-					}
-					/*special case for eStop, need to preserve direction*/
-					if (loco[m_locoIndex].eStopTimer != 0) { speedCode &= 0b00100000; speedCode |= 0x01; }
-					/*set <7-6> = 01*/
-					DCCpacket.data[i] = speedCode | 0b01000000;
-					i++;
-				}
-				/*calc checksum and packet length. i points to checksum byte*/
-				DCCpacket.data[i] = 0;
-				for (DCCpacket.packetLen = 0;DCCpacket.packetLen < i;DCCpacket.packetLen++) {
-					DCCpacket.data[i] ^= DCCpacket.data[DCCpacket.packetLen];
-				}
-				DCCpacket.packetLen++;
-				/*will exit with DCCpacket.packetLen set at correct length of i+1*/
+				DCCpacket.packetLen = speedPacket(loco[m_locoIndex], DCCpacket.data);
+				if (loco[m_locoIndex].nudge > 0) { loco[m_locoIndex].nudge--; }
 
 
 			} /*end zero address test*/
@@ -404,14 +425,15 @@ void dccPacketEngine(void) {
 
 
 		case DCC_FUNCTION:
-			/*function packets are controlled by funcIndex and transmit at 1/3rd rate of loco*/
+			/*function packets are controlled by funcIndex and transmit at 1/5th rate of loco*/
+			/*2026-10-19 five groups per loco, F0-F12 as before plus F13-F20 and F21-F28 feature expansion packets*/
 		{//block start
 			uint8_t fValue;
-			uint8_t fLoco = m_funcIndex / 3;
+			uint8_t fLoco = m_funcIndex / 5;
 
 			if (loco[fLoco].address != 0) {
 				/*2019-10-08 support long address*/
-				if (loco[m_locoIndex].useLongAddress) {
+				if (loco[fLoco].useLongAddress) {
 					/*long address format S9.2.1 para 60*/
 					DCCpacket.data[0] = loco[fLoco].address >> 8;
 					DCCpacket.data[0] |= 0b11000000;
@@ -425,7 +447,19 @@ void dccPacketEngine(void) {
 
 				/*i will point to next data[] element we write to*/
 
-				switch (m_funcIndex % 3) {
+				switch (m_funcIndex % 5) {
+				case 4:
+					/*F21-F28 S-9.2.1 para 295 feature expansion 11011111 DDDDDDDD*/
+					DCCpacket.data[i] = 0b11011111;
+					i++;
+					fValue = (loco[fLoco].function >> 21) & 0xFF;
+					break;
+				case 3:
+					/*F13-F20 S-9.2.1 para 295 feature expansion 11011110 DDDDDDDD*/
+					DCCpacket.data[i] = 0b11011110;
+					i++;
+					fValue = (loco[fLoco].function >> 13) & 0xFF;
+					break;
 				case 1:
 					/*send a function group 2 packet S-9.2.1 para 270 101SDDDD*/
 					fValue = (loco[fLoco].function >> 5) & 0b1111;
@@ -457,9 +491,9 @@ void dccPacketEngine(void) {
 
 			}
 
-			/*increment funcIndex and rollover at 3*max_loco. Next up is loco packet*/
+			/*increment funcIndex and rollover at 5*max_loco. Next up is loco packet*/
 			++m_funcIndex;
-			if (m_funcIndex >= MAX_LOCO * 3) { m_funcIndex = 0; }
+			if (m_funcIndex >= MAX_LOCO * 5) { m_funcIndex = 0; }
 			dccSE = DCC_LOCO;
 		}//block end
 			break;
@@ -806,7 +840,7 @@ void dccPacketEngine(void) {
 				loc.speed = 0;
 				loc.speedStep = 0;
 				//note a non-zero eStopTimer lets the dcc packet engine know to transmit an estop message
-				loc.eStopTimer = LOCO_ESTOP_TIMEOUT;
+				startEstop(locoSlot(&loc));
 				//flag a change so this gets broadcast over all channels
 				loc.changeFlag = true;
 			}
@@ -973,10 +1007,9 @@ int8_t setTurnoutFromKey(KEYPAD &k) {
 		/*find selected turnout, toggle it*/
 		for (i = 0;i < MAX_TURNOUT;i++) {
 			if (turnout[i].selected) {
-				turnout[i].thrown = !turnout[i].thrown;
-
 				/*2020-05-18 modified.  Set a flag, updateLocalDisplay will queue the transmission*/
-				turnout[i].changeFlag = true;
+				//2026-10-19 the toggle is posted to the command bus which sets the flag
+				nsDCCbus::setTurnout(i, turnout[i].address, 2, nsDCCbus::BUS_LOCAL);
 				r = i;
 			}
 		}
@@ -991,8 +1024,7 @@ int8_t setTurnoutFromKey(KEYPAD &k) {
 
 		i = k.keyASCII - 'A';
 		turnout[i].selected = true;
-		turnout[i].thrown = !turnout[i].thrown;
-		turnout[i].changeFlag = true;
+		nsDCCbus::setTurnout(i, turnout[i].address, 2, nsDCCbus::BUS_LOCAL);
 		r = i;
 	}
 	return r;
@@ -1030,9 +1062,11 @@ int8_t findTurnout(uint16_t turnoutAddress) {
 		for (i = 0;i < MAX_TURNOUT;i++) {
 			if (turnout[i].address == 0) {
 				turnout[i].address = turnoutAddress;
+				turnout[i].selected = true;
+				turnout[i].history = 0;
 				//default name is the numeric address
 				snprintf(turnout[i].name, 8, "%d", turnout[i].address);
-				bootController.flagTurnoutRoster = true;
+				turnoutRosterChanged();
 				break;
 			}
 		}
@@ -1043,9 +1077,9 @@ int8_t findTurnout(uint16_t turnoutAddress) {
 		turnout[oldestSlot].address = turnoutAddress;
 		turnout[oldestSlot].selected = true;
 		turnout[oldestSlot].history = 0;
-		bootController.flagTurnoutRoster = true;
 		//overwrite the name with the numeric address
-		snprintf(turnout[oldestSlot].name, 8, "%d", turnout[i].address);
+		snprintf(turnout[oldestSlot].name, 8, "%d", turnout[oldestSlot].address);
+		turnoutRosterChanged();
 	}
 
 	/*at this point we always have a slot selected, increment history of all other items*/
@@ -1111,31 +1145,18 @@ bool setCVfromKey(void) {
 	/*Direct write byte*/
 	if (keypad.keyASCII == 'D') {
 		if (m_cv.cvData < 0) { return true; }
-		dccSE = DCC_SERVICE;
-		m_cv.timeout = 8;  //2 sec
-		m_cv.state = D_START;
+		nsDCCbus::service(nsDCCbus::SVC_DIRECT, m_cv.cvReg, m_cv.cvData, nsDCCbus::BUS_LOCAL);
 	}
 
 	/*Page write byte*/
 	if (keypad.keyASCII == 'C') {
 		if (m_cv.cvData < 0) { return true; }
-		dccSE = DCC_SERVICE;
-		m_cv.timeout = 8;  //2 sec
-		m_cv.state = PG_START;
+		nsDCCbus::service(nsDCCbus::SVC_PAGED, m_cv.cvReg, m_cv.cvData, nsDCCbus::BUS_LOCAL);
 	}
 
 	/*Read bits using direct mode*/
 	if (keypad.keyASCII == 'A') {
-		dccSE = DCC_SERVICE;
-		m_cv.timeout = 8;  //2 sec
-		/*set up entry conditions, including capturing the bus current*/
-		power.ackBase_mA = power.bus_mA;
-		power.bus_peak_mA = power.ackBase_mA;
-		//change to trigger mode and take one sample to initialise the ina
-		ina219Mode(false);
-		m_cv.state = RD_START;
-		m_cv.bitCount = 7;
-		m_cv.cvData = 0;
+		nsDCCbus::service(nsDCCbus::SVC_READ, m_cv.cvReg, 0, nsDCCbus::BUS_LOCAL);
 		return false;
 	}
 
@@ -1195,11 +1216,17 @@ void setPOMfromKey(void) {
 		m_pom.digitPos = 0;
 		return;
 	case 'D':
-		/*write*/
-		if (m_pom.state == POM_BIT) { m_pom.state = POM_BIT_WRITE; }
-		if (m_pom.state == POM_BYTE) { m_pom.state = POM_BYTE_WRITE; }
-		dccSE = DCC_POM;  //initiate write sequence
-		m_pom.timeout = 8;
+		/*write, the bus will initiate the write sequence*/
+	{
+		uint8_t flags = m_pom.useLongAddr ? BUSF_LONG : 0;
+		flags |= m_pom.useAccessoryAddr ? BUSF_ACCESSORY : 0;
+		if (m_pom.state == POM_BIT || m_pom.state == POM_BIT_WRITE) {
+			nsDCCbus::writePOM(m_pom.addr, flags | BUSF_BIT, m_pom.cvReg, m_pom.cvBit, nsDCCbus::BUS_LOCAL);
+		}
+		else {
+			nsDCCbus::writePOM(m_pom.addr, flags, m_pom.cvReg, m_pom.cvData, nsDCCbus::BUS_LOCAL);
+		}
+	}
 		return;
 	}
 
@@ -1321,71 +1348,38 @@ int8_t setLoco(LOCO *loc, int8_t speed, bool dir) {
 	if (loc == nullptr) return -1;
 	trace(Serial.println(F("\nsetLoco\n"));)
 
-	//estop condition is blocking, meaning no changes to dir or speed
-		if (loc->eStopTimer == 0) {
-			//find max of history
-			
-
-			if (speed > 0) {
-				//incr speed
-				if (loc->use128) {
-					loc->speedStep += (loc->speedStep < 126) ? 1 : 0;
-				}
-				else {
-					loc->speedStep += (loc->speedStep < 28) ? 1 : 0;
-				}
-			}
-			else if (speed < -1) {
-				//estop is -2
-				loc->speed = 0;
-				loc->speedStep = 0;
-				//note a non-zero eStopTimer lets the dcc packet engine know to transmit an estop message
-				loc->eStopTimer = LOCO_ESTOP_TIMEOUT;
-			}
-			else if (speed == -1) {
-				//decr speed
-				loc->speedStep -= (loc->speedStep > 0) ? 1 : 0;
-			}
+	//return the slot modified, -1 if its not in the loco array
+	int8_t slot = locoSlot(loc);
+	if (slot < 0) return -1;
 
-			/*recalc the float speed value. C++ will give an int result for an integer divisor, hence need to express divisor
-			 *as a double to force floating point math*/
-			if (loc->use128) {
-				loc->speed = loc->speedStep / 126.0;
-			}
-			else {
-				loc->speed = loc->speedStep / 28.0;
-			}
+	//2026-10-19 speed and direction changes are posted to the command bus. the bus applies
+	//the estop block, speed limits and shunter mode
+	if (speed < -1) {
+		//estop is -2
+		nsDCCbus::locoEstop(slot, nsDCCbus::BUS_LOCAL);
+	}
+	else if (speed != 0) {
+		nsDCCbus::locoStep(slot, speed, nsDCCbus::BUS_LOCAL);
+	}
 
-			loc->changeFlag = speed != 0 ? true : false;
+	if (dir) {
+		//reverse if stationary, else nudge
+		nsDCCbus::locoDirection(slot, 2, nsDCCbus::BUS_LOCAL);
+	}
 
-			//direction
-			if (dir) {
-				if (loc->speed == 0) {
-					/*if loco is stationary, reverse direction*/
-					loc->forward = !loc->forward;
-					loc->directionFlag = true;
-				}
-				else {
-					/*else give it a nudge*/
-					loc->nudge = 1;
-				}
-				loc->changeFlag = true;
-			}
+	//increment history provided this was not an estop event
+	if (speed >= -1) {
+		incrLocoHistory(loc);
+	}
+	return slot;
+}
 
-			//end of no-estop non-blocking code section
-		}
-	//return the slot modified, -1 if its not in the loco array
-	//if eStop was blocking changes, we still need to return the slot
-	for (int i = 0;i < MAX_LOCO;++i) {
-		if (&loco[i] == loc) {
-			//increment history provided this was not an estop event
-			if (speed >= -1) {
-				incrLocoHistory(loc);
-			}
-			return i; }
-		}
+//returns the loco[] index of loc, or -1 if it is not in the loco array (e.g. the editor copy)
+int8_t locoSlot(LOCO *loc) {
+	for (int8_t i = 0;i < MAX_LOCO;++i) {
+		if (&loco[i] == loc) return i;
+	}
 	return -1;
-
 }
 
 
@@ -1432,8 +1426,7 @@ int8_t setFunctionFromKey(KEYPAD &k) {
 	if (k.keyHeld) { return -2; }
 	/*F1-4 shown as bit 1234 msb is rightmost. F0 is controlled from the loco display*/
 	i--;
-	loco[(i / 4)].function ^= (0b10 << (i % 4));
-	loco[(i / 4)].functionFlag = true;
+	nsDCCbus::locoFunction(i / 4, (i % 4) + 1, nsDCCbus::BUS_LOCAL);
 	return (i / 4);
 }
 
@@ -1772,40 +1765,27 @@ void updateCvDisplay(void) {
 #pragma endregion
 
 
-/*restores settings from EEPROM. If the software version has changed, we overwrite the eeprom with defaults.
- *we also need to clear certain values on boot. max EEPROM we can use is 4096
- 2021-11-22 bug fix, with 8 locos and 8 turnouts, EEPROM needs to be min 532 bytes.  Expanded it to 1024*/
+/*restores settings.  we also need to clear certain values on boot.
+ 2026-10-19 settings are now a record log in LittleFS, see DCCstore.cpp.  A change of software version no
+ longer resets them.  On the first boot with the log, settings are imported from EEPROM if its layout matches,
+ otherwise factory defaults apply*/
 void dccGetSettings() {
 	CONTROLLER defaultController;  //grab defaults as per DCCcore.h
-	EEPROM.begin(1024);
-	int eeAddr = 0;
-	EEPROM.get(eeAddr, bootController);
-	if (defaultController.softwareVersion != bootController.softwareVersion) {
-		/*need to re-initiatise eeprom with factory defaults*/
-		EEPROM.put(0,defaultController);
-		eeAddr += sizeof(bootController);
-		//2021-10-07 when doing a factory reset, only load loco 3
-		for (int i = 0;i < MAX_LOCO;++i) {
-			//loco[i].address = (i <MAX_LOCO )? i+3  : 0;
-			loco[i].address = (i ==0) ? i + 3 : 0;
-			loco[i].useLongAddress = false;
-		}
-		//other settings such as defaults for 28 steps and longAddr are defined in the struct itself
-		EEPROM.put(eeAddr, loco);
-		//2020-05-03 also store turnouts
-		eeAddr += sizeof(loco);
-		EEPROM.put(eeAddr, turnout);
-		EEPROM.commit();
-	}
-	//Now populate our structs with EEprom values
-	eeAddr = 0;
-	EEPROM.get(eeAddr, bootController);
-	eeAddr += sizeof(bootController);
-	EEPROM.get(eeAddr, loco);
-	//2020-05-03 also turnouts
-	eeAddr += sizeof(loco);
-	EEPROM.get(eeAddr, turnout);
-	eeAddr += sizeof(turnout);
+	if (!nsDCCstore::load()) {
+		if (!nsDCCstore::importEEPROM()) {
+			bootController = defaultController;
+			//2021-10-07 when doing a factory reset, only load loco 3
+			for (int i = 0;i < MAX_LOCO;++i) {
+				loco[i].address = (i ==0) ? i + 3 : 0;
+				loco[i].useLongAddress = false;
+			}
+			//other settings such as defaults for 28 steps and longAddr are defined in the struct itself
+		}
+		nsDCCstore::compact();
+	}
+	//the version is that of the running firmware, it is not stored
+	bootController.softwareVersion = defaultController.softwareVersion;
+	bootController.isDirty = false;
 	//Reset certain parameters on every boot
 	for (auto& loc : loco) {
 		loc.speed = 0;
@@ -1820,6 +1800,21 @@ void dccGetSettings() {
 		t.thrown = false;
 	}
 
+	//2026-10-19 after a crash pick up where we were.  Power the track without the boot delay only if it was
+	//live, a trip or eStop before the reset leaves it off for the operator to restore
+	if (nsRtcSnapshot::restore()) {
+		if (nsRtcSnapshot::getStats().live) setGeneralTimer(1);
+		else m_bootPowerOff = true;
+		dccPutSettings();
+	}
+
+	//any serialized copy of the rosters is now stale
+	++locoRosterGen;
+	++turnoutRosterGen;
+
+	//2026-10-19 bind the slots to the flash roster, see LocoRoster.cpp
+	nsLocoRoster::begin();
+
 	
 	/*initiailise UNIthrottle*/
 	loco[0].jog = true;
@@ -1830,26 +1825,68 @@ void dccGetSettings() {
 	m_tempLoco.function = 0;
 	unithrottle.digitPos = 0;
 
-	//trace dump the eeprom size used
-	trace(Serial.printf("GETsettings loco %d, turnout %d, bytes %d\r\n ", sizeof(loco), sizeof(turnout), eeAddr);)
+	trace(Serial.printf("GETsettings loco %d, turnout %d, records %d\r\n ", sizeof(loco), sizeof(turnout), nsDCCstore::getStats().loaded);)
 		
 }
 
-/*Call dccPutSettings if user changes a loco addr, short/long or step-size, or at system level they change current trip*/
+/*Call dccPutSettings if user changes a loco addr, short/long or step-size, or at system level they change current trip
+2026-10-19 only the records that changed are appended to the store.  The write is deferred, DCCcore calls
+dccFlushSettings once changes have settled and the packet engine is running loco packets*/
 void dccPutSettings() {
 	if (bootController.isDirty == false) { return; }
-	int eeAddr = 0;
-	EEPROM.put(eeAddr, bootController);
-	eeAddr += sizeof(bootController);
-	EEPROM.put(eeAddr, loco);
-	/*2020-05-03 also store turnouts*/
-	eeAddr += sizeof(loco);
-	EEPROM.put(eeAddr, turnout);
-	eeAddr += sizeof(turnout);
-
-	EEPROM.commit();
+	nsDCCstore::defer();
 	bootController.isDirty = false;
-	trace(Serial.printf("EEPROM commit, bytes %d\r\n",eeAddr);)
+}
+
+/*2026-10-19 for the RTC snapshot*/
+bool dccEstopActive(void) {
+	return m_machineSE == M_ESTOP;
+}
+
+/*write any pending settings now.  Also call ahead of a restart.  2026-10-19 with track power off this also
+rewrites the settings store and the loco roster if their logs are due it*/
+void dccFlushSettings() {
+	dccPutSettings();
+	if (!nsDCCstore::pending() && !dccCompactDue()) { return; }
+	dccPrefill();
+	//the logs are only rewritten with track power off
+	nsDCCstore::save(!power.trackPower);
+	nsLocoRoster::sync(!power.trackPower);
+	//send whatever the packet engine has waiting rather than the rest of the queue
+	DCCfillCount = 0;
+}
+
+/*2026-10-19 a log rewrite stalls far longer than an append, so waits for track power off*/
+bool dccCompactDue() {
+	if (power.trackPower) { return false; }
+	return nsDCCstore::compactDue() || nsLocoRoster::compactDue();
+}
+
+/*2026-10-19 queue speed packets for the active locos on layer 1 so that they are refreshed while a flash write
+stalls the main loop.  Idles if there are none.  Whatever is left over is discarded by the caller*/
+void dccPrefill() {
+	if (DCCfillCount != 0) { return; }
+	uint8_t slot = 0;
+	for (uint8_t n = 0; n < DCC_FILL; ++n) {
+		volatile DCCBUFFER &f = DCCfill[n];
+		f.longPreamble = false;
+		uint8_t tries = 0;
+		while (loco[slot].address == 0 && tries < MAX_LOCO) {
+			slot = (slot + 1) % MAX_LOCO;
+			++tries;
+		}
+		if (loco[slot].address == 0) {
+			f.data[0] = 0xFF;
+			f.data[1] = 0;
+			f.data[2] = 0xFF;
+			f.packetLen = 3;
+			continue;
+		}
+		f.packetLen = speedPacket(loco[slot], f.data);
+		slot = (slot + 1) % MAX_LOCO;
+	}
+	DCCfillNext = 0;
+	DCCfillCount = DCC_FILL;
 }
 
 
@@ -1938,7 +1975,7 @@ void DCCcoreBoot() {
 
 
 	/*would be useful to show IP address*/
-	m_generalTimer = 16;
+	setGeneralTimer(16);
 
 
 	/*INA219 current sensor*/
@@ -1946,20 +1983,15 @@ void DCCcoreBoot() {
 	ina219Mode(true); //modify ina config to do 8.5mS averaged samples
 }
 
-/*+++ CORE DCC ROUTINE, CALL FROM MAIN LOOP +++
- * will return -2 if no change made to any loco or turnout
- * will return 127 if eStop was pressed
- * will return 0-3 for the loco slot
- * turnoutslot will be indicated by 31-39 (offset 31)
+/*+++ CORE DCC ROUTINES, RUN AS SCHEDULER TASKS +++
+ * 2026-10-19 DCCcore was called on every pass of the main loop and polled DCCpacket.msTickFlag for its 10mS work.
+ * It is now split, dccTick is the 10mS "core" task and dccPump is served ahead of every task, see Scheduler.cpp.
+ * DCCcore returned the loco or turnout slot changed from the keypad, which nothing used
 */
 
-/*core machine processing, called from the INO loop*/
-int8_t DCCcore(void) {
-	
-	/*every 10mS as flagged from DCClayer1 as DCCpacket.msTickFlag, run keyscans and processing*/
-	int8_t r = -2;  //default return value
-		if (DCCpacket.msTickFlag) {
-		DCCpacket.msTickFlag = false;
+/*core machine processing every 10mS.  keyscans, bus commands, timers and current monitoring*/
+void dccTick(void) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_CORE);
 		
 	
 		//scan jogwheel
@@ -2015,9 +2047,8 @@ int8_t DCCcore(void) {
 				m_machineSE = M_ESTOP;
 				m_stateLED = L_ESTOP;
 				//call out to the e stop routine, will broadcast and estop signal and zero all individual locos
-				m_generalTimer = 16;
-				dccSE = DCC_ESTOP;
-				r = 127;
+				setGeneralTimer(16);
+				nsDCCbus::estopAll(nsDCCbus::BUS_LOCAL);
 				}
 			}
 
@@ -2044,7 +2075,7 @@ int8_t DCCcore(void) {
 					if (m_tempLoco.address == 0) {
 						//2021-1-9 entering zero as an address will delete the loco
 						//locPtr  on entry will be pointing to m_tempLoco
-						m_generalTimer = 12;
+						setGeneralTimer(12);
 
 						//find the active loco in-use on the display
 						LOCO *active = nullptr;
@@ -2068,14 +2099,15 @@ int8_t DCCcore(void) {
 						}
 						
 						
-						//proceed with delete
+						//proceed with delete, the loco stays in the roster
+						nsLocoRoster::release(active - loco);
 						active->address = 0;
 						memset(active->name, '\0', sizeof(active->name));
 						active->jog = false;
 						lcd.setCursor(0, 1);
 						lcd.print("Loco deleted    ");
 						//allow message to persist (on timeout of this timer it will update to show another loco)
-						m_generalTimer = 12;
+						setGeneralTimer(12);
 
 						bootController.isDirty = true;
 						dccPutSettings();
@@ -2084,14 +2116,14 @@ int8_t DCCcore(void) {
 						//find next loco and point at it
 						unithrottle.locPtr=getNextLoco(unithrottle.locPtr);
 						m_machineSE = M_UNI_RUN;
-						bootController.flagLocoRoster = true;
+						locoRosterChanged();
 						//updateUNIdisplay();  //don't update now
 						break;
 						//new code
 
 					}
 
-					m_generalTimer = 12;
+					setGeneralTimer(12);
 
 					{//scope block 2, proceed with writing a new address
 						char buffer[10];
@@ -2141,7 +2173,7 @@ int8_t DCCcore(void) {
 								}
 								//write back to eeprom
 								bootController.isDirty = true;  //pending write
-								bootController.flagLocoRoster = true;
+								locoRosterChanged();
 								//2021-09-01 increment age
 								incrLocoHistory(&loco[theSlot]);
 							}
@@ -2150,6 +2182,8 @@ int8_t DCCcore(void) {
 								//nominated as underutilised
 								lcd.clear();
 								lcd.print("Loco created");
+								//the loco leaving the slot stays in the roster
+								nsLocoRoster::release(theSlot);
 								loco[theSlot] = m_tempLoco;
 								loco[theSlot].speed = 0;
 								loco[theSlot].speedStep = 0;
@@ -2160,7 +2194,7 @@ int8_t DCCcore(void) {
 								trace(Serial.printf("overwrt %d\n", loco[theSlot].address);)
 								//write to eeprom
 								bootController.isDirty = true;  //pending write
-								bootController.flagLocoRoster = true;
+								locoRosterChanged();
 							}
 							//execute eeprom write
 							dccPutSettings();
@@ -2271,6 +2305,12 @@ int8_t DCCcore(void) {
 						m_tempLoco.speedStep = 0;
 						m_tempLoco.jog = false;
 						memset(m_tempLoco.name, '\0', sizeof(m_tempLoco.name));
+						//2026-10-19 not in a slot, but the roster may know it
+						nsLocoRoster::LOCOREC r;
+						if (nsLocoRoster::lookup(nsLocoRoster::key(m_tempLoco.address, m_tempLoco.useLongAddress), r)) {
+							m_tempLoco.use128 = (r.flags & ROSTER_USE128) != 0;
+							strncpy(m_tempLoco.name, r.name, sizeof(m_tempLoco.name) - 1);
+						}
 					}
 				}
 
@@ -2301,7 +2341,7 @@ int8_t DCCcore(void) {
 				//2020-10-07 otherwise process the key
 							   
 				//reset general timer for a current update
-				m_generalTimer = 12;
+				setGeneralTimer(12);
 				
 				if (unithrottle.locPtr == &m_tempLoco) {
 					m_machineSE = M_UNI_SET;
@@ -2398,36 +2438,13 @@ int8_t DCCcore(void) {
 					break;
 
 				case '*':
-					if (unithrottle.locPtr->shunterMode == 0) {
-						//normally a speed increase
-						setLoco(unithrottle.locPtr, 1, false);
-						break;
-						}
-					else {
-						//in shunter mode, we might need to decr instead
-						setLoco(unithrottle.locPtr, unithrottle.locPtr->shunterMode, false);
-						//if we just hit zero (means we were decrementing) then flip the sense to incr
-						if (unithrottle.locPtr->speed == 0) {
-							unithrottle.locPtr->shunterMode = 1;
-							setLoco(unithrottle.locPtr, 0, true);  //flip direction
-						}			
-					}
+					//normally a speed increase. in shunter mode the bus will decrement instead and
+					//flip the direction as we pass through zero
+					setLoco(unithrottle.locPtr, 1, false);
 					break;
 				case '0':
-					if (unithrottle.locPtr->shunterMode == 0) {
-						//normally a speed decrease
-						setLoco(unithrottle.locPtr, -1, false);
-						break;
-					}
-					else {
-						//in shunter mode, we might need to incr instead
-						setLoco(unithrottle.locPtr, -unithrottle.locPtr->shunterMode, false);
-						//if we just hit zero (means we were decrementing) then flip the sense to incr
-						if (unithrottle.locPtr->speed == 0) {
-							unithrottle.locPtr->shunterMode = -1;
-							setLoco(unithrottle.locPtr, 0, true);  //flip direction
-						}
-					}
+					//normally a speed decrease, shunter mode is handled as above
+					setLoco(unithrottle.locPtr, -1, false);
 					break;
 				case'#':
 					if (keypad.keyHeld) break;
@@ -2435,8 +2452,7 @@ int8_t DCCcore(void) {
 					break;
 				case 'D':
 					if (keypad.keyHeld) break;
-					unithrottle.locPtr->function ^= 1;
-					unithrottle.locPtr->functionFlag = true;
+					nsDCCbus::locoFunction(locoSlot(unithrottle.locPtr), 0, nsDCCbus::BUS_LOCAL);
 					break;
 				}
 
@@ -2445,27 +2461,18 @@ int8_t DCCcore(void) {
 
 				//eStop key is code 18
 				if (keypad.key == 18) {
-					setLoco(unithrottle.locPtr, -2, false);				
+					setLoco(unithrottle.locPtr, -2, false);
 				}
-				
-				//direct function control
+
+				//direct function control F1-F8
 				if ((keypad.keyASCII >= '1') && (keypad.keyASCII <= '8')) {
-					uint8_t k = keypad.keyASCII - '1' ;
-					unithrottle.locPtr->function ^= (0b10 << k);
-					unithrottle.locPtr->functionFlag = true;
+					nsDCCbus::locoFunction(locoSlot(unithrottle.locPtr), keypad.keyASCII - '0', nsDCCbus::BUS_LOCAL);
 				}
 
 				updateUNIdisplay();  //need this if we  are using temp LOCO as that is not going to trigger the update
 
-
-				//if we made a speed/dir change, check jog is set
-				if ((unithrottle.locPtr->changeFlag) && (!unithrottle.locPtr->jog)) {
-					for (auto &loc : loco) {
-						loc.jog = false;
-					}
-					unithrottle.locPtr->jog = true;
-				}
-
+				//2026-10-19 speed/dir changes are applied from the bus on this same tick, the bus also
+				//ensures jog is set on the loco we are driving
 				break;
 
 			case M_TURNOUT:
@@ -2475,11 +2482,8 @@ int8_t DCCcore(void) {
 					updateUNIdisplay();
 				}  //mode
 				else {
-					/*pass keypad by pointer as the function will modify it
-					 *the turnout index returned needs to have an offset of 31 added*/
-					r = setTurnoutFromKey(keypad);
-					/*only add the index if return value is +ve*/
-					if (r >= 0) { r += 31; }
+					/*pass keypad by pointer as the function will modify it*/
+					setTurnoutFromKey(keypad);
 					updateTurnoutDisplay();
 				}
 				break;
@@ -2564,21 +2568,16 @@ int8_t DCCcore(void) {
 			//jogwheel related changes to local machine state engine
 			switch (m_machineSE) {
 			case M_UNI_RUN:
-				m_generalTimer = 10;
+				setGeneralTimer(10);
 				//2020-07-05 for unithrottle we need to trigger a display refresh
 			
 			//2020-06-14 allow jog to control loco during turnout mode and function mode
 			case M_TURNOUT:
 			
 								
-				r = setLocoFromJog(jogWheel);
-
-				//2020-05-03 flag a change for broadcasting, UI update to follow
-				if (r >= 0) { 
-					loco[r].changeFlag = true;
-					//modifying a single loco that is in a WiThrottle consist is handled here
-					replicateAcrossConsist(r);
-				}
+				//2026-10-19 jog posts to the command bus. flagging the change for broadcast and
+				//replicating across a WiThrottle consist are done as the bus applies the command
+				setLocoFromJog(jogWheel);
 			}
 
 		}
@@ -2595,26 +2594,30 @@ int8_t DCCcore(void) {
 				}
 		}
 
+		//apply commands posted by the keypad, jog, WiThrottle and websocket front-ends. Local commands posted
+		//above are applied in this same tick
+		{
+			nsDCCbus::BUSCOMMAND cmd;
+			for (int n = 0; n < BUS_DRAIN_PER_TICK; ++n) {
+				if (!nsDCCbus::pop(cmd)) break;
+				applyBusCommand(cmd);
+			}
+		}
+
+
+		//advance the timer wheel, this may fire eStop, display and client heartbeat timeouts
+		nsTimerWheel::tick();
 
 		//deal with all 250mS event counters here
 		++m_tick;
 		if (m_tick >= 25) {
-			//count down any open eStop timers and the generalTimer
+			//2026-10-19 eStop, cv, POM and the general timer now count down in the timer wheel
 			m_tick = 0;
-			quarterSecFlag = true;
-			for (auto& loc : loco) {
-				loc.eStopTimer -= loc.eStopTimer == 0 ? 0 : 1;
-			}
-			
-			//countdown cv timeout. repaint display as we hit zero
-			if (m_cv.timeout > 0) {
-				m_cv.timeout--;
-				if (m_cv.timeout == 0) { updateCvDisplay(); }
-			}
-			//countdown POM timeout. repaint display as we hit zero
-			if (m_pom.timeout > 0) {
-				m_pom.timeout--;
-				if (m_pom.timeout == 0) { updatePOMdisplay(); }
+
+			//2026-10-19 deferred settings write, not while service mode, POM, accessory or eStop packets are pending
+			//and any log rewrite that was put off until track power is off
+			if ((nsDCCstore::due() || dccCompactDue()) && !power.serviceMode && (dccSE == DCC_LOCO || dccSE == DCC_FUNCTION)) {
+				dccFlushSettings();
 			}
 
 			//handle LED display state. We don't write directly to the PIN_HEARTBEAT pin, instead it is handled through
@@ -2629,50 +2632,6 @@ int8_t DCCcore(void) {
 			}
 
 
-			//timer event driven machine state
-			if (m_generalTimer > 0) {
-				m_generalTimer--;
-			
-				if (m_generalTimer == 0)
-				{//hit zero
-					switch (m_machineSE) {
-					case M_BOOT:
-						//enable track power, then measure quiescent current
-						trace(Serial.println(F("enable power"));)
-						power.trackPower = true;
-						//assume quiescent power is say 250mA,this gets adjusted downward as the unit sees
-						//real readings come in
-						power.quiescent_mA = 250;
-						//2021-10-22 clear bus_volts
-						power.bus_volts = 0; 
-						
-						///2020-10-07 we boot in M_UNI_RUN
-						m_machineSE = M_UNI_RUN;
-						m_stateLED = L_NORMAL;
-						updateUNIdisplay();
-						
-						//2020-06-14 if user pressed mode during boot or estop, then boot in limited current mode.
-						//this is handled above in the key routines
-						break;
-											   
-					case M_ESTOP:
-						m_machineSE = M_UNI_RUN;
-						//2020-01-26 return to processing loco packets
-						dccSE = DCC_LOCO;
-
-						//no break, run on into block below
-					case M_UNI_RUN:
-					case M_UNI_SET:
-						updateUNIdisplay();
-						//force display to refresh with current reading every 1.5 second
-						m_generalTimer = 6;
-						m_stateLED = L_NORMAL;
-						break;
-
-					}
-				}
-			}//end general timer
-
 		}//end 250mS tick event
 
 		/*INA219 current monitoring code block, samples at 10mS intervals.  The device is set to average
@@ -2738,12 +2697,17 @@ int8_t DCCcore(void) {
 			}			   
 		}   //end of power trip monitoring
 	
+#ifdef _DCCWEB_h
+		//2026-10-19 sample for the binary telemetry stream, if any browser has asked for it
+		nsDCCweb::telemetrySample();
+#endif
 
-	}//end msTickFlag, 10mS
+
+}
 
 
-	//Code below is run on every call to DCCcore.
-	//call the dcc packet engine
+/*the dcc packet engine, and the 1mS ACK sampling in service mode.  The scheduler serves this ahead of every task*/
+void dccPump(void) {
 	dccPacketEngine();
 
 	//If using the ESP AD converter, sample AD every 1mS when in DCC Service Mode
@@ -2765,10 +2729,7 @@ int8_t DCCcore(void) {
 	}
 	//m.cv reverts to CV_IDLE when done
 #endif
-
-	return r;
-
-}//end function
+}
 
 //sets INA current monitoring in average mode or trigger mode (for ACK pulse in service mode)
 void ina219Mode(boolean Avg) {
@@ -2817,12 +2778,79 @@ void ina219Mode(boolean Avg) {
 
 
 
+/*2026-10-19 timer event driven machine state, previously run as the general timer counted down to zero
+on the 250mS tick*/
+void generalTimerExpired(void *arg) {
+	switch (m_machineSE) {
+	case M_BOOT:
+		//enable track power, then measure quiescent current
+		trace(Serial.println(F("enable power"));)
+		power.trackPower = !m_bootPowerOff;
+		//assume quiescent power is say 250mA,this gets adjusted downward as the unit sees
+		//real readings come in
+		power.quiescent_mA = 250;
+		//2021-10-22 clear bus_volts
+		power.bus_volts = 0; 
+		
+		///2020-10-07 we boot in M_UNI_RUN
+		m_machineSE = M_UNI_RUN;
+		m_stateLED = L_NORMAL;
+		updateUNIdisplay();
+		
+		//2020-06-14 if user pressed mode during boot or estop, then boot in limited current mode.
+		//this is handled above in the key routines
+		break;
+							   
+	case M_ESTOP:
+		m_machineSE = M_UNI_RUN;
+		//2020-01-26 return to processing loco packets
+		dccSE = DCC_LOCO;
+
+		//no break, run on into block below
+	case M_UNI_RUN:
+	case M_UNI_SET:
+		updateUNIdisplay();
+		//force display to refresh with current reading every 1.5 second
+		setGeneralTimer(6);
+		m_stateLED = L_NORMAL;
+		break;
+
+	}
+}
+
+//time is in quarter seconds. restarting a pending timer replaces its deadline
+void setGeneralTimer(uint8_t quarterSecs) {
+	nsTimerWheel::start(m_generalTimer, quarterSecs * QUARTER_SEC_MS, &generalTimerExpired, nullptr);
+}
+
+/*mark a loco as in eStop. A non-zero eStopTimer blocks speed changes and has the packet engine send eStop
+packets until the timer wheel clears it LOCO_ESTOP_TIMEOUT quarter seconds later*/
+void startEstop(int8_t slot) {
+	if (slot < 0 || slot >= MAX_LOCO) return;
+	loco[slot].eStopTimer = LOCO_ESTOP_TIMEOUT;
+	nsTimerWheel::start(m_eStopTimer[slot], LOCO_ESTOP_TIMEOUT * QUARTER_SEC_MS, &eStopExpired, &loco[slot]);
+}
+
+void eStopExpired(void *arg) {
+	((LOCO*)arg)->eStopTimer = 0;
+}
+
+//repaint the cv and POM displays when their timeouts expire
+void cvTimerExpired(void *arg) {
+	updateCvDisplay();
+}
+
+void pomTimerExpired(void *arg) {
+	updatePOMdisplay();
+}
+
 /*update local machine display in response to JRMI instructions over JSON or WiThrottle
 or from the local hardware interface
 2020-05-03 will also clear the change flags and
 2020-05-18 will first transmit turnout-commands to line
 2021-01-27 will clear broadcast roster flags*/
 void updateLocalMachine(void) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_CORE);
 
 	bool doUpdate = false;
 	for (auto &loc : loco) {
@@ -2873,6 +2901,235 @@ void updateLocalMachine(void) {
 
 
 
+/*single implementation of track power on/off, previously duplicated in WiThrottle and DCCweb.
+2021-10-27 power-on also zeros all loco speeds in anticipation of power being restored*/
+void setPower(bool powerOn) {
+	power.trip = false;
+	power.trackPower = powerOn;
+	if (powerOn) {
+		for (auto &loc : loco) {
+			loc.speed = 0;
+			loc.speedStep = 0;
+			loc.changeFlag = true;
+		}
+	}
+#ifdef _WITHROTTLE_h
+	nsWiThrottle::broadcastPower();
+#endif
+#ifdef _DCCWEB_h
+	nsDCCweb::broadcastPower();
+#endif
+}
+
+
+/*apply one command taken from the bus. This is the only place that front-end commands modify
+loco[], turnout[], power or dccSE*/
+void applyBusCommand(nsDCCbus::BUSCOMMAND &c) {
+	using namespace nsDCCbus;
+	LOCO *loc = nullptr;
+
+	switch (c.type) {
+	case BUS_LOCO_SPEED:
+	case BUS_LOCO_STEP:
+	case BUS_LOCO_DIR:
+	case BUS_LOCO_FUNCTION:
+	case BUS_LOCO_ESTOP:
+		if (c.slot < 0 || c.slot >= MAX_LOCO) return;
+		loc = &loco[c.slot];
+		//discard if the slot was reassigned after the command was posted
+		if (loc->address == 0 || loc->address != c.address) return;
+		if (loc->useLongAddress != ((c.flags & BUSF_LONG) != 0)) return;
+		break;
+	}
+
+	switch (c.type) {
+	case BUS_LOCO_SPEED:
+		/*it seems WiThrottle works with 126 speed steps natively
+		2020-05-27 max speed is display code 28 for 28 step locos
+		2026-10-19 a repeat of the current speed is not a change, no echo and no history bump.  Compared as 126 steps,
+		the float speed is not exactly c.value / 126.0 for most values*/
+		if (uint8_t(126 * loc->speed + 0.5) == c.value) break;
+		loc->speed = c.value / 126.0;
+		loc->speedStep = loc->use128 ? c.value : 28 * loc->speed;
+		loc->changeFlag = true;
+		incrLocoHistory(loc);
+		break;
+
+	case BUS_LOCO_STEP:
+	{//scope block
+		//estop condition is blocking, meaning no changes to speed
+		if (loc->eStopTimer != 0) break;
+		//2020-10-10 follow the step unless shunter is -1 in which case invert
+		int16_t delta = loc->shunterMode == -1 ? -c.value : c.value;
+		int16_t step = loc->speedStep + delta;
+		int16_t maxStep = loc->use128 ? 126 : 28;
+		if (step < 0) step = 0;
+		if (step > maxStep) step = maxStep;
+		loc->speedStep = step;
+
+		//2020-10-10 if have hit zero, and we are in shunter mode, flip the direction and
+		//the shuntermode flag
+		if ((loc->shunterMode != 0) && (loc->speedStep == 0)) {
+			loc->forward = !loc->forward;
+			loc->shunterMode = loc->shunterMode == 1 ? -1 : 1;
+			loc->directionFlag = true;
+		}
+
+		/*recalc the float speed value. C++ will give an int result for an integer divisor, hence need to express divisor
+		 as a double to force floating point math*/
+		loc->speed = loc->speedStep / (loc->use128 ? 126.0 : 28.0);
+		loc->changeFlag = true;
+		incrLocoHistory(loc);
+	}//end scope block
+		break;
+
+	case BUS_LOCO_DIR:
+		if (c.value == 2) {
+			if (loc->eStopTimer != 0) break;
+			if (loc->speed == 0) {
+				/*if loco is stationary, reverse direction*/
+				loc->forward = !loc->forward;
+				loc->directionFlag = true;
+			}
+			else {
+				/*else give it a nudge*/
+				loc->nudge = 1;
+			}
+		}
+		else if (loc->forward != (c.value == 1)) {
+			loc->forward = (c.value == 1);
+			loc->directionFlag = true;
+		}
+		loc->changeFlag = true;
+		incrLocoHistory(loc);
+		break;
+
+	case BUS_LOCO_FUNCTION:
+		/*loco[].function is 32 bit mapped functions, F0-F28*/
+		if (c.value < 0 || c.value > 28) break;
+		loc->function ^= (1UL << c.value);
+		loc->functionFlag = true;
+		incrLocoHistory(loc);
+		break;
+
+	case BUS_LOCO_ESTOP:
+		loc->speed = 0;
+		loc->speedStep = 0;
+		//note a non-zero eStopTimer lets the dcc packet engine know to transmit an estop message
+		startEstop(c.slot);
+		loc->changeFlag = true;
+		break;
+
+	case BUS_STOP_ALL:
+		//2021-01-29 all speeds go to zero and power is not shut off
+		for (auto &L : loco) {
+			L.speed = 0;
+			L.speedStep = 0;
+			L.changeFlag = true;
+		}
+		break;
+
+	case BUS_ESTOP_ALL:
+		//packet engine will broadcast an estop, zero all individual locos and restore any trip
+		dccSE = DCC_ESTOP;
+		break;
+
+	case BUS_TURNOUT:
+	{//scope block
+		int8_t i = c.slot;
+		//find matching turnout or assign one, if sender did not know the slot
+		if (i < 0 || i >= MAX_TURNOUT || turnout[i].address != c.address) {
+			//accessory addresses are 1-2047, anything else would claim a slot for a turnout that cannot exist
+			if (c.address == 0 || c.address > 2047) {
+				trace(Serial.printf("turnout address %d rejected\n", c.address);)
+				break;
+			}
+			i = findTurnout(c.address);
+		}
+		if (i < 0 || i >= MAX_TURNOUT) break;
+		switch (c.value) {
+		case 0:
+			turnout[i].thrown = false;
+			break;
+		case 1:
+			turnout[i].thrown = true;
+			break;
+		default:
+			turnout[i].thrown = !turnout[i].thrown;
+		}
+		/*2020-05-18 set a flag, updateLocalMachine will queue the transmission*/
+		turnout[i].changeFlag = true;
+		//state is part of the serialized turnout roster. no roster flag, the change is broadcast as a state change
+		++turnoutRosterGen;
+		trace(Serial.printf("turnout slot %d state %d\n", i, turnout[i].thrown);)
+	}//end scope block
+		break;
+
+	case BUS_POWER:
+		setPower(c.value != 0);
+		break;
+
+	case BUS_POM:
+		m_pom.addr = c.address;
+		m_pom.useLongAddr = (c.flags & BUSF_LONG) != 0;
+		m_pom.useAccessoryAddr = (c.flags & BUSF_ACCESSORY) != 0;
+		//POM processing code remaps 1 to 0 on the line.
+		m_pom.cvReg = c.cv;
+		if (c.flags & BUSF_BIT) {
+			m_pom.cvBit = c.data;
+			m_pom.state = POM_BIT_WRITE;
+		}
+		else {
+			m_pom.cvData = c.data;
+			m_pom.state = POM_BYTE_WRITE;
+		}
+		//initiate write sequence
+		dccSE = DCC_POM;
+		//only the local display shows the POM timeout, don't update it for a remote operation
+		if (c.source == BUS_LOCAL) nsTimerWheel::start(m_pomTimer, 8 * QUARTER_SEC_MS, &pomTimerExpired, nullptr);
+		break;
+
+	case BUS_SERVICE:
+		switch (c.value) {
+		case SVC_ENTER:
+			writeServiceCommand(0, 0, false, true, false);
+			break;
+		case SVC_EXIT:
+			writeServiceCommand(0, 0, false, false, true);
+			break;
+		case SVC_DIRECT:
+			writeServiceCommand(c.cv, c.data, false, false, false);
+			break;
+		case SVC_PAGED:
+			if (c.cv == 0 || c.cv > 1024) break;
+			m_cv.cvReg = c.cv;
+			m_cv.pgPage = (c.cv - 1) / 4 + 1;
+			m_cv.pgReg = (c.cv - 1) % 4;
+			m_cv.cvData = c.data;
+			dccSE = DCC_SERVICE;
+			nsTimerWheel::start(m_cvTimer, 8 * QUARTER_SEC_MS, &cvTimerExpired, nullptr);  //2 sec
+			m_cv.state = PG_START;
+			break;
+		case SVC_READ:
+			if (writeServiceCommand(c.cv, 0, true, false, false)) dccSE = DCC_SERVICE;
+			break;
+		}
+		break;
+	}
+
+	//local UI changes are replicated across a WiThrottle consist, and the jogwheel follows the loco being driven
+	if ((loc != nullptr) && (c.source == BUS_LOCAL)) {
+		if (loc->changeFlag && !loc->jog) {
+			for (auto &L : loco) {
+				L.jog = false;
+			}
+			loc->jog = true;
+		}
+		replicateAcrossConsist(c.slot);
+	}
+}
+
+
 /*2019-10-10 modify speed of loco using the jogwheel*/
 /*2019-10-15 also want to apply brake if pushbutton is pressed*/
 /*2020-06-25 and reverse direction on stationary if jog button held*/
@@ -2907,58 +3164,22 @@ int8_t setLocoFromJog(nsJogWheel::JOGWHEEL &j) {
 
 
 	if (j.jogEvent) {
-		//2020-10-10 follow jogCW unless shunter is -1 and in which case invert
-		if (loco[i].shunterMode == -1) {j.jogCW = !j.jogCW;}
-
-		if (j.jogCW) {
-			/*increment speed for clockwise rotation*/
-			if (loco[i].use128) {
-				if (j.jogHiSpeed) {
-					loco[i].speedStep += 5;
-					if (loco[i].speedStep > 126) loco[i].speedStep = 126;
-				}
-				else {
-					loco[i].speedStep += (loco[i].speedStep < 126) ? 1 : 0;
-				}
-			}
-			else {
-				loco[i].speedStep += (loco[i].speedStep < 28) ? 1 : 0;
-			}
-		}
-		else {
-			/*decrement speed on counter clockwise*/
-			loco[i].speedStep -= (loco[i].speedStep > 0) ? 1 : 0;
-			if (loco[i].use128 && j.jogHiSpeed) {
-				loco[i].speedStep -= (loco[i].speedStep > 5) ? 5 : 0;
-			}
-
+		/*increment speed for clockwise rotation, decrement on counter clockwise. 128 step locos move 5 steps
+		at a time if the jog is rotated quickly.
+		2026-10-19 the step is posted to the command bus, which handles shunter mode (inverting the sense if
+		shunter is -1 and flipping direction as we hit zero) and the speed limits*/
+		int8_t delta = 1;
+		if (loco[i].use128 && j.jogHiSpeed) {
+			delta = j.jogCW ? 5 : 6;
 		}
-
-		//2020-10-10 if have hit zero, and we are in shunter mode, flip the direction and
-		//the shuntermode flag
-
-		if ((loco[i].shunterMode !=0)&&(loco[i].speedStep==0)) { 
-			loco[i].forward = !loco[i].forward;
-			loco[i].shunterMode = loco[i].shunterMode == 1 ? -1 : 1;
-		}
-			   
-		/*recalc the float speed value. C++ will give an int result for an integer divisor, hence need to express divisor
-		 as a double to force floating point math*/
-		if (loco[i].use128) {
-			loco[i].speed = loco[i].speedStep / 126.0;
-		}
-		else {
-			loco[i].speed = loco[i].speedStep / 28.0;
-		}
-		
+		nsDCCbus::locoStep(i, j.jogCW ? delta : -delta, nsDCCbus::BUS_LOCAL);
 		j.jogEvent = false;
 	}
 
 	//2020-06-15 reverse direction if button held and we are at rest
 	if (j.jogButtonEvent) {
 		if (j.jogHeld && (loco[i].speed == 0)) {
-			loco[i].forward = !loco[i].forward;
-			loco[i].directionFlag = true;
+			nsDCCbus::locoDirection(i, 2, nsDCCbus::BUS_LOCAL);
 		}
 		j.jogButtonEvent = false;
 	}
@@ -3009,49 +3230,6 @@ void replicateAcrossConsist(int8_t slot) {
 
 
 
-//external calls for POM  cv, val
-//returns true if POM initiated
-//the cv register value passed is +1 compared to actual value, e.g. reg 23 passed is 22 in the memory space
-//val is B23 S0 C2 where the instruction is byte, set, clear for bits
-bool writePOMcommand(const char *addr, uint16_t cv, const char *val) {
-		
-	if (addr == nullptr) return false;
-	if (val == nullptr) return false;
-
-	m_pom.useLongAddr = addr[0] == 'L' ? true : false;
-	m_pom.addr = atoi(addr + 1);
-	if (m_pom.addr == 0) return false;
-
-
-	if (cv == 0 || cv > 1024) return false;
-	//POM processing code remaps 1 to 0 on the line.
-	m_pom.cvReg = cv;
-	
-	switch (val[0]){
-	case 'B':
-		m_pom.cvData = atoi(val + 1);
-		m_pom.state = POM_BYTE_WRITE;
-		break;
-
-	case 'S':
-	case 'C':
-		//bit write. cvBit <2-0> represent the bit posn, <7> represents set or clear
-		//the val string will be b21 where b<7-0><1|0>
-		m_pom.cvBit = (val[1] - '0') & 0b111;
-		m_pom.cvBit += val[0] == 'S' ? 0b10000000 : 0;
-		m_pom.state = POM_BIT_WRITE;
-
-	}
-	//initiate write sequence
-	dccSE = DCC_POM;  
-	//we do not set m_pom.timeout as we don't want to update local display for this remote operation
-	//m_pom.timeout = 8;
-	return true;
-
-}
-
-
-
 /*set flags to enter/exit service mode. set cv and val to perform a DIRECT byte write
 or set bool to verify, routine returns false whilst read is pending, true when finished and
 result is in val or, if read fails val==nullptr*/
@@ -3107,7 +3285,7 @@ bool writeServiceCommand(uint16_t cvReg, uint8_t cvVal, bool verify, bool enterS
 		m_cv.cvData = cvVal;
 		if (m_cv.cvData < 0) { return false; }
 		dccSE = DCC_SERVICE;
-		m_cv.timeout = 8;  //2 sec
+		nsTimerWheel::start(m_cvTimer, 8 * QUARTER_SEC_MS, &cvTimerExpired, nullptr);  //2 sec
 		m_cv.state = D_START;
 		return true;
 		//after processing the machine reverts to m_cv.state=CV_IDLE
@@ -3122,7 +3300,7 @@ bool writeServiceCommand(uint16_t cvReg, uint8_t cvVal, bool verify, bool enterS
 		//free to read?
 		if (m_cv.state != CV_IDLE) return false;
 			//initate a read
-		m_cv.timeout = 8;  //2 sec
+		nsTimerWheel::start(m_cvTimer, 8 * QUARTER_SEC_MS, &cvTimerExpired, nullptr);  //2 sec
 		//set up entry conditions, including capturing the bus current
 		power.ackBase_mA = power.bus_mA;
 		power.bus_peak_mA = power.ackBase_mA;
@@ -3238,12 +3416,11 @@ LOCO * getNextLoco(LOCO *loc) {
 	
 	//if the slot address is zero, means all slots must be zero so create loco S3
 	if (loc->address == 0) {
-		loc->address = 3;
 		loc->use128 = false;
-		loc->useLongAddress = false;
+		//2026-10-19 from the roster if it has S3
+		nsLocoRoster::page(thisLoco, 3, false);
 		loc->forward = true;
 		loc->history = 0;
-		memset(loc->name, '\0', sizeof(loc->name));
 		bootController.isDirty = true;
 		dccPutSettings();
 	}
@@ -3253,6 +3430,18 @@ LOCO * getNextLoco(LOCO *loc) {
 }
 
 
+/*2026-10-19 record an edit to the loco roster.  Bumps the generation so serialized copies are rebuilt,
+and raises flagLocoRoster so the new roster is broadcast*/
+void locoRosterChanged(void) {
+	++locoRosterGen;
+	bootController.flagLocoRoster = true;
+}
+
+void turnoutRosterChanged(void) {
+	++turnoutRosterGen;
+	bootController.flagTurnoutRoster = true;
+}
+
 //increase the history of this loc in the loco[] array
 //2020-09-01
 void incrLocoHistory(LOCO *loc) {
@@ -14,14 +14,14 @@
 
 #include "Keypad.h"
 #include "JogWheel.h"
-#include <EEPROM.h>
+#include "DCCbus.h"
 
 
 /*version control and capture of some system defaults for new compilations*/
 /*note, code at present does not support logging onto a network as a station*/
 struct CONTROLLER
 {
-	long	softwareVersion = 20240426;  //yyyymmdd captured as an integer
+	long	softwareVersion = 20261019;  //yyyymmdd captured as an integer
 	uint16_t	currentLimit = 1000;
 	uint8_t	voltageLimit = 15;
 	char SSID[21] = "DCC_ESP";
@@ -31,10 +31,11 @@ struct CONTROLLER
 	char STA_pwd[21] = "";			//pwd for station
 	uint16_t wsPort = 12080;        //websocket port
 	uint16_t tcpPort = 12090;       //tcp port
-	bool isDirty = false;  //will be true if EEPROM needs to be written
+	bool isDirty = false;  //will be true if settings need to be written, see dccPutSettings
 	bool flagLocoRoster;
 	bool flagTurnoutRoster;
 	bool bootAsAP =false;
+	bool resumeMoving = false;  //2026-10-19 after a warm reset restore locos at speed rather than stopped, see RtcSnapshot.cpp
 };
 
 //note for testing
@@ -72,7 +73,7 @@ struct LOCO
 	char		name[9];
 	float       speed = 0;  //a percentile value
 	bool        forward = true;
-	uint16_t    function = 0;
+	uint32_t    function = 0;  //2026-10-19 F0-F28, was 16 bit
 	uint8_t     speedStep; //percentile converted to the actual speed step instruction
 	uint8_t     eStopTimer = 0;
 	bool        use128 = false;  //use 128 speed steps
@@ -116,7 +117,6 @@ struct POM {
 	uint8_t	 cvBit = 0; //<7> is the bit value, <0-2> the bit pos
 	uint8_t digitPos;
 	uint8_t	state = POM_BYTE;
-	uint8_t timeout = 0;
 	uint8_t packetCount;
 } static m_pom;
 
@@ -147,7 +147,6 @@ struct CV {
 	bool write;
 	int cvReg = 1;
 	int cvData;
-	int8_t timeout;
 	//bool ackFlag;
 	int pgPage;
 	int8_t pgReg;
@@ -192,22 +191,28 @@ extern CONTROLLER bootController;
 extern ACCESSORY accessory;
 extern dccSTATE dccSE;
 
+/*2026-10-19 roster generations, bumped on every edit to the loco or turnout roster.  A module holding a
+serialized copy of a roster compares generations to know when to rebuild it*/
+extern uint16_t locoRosterGen;
+extern uint16_t turnoutRosterGen;
+
 /*the above 3 structs are defined in this header, whereas KEYPAD and JOGWHEEL are declared elsewhere*/
 
 
-extern bool  quarterSecFlag; //public flag for use in main loop
 
 /*list of functions */
 
 //core processing
 void DCCcoreBoot();
-int8_t DCCcore(void);
+void dccTick(void);
+void dccPump(void);
 void dccPacketEngine(void);
 void updateLocalMachine(void);
 void dccGetSettings();
 void replicateAcrossConsist(int8_t slot);
 void dccPutSettings();
-bool writePOMcommand(const char *addr, uint16_t cv, const char *val);
+void dccFlushSettings();
+bool dccEstopActive(void);
 bool writeServiceCommand(uint16_t cvReg, uint8_t cvVal, bool verify, bool enterSM, bool exitSM);
 float getVolt();  //debug
 
@@ -231,17 +236,37 @@ static void updateTurnoutDisplay(void);
 static void updateCvDisplay(void);
 static void updateUNIdisplay();
 
+//command bus
+static void applyBusCommand(nsDCCbus::BUSCOMMAND &c);
+
+//timer wheel callbacks and helpers
+static void setGeneralTimer(uint8_t quarterSecs);
+static void generalTimerExpired(void *arg);
+static void startEstop(int8_t slot);
+static void eStopExpired(void *arg);
+static void cvTimerExpired(void *arg);
+static void pomTimerExpired(void *arg);
+
 //jogwheel related
 static int8_t setLocoFromJog(nsJogWheel::JOGWHEEL &j);
 
+//packet engine
+static uint8_t speedPacket(LOCO &loc, volatile uint8_t *data);
+static void dccPrefill();
+static bool dccCompactDue();
+
 //system or hardware
 static void ina219Mode(boolean Avg);
+static void setPower(bool powerOn);
 static int8_t setLoco(LOCO *loc, int8_t speed, bool dir);
+static int8_t locoSlot(LOCO *loc);
 
 int8_t findLoco(char *address, char *slotAddress, bool ignoreEmpty = false);
 int8_t findTurnout(uint16_t turnoutAddress);
 static LOCO *getNextLoco(LOCO *loc);
 void incrLocoHistory(LOCO *loc);
+void locoRosterChanged(void);
+void turnoutRosterChanged(void);
 
 /*end list of functions */
 
@@ -86,6 +86,9 @@ Note: using non PWM compat mode, the timebase is 200nS.
 
 	volatile DCCBUFFER DCCpacket;  //externally visible
 	volatile DCCBUFFER _TXbuffer;   //internal to this module
+	volatile DCCBUFFER DCCfill[DCC_FILL];
+	volatile uint8_t DCCfillNext = 0;
+	volatile uint8_t DCCfillCount = 0;
 
 	
 	static uint16_t dcc_mask = 0;
@@ -114,6 +117,8 @@ Note: using non PWM compat mode, the timebase is 200nS.
 	  Once preamble is transmitted, the handler will copy the DCCpacket to the transmit buffer and set the DCCclearToSend flag indicating it is able to accept
 	  a new packet.  If the DDCpacket is not modified by the main loop, this layer 1 handler will continuously transmit the same packet to line.  This is useful
 	  as it allows an idle to be continuously transmitted when we are in Service Mode for example.
+	  2026-10-19 whilst DCCfillCount is non zero, the next queued DCCfill packet is copied instead and clearToSend
+	  is left clear, so DCCpacket waits its turn.  This keeps the refresh going while a flash write stalls the main loop.
 	*/
 
 
@@ -171,17 +176,33 @@ Note: using non PWM compat mode, the timebase is 200nS.
 				DCCpacket may be written 
 				2019-12-05 increased to 6 packet buffer with copy-over*/
 				
-				_TXbuffer.data[0] = DCCpacket.data[0];
-				_TXbuffer.data[1] = DCCpacket.data[1];
-				_TXbuffer.data[2] = DCCpacket.data[2];
-				_TXbuffer.data[3] = DCCpacket.data[3];
-				_TXbuffer.data[4] = DCCpacket.data[4];
-				_TXbuffer.data[5] = DCCpacket.data[5];
-				_TXbuffer.packetLen = DCCpacket.packetLen;
-				_TXbuffer.longPreamble = DCCpacket.longPreamble;
+				if (DCCfillCount > 0) {
+					volatile DCCBUFFER &f = DCCfill[DCCfillNext];
+					_TXbuffer.data[0] = f.data[0];
+					_TXbuffer.data[1] = f.data[1];
+					_TXbuffer.data[2] = f.data[2];
+					_TXbuffer.data[3] = f.data[3];
+					_TXbuffer.data[4] = f.data[4];
+					_TXbuffer.data[5] = f.data[5];
+					_TXbuffer.packetLen = f.packetLen;
+					_TXbuffer.longPreamble = f.longPreamble;
+					DCCfillNext++;
+					DCCfillCount--;
+					TXbyteCount = 0;
+				}
+				else {
+					_TXbuffer.data[0] = DCCpacket.data[0];
+					_TXbuffer.data[1] = DCCpacket.data[1];
+					_TXbuffer.data[2] = DCCpacket.data[2];
+					_TXbuffer.data[3] = DCCpacket.data[3];
+					_TXbuffer.data[4] = DCCpacket.data[4];
+					_TXbuffer.data[5] = DCCpacket.data[5];
+					_TXbuffer.packetLen = DCCpacket.packetLen;
+					_TXbuffer.longPreamble = DCCpacket.longPreamble;
 				
-				TXbyteCount = 0;
-				DCCpacket.clearToSend = true;
+					TXbyteCount = 0;
+					DCCpacket.clearToSend = true;
+				}
 			}
 			if (TXbitCount <= 8) {
 				if (TXbitCount == 8)
@@ -31,6 +31,13 @@
 
 	extern volatile DCCBUFFER DCCpacket;
 
+	/*2026-10-19 packets sent ahead of DCCpacket, see dcc_intr_handler.  The main loop writes DCCfill and
+	DCCfillNext only while DCCfillCount is zero, and sets DCCfillCount last.  Setting it to zero discards the rest*/
+#define DCC_FILL	16    //around 100mS of packets
+	extern volatile DCCBUFFER DCCfill[DCC_FILL];
+	extern volatile uint8_t DCCfillNext;
+	extern volatile uint8_t DCCfillCount;
+
 	void ICACHE_FLASH_ATTR dcc_init(uint32_t pin_pwm, uint32_t pin_enable, bool phase, bool invert);
 
 	void ICACHE_FLASH_ATTR dc_init(uint32_t pin_pwm, uint32_t pin_dir, bool phase, bool invert);
@@ -0,0 +1,383 @@
+//
+//
+//
+
+#include "DCCstore.h"
+#include "DCCcore.h"
+#include "DCClayer1.h"
+#include <EEPROM.h>   //legacy settings, imported once
+
+/*
+2026-10-19 settings store.  Previously dccPutSettings wrote bootController and the whole of loco[] and turnout[],
+runtime fields included, into the EEPROM emulation and committed the full sector for any one change, and
+dccGetSettings wiped everything to factory defaults whenever softwareVersion changed.
+
+Now each persistent item is a record appended to STORE_FILE: the controller settings, and one record per loco
+and per turnout slot holding only the fields that survive a reboot.  save() appends just the records whose
+content has changed since they were last written, found by comparing a CRC of each encoded record with the
+CRC of what was last stored.  Each record carries a header with a CRC, so boot is one sequential read of the
+log, later records replacing earlier ones.  A damaged record, e.g. power lost mid write, ends the scan and the
+log is then rewritten from what was read.  When the log reaches STORE_COMPACT it is rewritten with just the
+live records to a temporary file which is renamed over the log, so a reset during compaction leaves the old
+log intact.  LittleFS is copy on write and spreads these writes across the partition.
+2026-10-19 a compaction writes every record and can stall for far longer than an append, so it is not done with
+track power on.  It waits for boot or for a save with power off, as the loco roster does, and the log grows past
+STORE_COMPACT until then.
+
+Schema.  Fields may be added to the end of a record without a schema change, an older shorter record loads
+with the defaults for the missing fields.  Any other layout change bumps STORE_SCHEMA and adds a case to
+apply() to convert the older layout.  Records from newer firmware are skipped.  softwareVersion is no longer
+used to decide whether to keep the settings.
+
+On first boot with this firmware, the EEPROM image written by firmware EE_LEGACY_VERSION is imported.  It is
+read through frozen copies of that firmware's structs, EECONTROLLER, EELOCO and EETURNOUT, and converted a
+field at a time, since CONTROLLER and LOCO have since changed.  If there is no such image, factory defaults are
+used.  Either way the log is then written in full.
+
+2026-10-19 write back.  A flash erase stalls the main loop for tens of milliseconds, during which layer 1 can
+only repeat whatever packet it last held.  Callers no longer write directly, dccPutSettings calls defer() and
+the write happens from DCCcore once no change has been made for STORE_QUIET_MS, or STORE_DEFER_MS after the
+first unwritten change, and only while the packet engine is running loco and function packets.  A burst of
+keypad or web edits is then one append.  Before save() DCCcore queues refresh packets on layer 1 to cover the
+stall.  Each write is timed, and counted as an underrun if the queued packets ran out before it finished.
+*/
+
+using namespace nsDCCstore;
+
+static STORESTATS m_stats;
+
+//the legacy image was 532 bytes with 8 locos and 8 turnouts.  A mismatch means the frozen structs are wrong
+static_assert(sizeof(EECONTROLLER) == 116 && sizeof(EELOCO) == 36 && sizeof(EETURNOUT) == 16, "legacy EEPROM layout");
+/*CRC of each record as last written, or as loaded*/
+static uint32_t m_ctrlCrc = 0;
+static uint32_t m_locoCrc[MAX_LOCO];
+static uint32_t m_turnoutCrc[MAX_TURNOUT];
+static bool m_pending = false;
+static uint32_t m_firstChange;		//millis of the oldest unwritten change
+static uint32_t m_lastChange;
+
+
+/*standard CRC-32, reflected, polynomial 0xEDB88320.  Pass 0 to start*/
+uint32_t nsDCCstore::crc32(uint32_t crc, const uint8_t *data, size_t len) {
+	crc = ~crc;
+	while (len--) {
+		crc ^= *data++;
+		for (uint8_t b = 0; b < 8; ++b) {
+			crc = (crc >> 1) ^ (0xEDB88320UL & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+/*records are zeroed before encoding so the CRC does not depend on padding or bytes after a string's null*/
+void nsDCCstore::encodeController(STORECONTROLLER &r) {
+	memset(&r, 0, sizeof(r));
+	r.currentLimit = bootController.currentLimit;
+	r.voltageLimit = bootController.voltageLimit;
+	r.bootAsAP = bootController.bootAsAP ? 1 : 0;
+	strncpy(r.SSID, bootController.SSID, sizeof(r.SSID) - 1);
+	strncpy(r.pwd, bootController.pwd, sizeof(r.pwd) - 1);
+	strncpy(r.IP, bootController.IP, sizeof(r.IP) - 1);
+	strncpy(r.STA_SSID, bootController.STA_SSID, sizeof(r.STA_SSID) - 1);
+	strncpy(r.STA_pwd, bootController.STA_pwd, sizeof(r.STA_pwd) - 1);
+	r.wsPort = bootController.wsPort;
+	r.tcpPort = bootController.tcpPort;
+	r.resumeMoving = bootController.resumeMoving ? 1 : 0;
+}
+
+void nsDCCstore::encodeLoco(uint8_t slot, STORELOCO &r) {
+	memset(&r, 0, sizeof(r));
+	LOCO &loc = loco[slot];
+	r.address = loc.address;
+	r.flags = (loc.use128 ? STORE_USE128 : 0) | (loc.useLongAddress ? STORE_LONG : 0);
+	strncpy(r.name, loc.name, sizeof(r.name) - 1);
+}
+
+void nsDCCstore::encodeTurnout(uint8_t slot, STORETURNOUT &r) {
+	memset(&r, 0, sizeof(r));
+	TURNOUT &t = turnout[slot];
+	r.address = t.address;
+	strncpy(r.name, t.name, sizeof(r.name) - 1);
+}
+
+/*apply one record read from the log.  The record starts from the current values, so fields missing from a
+shorter, older record keep them.  false if the record was not used*/
+bool nsDCCstore::apply(const STOREHDR &h, const uint8_t *payload) {
+	if (h.schema > STORE_SCHEMA) return false;
+	//schema 1 is the only layout so far.  A later schema converts older records here, by h.schema
+
+	switch (h.type) {
+	case REC_CONTROLLER: {
+		STORECONTROLLER r;
+		encodeController(r);
+		memcpy(&r, payload, h.len < sizeof(r) ? h.len : sizeof(r));
+		bootController.currentLimit = r.currentLimit;
+		bootController.voltageLimit = r.voltageLimit;
+		bootController.bootAsAP = r.bootAsAP != 0;
+		strncpy(bootController.SSID, r.SSID, sizeof(bootController.SSID) - 1);
+		strncpy(bootController.pwd, r.pwd, sizeof(bootController.pwd) - 1);
+		strncpy(bootController.IP, r.IP, sizeof(bootController.IP) - 1);
+		strncpy(bootController.STA_SSID, r.STA_SSID, sizeof(bootController.STA_SSID) - 1);
+		strncpy(bootController.STA_pwd, r.STA_pwd, sizeof(bootController.STA_pwd) - 1);
+		bootController.wsPort = r.wsPort;
+		bootController.tcpPort = r.tcpPort;
+		bootController.resumeMoving = r.resumeMoving != 0;
+		return true;
+	}
+	case REC_LOCO: {
+		//slots beyond MAX_LOCO are from a build with a larger roster
+		if (h.index >= MAX_LOCO) return false;
+		STORELOCO r;
+		encodeLoco(h.index, r);
+		memcpy(&r, payload, h.len < sizeof(r) ? h.len : sizeof(r));
+		LOCO &loc = loco[h.index];
+		loc.address = r.address;
+		loc.use128 = (r.flags & STORE_USE128) != 0;
+		loc.useLongAddress = (r.flags & STORE_LONG) != 0;
+		memcpy(loc.name, r.name, sizeof(loc.name));
+		loc.name[sizeof(loc.name) - 1] = '\0';
+		return true;
+	}
+	case REC_TURNOUT: {
+		if (h.index >= MAX_TURNOUT) return false;
+		STORETURNOUT r;
+		encodeTurnout(h.index, r);
+		memcpy(&r, payload, h.len < sizeof(r) ? h.len : sizeof(r));
+		TURNOUT &t = turnout[h.index];
+		t.address = r.address;
+		memcpy(t.name, r.name, sizeof(t.name));
+		t.name[sizeof(t.name) - 1] = '\0';
+		return true;
+	}
+	}
+	return false;
+}
+
+bool nsDCCstore::append(File &f, uint8_t type, uint8_t index, const void *payload, uint16_t len) {
+	STOREHDR h;
+	h.magic = STORE_MAGIC;
+	h.type = type;
+	h.index = index;
+	h.schema = STORE_SCHEMA;
+	h.len = len;
+	h.spare = 0;
+	h.crc = 0;
+	h.crc = crc32(crc32(0, (const uint8_t*)&h, sizeof(h)), (const uint8_t*)payload, len);
+	if (f.write((const uint8_t*)&h, sizeof(h)) != sizeof(h)) return false;
+	if (f.write((const uint8_t*)payload, len) != len) return false;
+	++m_stats.appends;
+	return true;
+}
+
+
+/*read the log into bootController, loco[] and turnout[].  false if there is no log, the caller then imports
+or applies defaults and calls compact()*/
+bool nsDCCstore::load(void) {
+	LittleFS.begin();
+	File f = LittleFS.open(STORE_FILE, "r");
+	if (!f) return false;
+
+	uint8_t buf[STORE_MAX_REC];
+	STOREHDR h;
+	size_t good = 0;
+	m_stats.loaded = 0;
+	while (f.read((uint8_t*)&h, sizeof(h)) == sizeof(h)) {
+		if (h.magic != STORE_MAGIC || h.len > STORE_MAX_REC) break;
+		if (f.read(buf, h.len) != h.len) break;
+		uint32_t crc = h.crc;
+		h.crc = 0;
+		if (crc32(crc32(0, (const uint8_t*)&h, sizeof(h)), buf, h.len) != crc) break;
+		if (apply(h, buf)) ++m_stats.loaded;
+		good = f.position();
+	}
+	size_t size = f.size();
+	f.close();
+	if (m_stats.loaded == 0) return false;
+
+	//what was loaded is what is stored, unless the tail was damaged in which case the log is rewritten
+	m_stats.size = size;
+	if (good != size) {
+		++m_stats.bad;
+		trace(Serial.printf("store damaged at %d of %d\r\n", good, size);)
+		compact();
+		return true;
+	}
+	STORECONTROLLER c;
+	encodeController(c);
+	m_ctrlCrc = crc32(0, (const uint8_t*)&c, sizeof(c));
+	for (uint8_t i = 0; i < MAX_LOCO; ++i) {
+		STORELOCO r;
+		encodeLoco(i, r);
+		m_locoCrc[i] = crc32(0, (const uint8_t*)&r, sizeof(r));
+	}
+	for (uint8_t i = 0; i < MAX_TURNOUT; ++i) {
+		STORETURNOUT r;
+		encodeTurnout(i, r);
+		m_turnoutCrc[i] = crc32(0, (const uint8_t*)&r, sizeof(r));
+	}
+	//track power is not yet on
+	if (compactDue()) compact();
+	return true;
+}
+
+/*one time import of the settings previously held in EEPROM, if they were written with the current layout*/
+bool nsDCCstore::importEEPROM(void) {
+	EECONTROLLER c;
+	EEPROM.begin(EE_LEGACY_SIZE);
+	int eeAddr = 0;
+	EEPROM.get(eeAddr, c);
+	if (c.softwareVersion != EE_LEGACY_VERSION) {
+		EEPROM.end();
+		return false;
+	}
+	eeAddr += sizeof(c);
+
+	//fields this firmware added keep their defaults
+	CONTROLLER defaultController;
+	bootController = defaultController;
+	bootController.currentLimit = c.currentLimit;
+	bootController.voltageLimit = c.voltageLimit;
+	bootController.bootAsAP = c.bootAsAP;
+	strncpy(bootController.SSID, c.SSID, sizeof(bootController.SSID) - 1);
+	strncpy(bootController.pwd, c.pwd, sizeof(bootController.pwd) - 1);
+	strncpy(bootController.IP, c.IP, sizeof(bootController.IP) - 1);
+	strncpy(bootController.STA_SSID, c.STA_SSID, sizeof(bootController.STA_SSID) - 1);
+	strncpy(bootController.STA_pwd, c.STA_pwd, sizeof(bootController.STA_pwd) - 1);
+	bootController.wsPort = c.wsPort;
+	bootController.tcpPort = c.tcpPort;
+
+	//only the fields that survive a reboot, the rest are reset by dccGetSettings
+	for (uint8_t i = 0; i < EE_LEGACY_LOCOS; ++i) {
+		EELOCO l;
+		EEPROM.get(eeAddr, l);
+		eeAddr += sizeof(l);
+		if (i >= MAX_LOCO) continue;
+		loco[i].address = l.address;
+		loco[i].use128 = l.use128;
+		loco[i].useLongAddress = l.useLongAddress;
+		strncpy(loco[i].name, l.name, sizeof(loco[i].name) - 1);
+		loco[i].name[sizeof(loco[i].name) - 1] = '\0';
+	}
+	for (uint8_t i = 0; i < EE_LEGACY_TURNOUTS; ++i) {
+		EETURNOUT t;
+		EEPROM.get(eeAddr, t);
+		eeAddr += sizeof(t);
+		if (i >= MAX_TURNOUT) continue;
+		turnout[i].address = t.address;
+		turnout[i].thrown = t.thrown;
+		strncpy(turnout[i].name, t.name, sizeof(turnout[i].name) - 1);
+		turnout[i].name[sizeof(turnout[i].name) - 1] = '\0';
+	}
+	EEPROM.end();
+	trace(Serial.println(F("store imported from EEPROM"));)
+	return true;
+}
+
+/*note a change to be written.  Call via dccPutSettings*/
+void nsDCCstore::defer(void) {
+	uint32_t now = millis();
+	if (!m_pending) m_firstChange = now;
+	m_lastChange = now;
+	m_pending = true;
+	++m_stats.deferred;
+}
+
+/*as defer, but due at the next safe point rather than after STORE_QUIET_MS, e.g. a holding list is full*/
+void nsDCCstore::hurry(void) {
+	defer();
+	m_firstChange = millis() - STORE_DEFER_MS;
+}
+
+bool nsDCCstore::pending(void) {
+	return m_pending;
+}
+
+/*true once changes have settled, or have waited long enough*/
+bool nsDCCstore::due(void) {
+	if (!m_pending) return false;
+	uint32_t now = millis();
+	return now - m_lastChange >= STORE_QUIET_MS || now - m_firstChange >= STORE_DEFER_MS;
+}
+
+/*true if the log should be rewritten at the next chance with track power off*/
+bool nsDCCstore::compactDue(void) {
+	return m_stats.size >= STORE_COMPACT;
+}
+
+/*append a record for each item that differs from what is stored.  Call via dccFlushSettings, which covers
+the stall on layer 1.  mayCompact permits a rewrite of the log, pass true only with track power off*/
+void nsDCCstore::save(bool mayCompact) {
+	uint32_t start = micros();
+	bool covered = DCCfillCount > 0;
+	m_pending = false;
+	File f = LittleFS.open(STORE_FILE, "a");
+	if (!f) return;
+
+	STORECONTROLLER c;
+	encodeController(c);
+	uint32_t crc = crc32(0, (const uint8_t*)&c, sizeof(c));
+	if (crc != m_ctrlCrc && append(f, REC_CONTROLLER, 0, &c, sizeof(c))) m_ctrlCrc = crc;
+
+	for (uint8_t i = 0; i < MAX_LOCO; ++i) {
+		STORELOCO r;
+		encodeLoco(i, r);
+		crc = crc32(0, (const uint8_t*)&r, sizeof(r));
+		if (crc != m_locoCrc[i] && append(f, REC_LOCO, i, &r, sizeof(r))) m_locoCrc[i] = crc;
+	}
+	for (uint8_t i = 0; i < MAX_TURNOUT; ++i) {
+		STORETURNOUT r;
+		encodeTurnout(i, r);
+		crc = crc32(0, (const uint8_t*)&r, sizeof(r));
+		if (crc != m_turnoutCrc[i] && append(f, REC_TURNOUT, i, &r, sizeof(r))) m_turnoutCrc[i] = crc;
+	}
+	m_stats.size = f.size();
+	f.close();
+	trace(Serial.printf("store size %d\r\n", m_stats.size);)
+	if (mayCompact && compactDue()) compact();
+
+	m_stats.write_us = micros() - start;
+	if (m_stats.write_us > m_stats.maxWrite_us) m_stats.maxWrite_us = m_stats.write_us;
+	++m_stats.writes;
+	if (covered && DCCfillCount == 0) ++m_stats.underruns;
+}
+
+/*rewrite the log with one record per item*/
+void nsDCCstore::compact(void) {
+	File f = LittleFS.open(STORE_TEMP, "w");
+	if (!f) return;
+	bool ok = true;
+
+	STORECONTROLLER c;
+	encodeController(c);
+	ok &= append(f, REC_CONTROLLER, 0, &c, sizeof(c));
+	m_ctrlCrc = crc32(0, (const uint8_t*)&c, sizeof(c));
+	for (uint8_t i = 0; i < MAX_LOCO; ++i) {
+		STORELOCO r;
+		encodeLoco(i, r);
+		ok &= append(f, REC_LOCO, i, &r, sizeof(r));
+		m_locoCrc[i] = crc32(0, (const uint8_t*)&r, sizeof(r));
+	}
+	for (uint8_t i = 0; i < MAX_TURNOUT; ++i) {
+		STORETURNOUT r;
+		encodeTurnout(i, r);
+		ok &= append(f, REC_TURNOUT, i, &r, sizeof(r));
+		m_turnoutCrc[i] = crc32(0, (const uint8_t*)&r, sizeof(r));
+	}
+	size_t size = f.size();
+	f.close();
+	//a partial temporary file must not replace a good log.  LittleFS rename replaces the old log in one step
+	if (!ok || !LittleFS.rename(STORE_TEMP, STORE_FILE)) {
+		LittleFS.remove(STORE_TEMP);
+		//nothing is known to be stored, the next save appends every record
+		m_ctrlCrc = 0;
+		memset(m_locoCrc, 0, sizeof(m_locoCrc));
+		memset(m_turnoutCrc, 0, sizeof(m_turnoutCrc));
+		return;
+	}
+	m_stats.size = size;
+	++m_stats.compactions;
+}
+
+const STORESTATS &nsDCCstore::getStats(void) {
+	return m_stats;
+}
@@ -0,0 +1,162 @@
+// DCCstore.h
+//Settings, loco and turnout rosters held as an append only record log in LittleFS, replacing the EEPROM image
+
+#ifndef _DCCSTORE_h
+#define _DCCSTORE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "Global.h"
+#include <LittleFS.h>
+
+namespace nsDCCstore {
+
+#define STORE_FILE		"/store.log"
+#define STORE_TEMP		"/store.new"
+#define STORE_MAGIC		0xA5
+#define STORE_SCHEMA	1      //bump when a record layout changes other than by adding fields at the end
+#define STORE_COMPACT	8192   //log is rewritten with only the live records once past this size, at boot or with track power off
+#define STORE_MAX_REC	128    //largest payload accepted on load
+#define STORE_QUIET_MS	2000   //changes are written once none have been made for this long
+#define STORE_DEFER_MS	30000  //or once the oldest unwritten change is this old
+
+	enum STORETYPE {
+		REC_CONTROLLER = 1,
+		REC_LOCO,
+		REC_TURNOUT
+	};
+
+	/*ahead of each record in the log.  crc covers the header, with crc zero, and the payload*/
+	struct STOREHDR {
+		uint8_t magic;
+		uint8_t type;
+		uint8_t index;		//slot for loco and turnout records
+		uint8_t schema;
+		uint16_t len;		//payload bytes
+		uint16_t spare;
+		uint32_t crc;
+	};
+
+	/*persistent fields only.  New fields go at the end, a shorter record from older firmware then loads
+	with defaults for the fields it lacks*/
+	struct STORECONTROLLER {
+		uint16_t currentLimit;
+		uint8_t voltageLimit;
+		uint8_t bootAsAP;
+		char SSID[21];
+		char pwd[21];
+		char IP[17];
+		char STA_SSID[21];
+		char STA_pwd[21];
+		uint16_t wsPort;
+		uint16_t tcpPort;
+		uint8_t resumeMoving;
+	};
+
+	struct STORELOCO {
+		uint16_t address;
+		uint8_t flags;		//STORE_USE128, STORE_LONG
+		char name[9];
+	};
+#define STORE_USE128	0x01
+#define STORE_LONG		0x02
+
+	struct STORETURNOUT {
+		uint16_t address;
+		char name[9];
+	};
+
+	/*the EEPROM image written by firmware 20240426, the last to use EEPROM.  Frozen, these must not follow
+	changes to CONTROLLER, LOCO or TURNOUT.  The image was those three, loco and turnout as arrays of 8*/
+#define EE_LEGACY_VERSION	20240426
+#define EE_LEGACY_SIZE		1024   //as passed to EEPROM.begin
+#define EE_LEGACY_LOCOS		8
+#define EE_LEGACY_TURNOUTS	8
+
+	struct EECONTROLLER {
+		int32_t softwareVersion;	//long on the ESP8266
+		uint16_t currentLimit;
+		uint8_t voltageLimit;
+		char SSID[21];
+		char pwd[21];
+		char IP[17];
+		char STA_SSID[21];
+		char STA_pwd[21];
+		uint16_t wsPort;
+		uint16_t tcpPort;
+		bool isDirty;
+		bool flagLocoRoster;
+		bool flagTurnoutRoster;
+		bool bootAsAP;
+	};
+
+	struct EELOCO {
+		uint16_t address;
+		char name[9];
+		float speed;
+		bool forward;
+		uint16_t function;
+		uint8_t speedStep;
+		uint8_t eStopTimer;
+		bool use128;
+		bool useLongAddress;
+		int8_t shunterMode;
+		uint8_t nudge;
+		bool functionFlag;
+		bool debug;
+		bool changeFlag;
+		bool brake;
+		bool jog;
+		bool directionFlag;
+		uint8_t consistID;
+		uint16_t history;
+	};
+
+	struct EETURNOUT {
+		uint16_t address;
+		bool thrown;
+		uint8_t history;
+		bool selected;
+		char name[9];
+		bool changeFlag;
+	};
+
+	struct STORESTATS {
+		uint32_t loaded;		//records applied at boot
+		uint32_t bad;			//boot scan stopped at a damaged record
+		uint32_t appends;		//records written since boot
+		uint32_t compactions;
+		uint32_t size;			//bytes in the log
+		uint32_t deferred;		//changes made, each is coalesced into the next write
+		uint32_t writes;		//deferred writes performed
+		uint32_t write_us;		//last write, including any compaction
+		uint32_t maxWrite_us;
+		uint32_t underruns;		//writes that outlasted the packets queued on layer 1 ahead of them
+	};
+
+	/*function prototypes*/
+	bool load(void);
+	bool importEEPROM(void);
+	void save(bool mayCompact);
+	void compact(void);
+	void defer(void);
+	void hurry(void);
+	bool pending(void);
+	bool due(void);
+	bool compactDue(void);
+	const STORESTATS &getStats(void);
+	uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+	/*local scope, hence declared static*/
+	static bool append(File &f, uint8_t type, uint8_t index, const void *payload, uint16_t len);
+	static bool apply(const STOREHDR &h, const uint8_t *payload);
+	static void encodeController(STORECONTROLLER &r);
+	static void encodeLoco(uint8_t slot, STORELOCO &r);
+	static void encodeTurnout(uint8_t slot, STORETURNOUT &r);
+
+}
+#endif
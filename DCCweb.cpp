@@ -5,6 +5,12 @@
 #include "DCCweb.h"
 #include "DCCcore.h"
 #include "WiThrottle.h"
+#include "JsonThrottle.h"
+#include "HeapStats.h"
+#include "DCCstore.h"
+#include "LocoRoster.h"
+#include "RtcSnapshot.h"
+#include "Scheduler.h"
 
 /*
 2024-05-26 this module UPDATED uses ArudinoJson library 7x see https://github.com/bblanchon/ArduinoJson
@@ -21,114 +27,197 @@ trace: bear in mind enabling trace will enable serial dumps, these take time and
 
 using namespace nsDCCweb;
 
-//reate a web server on port 80.  problems https://github.com/esp8266/Arduino/issues/4085
-ESP8266WebServer web(80);
-
 //2021-01-29 declare as a pointer, we need to instantate once wsPort is pulled from eeprom
 WebSocketsServer *webSocket;
 
+//2026-10-19 roster slots as last broadcast to browsers, and the delta sequence numbers
+static LOCOSENT m_locoSent[MAX_LOCO];
+static TURNOUTSENT m_turnoutSent[MAX_TURNOUT];
+static uint32_t m_locoSentMask = 0;
+static uint16_t m_locoSeq = 0;
+static uint16_t m_turnoutSeq = 0;
 
-#pragma region WEBSERVER_routines
+//2026-10-19 topics each websocket client is subscribed to, zero if not connected
+static uint8_t m_topics[WEBSOCKETS_SERVER_CLIENT_MAX];
 
-void handleRoot() {
-	//web.send(200, "text/html", "<h1>You are connected</h1>");
-	trace(Serial.println(F("HTTP server handleRoot."));)
-//2021-12-01 Engine Driver will request the directory root, i.e. / if you activate its Web menu item
+//2026-10-19 websocket command costs, see DCCwebWS
+static WSSTATS m_wsStats;
 
-	if (LittleFS.exists("/index.htm")) {                            
-		File file = LittleFS.open("/index.htm", "r");
-		size_t sent = web.streamFile(file, "text/html");  //we know its html!
-		file.close();                                      
-	}
-	else {
-		trace(Serial.println(F("cannot find /index.htm"));)
-	}
-}
+//2026-10-19 binary telemetry, double buffered.  one frame fills while the other awaits telemetrySend
+static TELEMETRYFRAME m_tele[2];
+static bool m_teleReady[2];
+static uint8_t m_teleFill = 0;
+static uint16_t m_teleSeq = 0;
+static uint32_t m_teleDropped = 0;
 
-String getContentType(String filename) { // convert the file extension to the MIME type
-	if (filename.endsWith(".htm")) return "text/html";
-	else if (filename.endsWith(".css")) return "text/css";
-	else if (filename.endsWith(".js")) return "application/javascript";
-	else if (filename.endsWith(".ico")) return "image/x-icon";
-	return "text/plain";
-}
 
-bool handleFileRead(String path) { // send the right file to the client (if it exists)
-	trace(Serial.println("handleFileRead: " + path);)
-	if (path.endsWith("/")) path += "index.htm";         // If a folder is requested, send the index file
-	String contentType = getContentType(path);            // Get the MIME type
-	if (LittleFS.exists(path)) {                            // If the file exists
-		File file = LittleFS.open(path, "r");                 // Open it
-		size_t sent = web.streamFile(file, contentType); // And send it to the client
-		file.close();                                       // Then close the file again
-		return true;
-	}
-	trace(Serial.println("\tFile Not Found " + path);)
-	return false;                                         // If the file doesn't exist, return false
+#pragma region WEBSERVER_routines
 
-	}
+/*2026-10-19 files are served by nsHttpServer from LittleFS, including / which maps to index.htm.
+Engine Driver will request the directory root if you activate its Web menu item*/
 
-//render a minimal hardware object as json back to the GET request, this gives the client the wsPort
-void getHardware() {
-	JsonDocument out;
+/*render a minimal hardware object as json back to the GET request, this gives the client the wsPort
+2026-10-19 streamed straight into the web server's chunk buffer, no String copy.  ?fields=IP,wsPort returns
+only those, type and cmd are always present*/
+static size_t hardwareStream(nsHttpServer::HTTPCONN &c, char *buf, size_t len) {
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
 	
 	out["type"] = "dccUI";
 	out["cmd"] = "hardware";
-	out["SSID"] = bootController.SSID;
-	out["pwd"] = bootController.pwd;
-	out["version"] = bootController.softwareVersion;
-	out["wsPort"] = bootController.wsPort;
-	out["IP"] = bootController.IP;
-	out["action"] = "poll";
-	out["STA_SSID"] = bootController.STA_SSID;
-	out["STA_pwd"] = bootController.STA_pwd[0] == '\0' ? "none" : "*****";
+	if (nsHttpServer::fieldWanted(c, "SSID")) out["SSID"] = bootController.SSID;
+	if (nsHttpServer::fieldWanted(c, "pwd")) out["pwd"] = bootController.pwd;
+	if (nsHttpServer::fieldWanted(c, "version")) out["version"] = bootController.softwareVersion;
+	if (nsHttpServer::fieldWanted(c, "wsPort")) out["wsPort"] = bootController.wsPort;
+	if (nsHttpServer::fieldWanted(c, "IP")) out["IP"] = bootController.IP;
+	if (nsHttpServer::fieldWanted(c, "action")) out["action"] = "poll";
+	if (nsHttpServer::fieldWanted(c, "STA_SSID")) out["STA_SSID"] = bootController.STA_SSID;
+	if (nsHttpServer::fieldWanted(c, "STA_pwd")) out["STA_pwd"] = bootController.STA_pwd[0] == '\0' ? "none" : "*****";
 	//additional debug params for this routine only
-	out["uptime"] = int(millis() / 1000);
-	out["clients"] = nsWiThrottle::clientCount();
-	out["volt"] = getVolt();
-	out["quiescent"] = power.quiescent_mA;
-	out["busmA"] = power.bus_mA;
-	out["base"] = power.ackBase_mA;
-	out["AD"] = power.ADresult;
-	out["heap"] = ESP.getFreeHeap();
+	if (nsHttpServer::fieldWanted(c, "uptime")) out["uptime"] = int(millis() / 1000);
+	if (nsHttpServer::fieldWanted(c, "clients")) out["clients"] = nsWiThrottle::clientCount();
+	if (nsHttpServer::fieldWanted(c, "volt")) out["volt"] = getVolt();
+	if (nsHttpServer::fieldWanted(c, "quiescent")) out["quiescent"] = power.quiescent_mA;
+	if (nsHttpServer::fieldWanted(c, "busmA")) out["busmA"] = power.bus_mA;
+	if (nsHttpServer::fieldWanted(c, "base")) out["base"] = power.ackBase_mA;
+	if (nsHttpServer::fieldWanted(c, "AD")) out["AD"] = power.ADresult;
+	if (nsHttpServer::fieldWanted(c, "heap")) out["heap"] = ESP.getFreeHeap();
+	//command bus health
+	const nsDCCbus::BUSSTATS &bus = nsDCCbus::getStats();
+	if (nsHttpServer::fieldWanted(c, "busMax_us")) out["busMax_us"] = bus.maxLatency_us;
+	if (nsHttpServer::fieldWanted(c, "busDropped")) out["busDropped"] = bus.dropped;
+	if (nsHttpServer::fieldWanted(c, "busHigh")) out["busHigh"] = bus.highWater;
+	if (nsHttpServer::fieldWanted(c, "witDropped")) out["witDropped"] = nsWiThrottle::txDropped();
+	//web server, worst loop stall while serving
+	const nsHttpServer::HTTPSTATS &http = nsHttpServer::getStats();
+	if (nsHttpServer::fieldWanted(c, "httpStall_us")) out["httpStall_us"] = http.maxStall_us;
+	if (nsHttpServer::fieldWanted(c, "httpPump_us")) out["httpPump_us"] = http.maxPump_us;
+	//websocket commands, worst time and heap
+	if (nsHttpServer::fieldWanted(c, "wsMax_us")) out["wsMax_us"] = m_wsStats.max_us;
+	if (nsHttpServer::fieldWanted(c, "wsHeap")) out["wsHeap"] = m_wsStats.maxHeap;
+	//json arena high water and overflows to the heap, and heap fragmentation for soak tests
+	const nsJsonArena::ARENASTATS &js = nsJsonArena::getStats();
+	if (nsHttpServer::fieldWanted(c, "arenaHigh")) out["arenaHigh"] = js.highWater;
+	if (nsHttpServer::fieldWanted(c, "arenaFallback")) out["arenaFallback"] = js.fallbacks;
+	if (nsHttpServer::fieldWanted(c, "heapFrag")) out["heapFrag"] = ESP.getHeapFragmentation();
+	if (nsHttpServer::fieldWanted(c, "maxBlock")) out["maxBlock"] = ESP.getMaxFreeBlockSize();
+	//settings write back, stall of the last and worst flash write and how often the layer 1 queue ran out
+	const nsDCCstore::STORESTATS &st = nsDCCstore::getStats();
+	if (nsHttpServer::fieldWanted(c, "storeWrite_us")) out["storeWrite_us"] = st.write_us;
+	if (nsHttpServer::fieldWanted(c, "storeMax_us")) out["storeMax_us"] = st.maxWrite_us;
+	if (nsHttpServer::fieldWanted(c, "storeUnderrun")) out["storeUnderrun"] = st.underruns;
+	if (nsHttpServer::fieldWanted(c, "storeWrites")) out["storeWrites"] = st.writes;
+	if (nsHttpServer::fieldWanted(c, "storeDeferred")) out["storeDeferred"] = st.deferred;
+	//flash loco roster size and reads since boot
+	const nsLocoRoster::ROSTERSTATS &ro = nsLocoRoster::getStats();
+	if (nsHttpServer::fieldWanted(c, "rosterCount")) out["rosterCount"] = ro.count;
+	if (nsHttpServer::fieldWanted(c, "rosterReads")) out["rosterReads"] = ro.reads;
+	//warm resumes from the RTC snapshot, consecutive ones count up
+	const nsRtcSnapshot::RTCSTATS &rt = nsRtcSnapshot::getStats();
+	if (nsHttpServer::fieldWanted(c, "rtcResumes")) out["rtcResumes"] = rt.resumes;
+	if (nsHttpServer::fieldWanted(c, "rtcSave_us")) out["rtcSave_us"] = rt.save_us;
+
+	//one piece.  wait for room, serializeJson also writes a terminating null
+	size_t n = measureJson(out);
+	if (n + 1 > len) return 0;
+	c.cursor = HTTP_CURSOR_END;
+	return serializeJson(out, buf, len);
+}
 
-	trace(out.printTo(Serial);) 
+void getHardware(nsHttpServer::HTTPCONN &c) {
+	nsHttpServer::sendStream(c, "text/json", &hardwareStream);
+}
 
+/*render loco roster as json back to the GET request
+2026-10-19 streamed a slot at a time, cursor 0 is the preamble and cursor n is slot n-1.  Same layout as the
+websocket roster.  ?fields=address,name limits each slot to those, slot is always present*/
+static size_t rosterStream(nsHttpServer::HTTPCONN &c, char *buf, size_t len) {
+	size_t n = 0;
+	if (c.cursor == 0) {
+		int w = snprintf(buf, len, "{\"type\":\"dccUI\",\"cmd\":\"roster\",\"seq\":%u,\"locos\":[", m_locoSeq);
+		if (w < 0 || (size_t)w >= len) return 0;
+		n = w;
+		c.cursor = 1;
+	}
 
-//We can avoid a String class, but need to guesstimate a useful buffer size
-	char jsonChar[512];
-	serializeJsonPretty(out, jsonChar, 512);
-	web.send(200, "text/json", jsonChar);
+	uint32_t mask = locoInUseMask();
+	nsJsonArena::SCOPE arena;
+	JsonDocument s(nsJsonArena::allocator());
+	while (c.cursor <= MAX_LOCO) {
+		uint8_t i = c.cursor - 1;
+		LOCO &loc = loco[i];
+		s.clear();
+		s["slot"] = i;
+		if (nsHttpServer::fieldWanted(c, "address")) s["address"] = loc.address;
+		if (nsHttpServer::fieldWanted(c, "useLong")) s["useLong"] = loc.useLongAddress;
+		if (nsHttpServer::fieldWanted(c, "use128")) s["use128"] = loc.use128;
+		if (nsHttpServer::fieldWanted(c, "inUse")) s["inUse"] = (mask & (1UL << i)) != 0;
+		if (nsHttpServer::fieldWanted(c, "name")) s["name"] = loc.name;
+		//separator, the slot and a null from serializeJson
+		if (n + 1 + measureJson(s) + 1 > len) return n;
+		if (i > 0) buf[n++] = ',';
+		n += serializeJson(s, buf + n, len - n);
+		++c.cursor;
+	}
 
+	if (n + 2 > len) return n;
+	buf[n++] = ']';
+	buf[n++] = '}';
+	c.cursor = HTTP_CURSOR_END;
+	return n;
 }
 
-//render loco roster as json back to the GET request
-void getRoster() {
-	//JSON 7 doc knows you want to add elements to the root.
-	//JSON 7 nested arrays are smartpointers
-
-	JsonDocument doc;
-	doc["type"] = "dccUI";
-	doc["cmd"] = "roster";
-	JsonArray slots = doc["locos"].to<JsonArray>();
+void getRoster(nsHttpServer::HTTPCONN &c) {
+	nsHttpServer::sendStream(c, "text/json", &rosterStream);
+}
 
+/*2026-10-19 the full loco roster from flash, as against the slots in /roster.  Streamed an entry at a time in
+address order, cursor 0 is the preamble and cursor n is entry n-1.  slot is the loco slot holding the entry, or
+-1.  ?fields=address,name limits each entry to those*/
+static size_t locosStream(nsHttpServer::HTTPCONN &c, char *buf, size_t len) {
+	size_t n = 0;
+	if (c.cursor == 0) {
+		int w = snprintf(buf, len, "{\"type\":\"dccUI\",\"cmd\":\"locos\",\"count\":%u,\"locos\":[", nsLocoRoster::count());
+		if (w < 0 || (size_t)w >= len) return 0;
+		n = w;
+		c.cursor = 1;
+	}
 
-	int i = 0;
-	for (auto loc : loco) {
-		//JSON 7 we add another doc
-		JsonDocument s;
-		s["slot"] = i++;
-		s["addr"] = loc.address;
-		s["useLong"] = loc.useLongAddress;
-		s["use128"] = loc.use128;
-		slots.add(s);
-		Serial.printf("slot %d \r\n", i);
+	nsJsonArena::SCOPE arena;
+	JsonDocument s(nsJsonArena::allocator());
+	nsLocoRoster::LOCOREC r;
+	while (nsLocoRoster::get(c.cursor - 1, r)) {
+		bool useLong = (r.flags & ROSTER_LONG) != 0;
+		s.clear();
+		if (nsHttpServer::fieldWanted(c, "address")) s["address"] = r.address;
+		if (nsHttpServer::fieldWanted(c, "useLong")) s["useLong"] = useLong;
+		if (nsHttpServer::fieldWanted(c, "use128")) s["use128"] = (r.flags & ROSTER_USE128) != 0;
+		if (nsHttpServer::fieldWanted(c, "name")) s["name"] = r.name;
+		if (nsHttpServer::fieldWanted(c, "slot")) s["slot"] = nsLocoRoster::slotOf(nsLocoRoster::key(r.address, useLong));
+		if (nsHttpServer::fieldWanted(c, "labels")) {
+			JsonArray a = s["labels"].to<JsonArray>();
+			for (auto &l : r.labels) a.add(l);
+		}
+		if (nsHttpServer::fieldWanted(c, "table")) {
+			JsonArray a = s["table"].to<JsonArray>();
+			for (auto v : r.speedTable) a.add(v);
+		}
+		//separator, the entry and a null from serializeJson
+		if (n + 1 + measureJson(s) + 1 > len) return n;
+		if (c.cursor > 1) buf[n++] = ',';
+		n += serializeJson(s, buf + n, len - n);
+		++c.cursor;
 	}
 
-	serializeJsonPretty(doc, Serial);
-	String r;
-	serializeJsonPretty(doc, r);
-	web.send(200, "text/json", r);
+	if (n + 2 > len) return n;
+	buf[n++] = ']';
+	buf[n++] = '}';
+	c.cursor = HTTP_CURSOR_END;
+	return n;
+}
+
+void getLocos(nsHttpServer::HTTPCONN &c) {
+	nsHttpServer::sendStream(c, "text/json", &locosStream);
 }
 
 
@@ -176,17 +265,11 @@ void nsDCCweb::startWebServices() {
 	
 
 	// Start a Web server
-	web.on("/", handleRoot);
-	web.onNotFound([]() {                              // If the client requests any URI
-		if (!handleFileRead(web.uri()))                  // send it if it exists
-			web.send(404, "text/plain", "404: Not Found"); // otherwise, respond with a 404 (Not Found) error
-	});
-
-	//special GET handlers
-	//https://forum.arduino.cc/index.php?topic=476291.0
-	web.on("/hardware", HTTP_GET, []() {getHardware();});
-	web.on("/roster", HTTP_GET, []() {getRoster();});
-	web.begin();    // start the HTTP server
+	//2026-10-19 non-blocking server, see HttpServer.cpp
+	nsHttpServer::on("/hardware", &getHardware);
+	nsHttpServer::on("/roster", &getRoster);
+	nsHttpServer::on("/locos", &getLocos);
+	nsHttpServer::begin();
 	Serial.println(F("HTTP server started."));
 
 	LittleFS.begin();                           // Start the Flash Files System
@@ -198,11 +281,18 @@ void nsDCCweb::startWebServices() {
 
 	Serial.printf("WebSocket start port %d\n", bootController.wsPort);
 
+	//browsers start from a full roster, deltas are relative to the settings just loaded
+	syncSent();
+
+	//websocket command filters
+	buildFilters();
+
 }
 
 //call regularly from main loop
 void nsDCCweb::loopWebServices(void) {
-	web.handleClient();
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	nsHttpServer::loop();
 	webSocket->loop();
 }
 
@@ -216,593 +306,940 @@ void nsDCCweb::webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, siz
 	switch (type) {
 	case WStype_DISCONNECTED:             // if the websocket is disconnected
 		trace(Serial.printf("[%u] Disconnected!\n", num);)
+#ifdef _JSONTHROTTLE_h
+		nsJsonThrottle::disconnect(num);
+#endif
+		if (num < WEBSOCKETS_SERVER_CLIENT_MAX) m_topics[num] = 0;
 		break;
 	case WStype_CONNECTED: {              // if a new websocket connection is established
 		IPAddress ip = webSocket->remoteIP(num);
+		if (num < WEBSOCKETS_SERVER_CLIENT_MAX) m_topics[num] = TOPIC_DEFAULT;
 		trace(Serial.printf("[%u] Connected from %d.%d.%d.%d url: %s\n", num, ip[0], ip[1], ip[2], ip[3], payload);)
 		}
 		break;
 	case WStype_TEXT:                     // if new text data is received
-	  //Serial.printf("[%u] get Text: %s\n", num, payload);
 		trace(Serial.printf("\nfrom WS: %s\n", payload);)
-		JsonDocument doc;
-		DeserializationError err = deserializeJson(doc, payload);
-		if (err) {
-			trace(Serial.println(F("parseObject() failed"));
-			Serial.println(err.c_str());
-			)
-				return;
-		}
-
-		const char *sType= doc["type"];
-		if (sType == nullptr) return; 
-		
-		if (strcmp(sType,"dccUI")==0) {
-			//callout to DCCweb module
-			nsDCCweb::DCCwebWS(doc);
-			return;
-		}
-
-		/*for all other types, call out to the JsonThrottle if module loaded*/
-#ifdef _JSONTHROTTLE_h
-		nsJsonThrottle::processJson(root);
-#endif
+		//2026-10-19 parsed and dispatched by the command table
+		DCCwebWS(num, (char*)payload, length);
+		break;
+	default:
+		break;
 	}//end switch
 }//end websocket event
 
 
-void nsDCCweb::sendJson(JsonObject& out) {
-	//We can avoid a String class, but need to guesstimate a useful buffer size
-	//2021-10-07 payload increased to 800 bytes to support max loco=8
-	char payload[800];
-	//JSON 7
-	serializeJson(out, payload, sizeof(payload));
-	webSocket->broadcastTXT(payload);
+/*slot is in use if speed is >0 or a WiThrottle has taken it*/
+uint32_t nsDCCweb::locoInUseMask(void) {
+	uint32_t mask = 0;
+	for (int i = 0; i < MAX_LOCO; ++i) {
+		if (loco[i].speed > 0 || loco[i].consistID != 0) mask |= (1UL << i);
+	}
+	return mask;
+}
+
+/*2026-10-19 the loco roster document, serialized once and reused for every websocket client.  HTTP /roster is streamed, see rosterStream.
+Rebuilt when the roster generation changes.  inUse depends on speed and consistID rather than the roster, so
+the set of in-use slots is also part of the cache key, as is the delta sequence number the document carries*/
+const String &nsDCCweb::locoRosterJson(void) {
+	static String r;
+	static uint16_t gen = 0;
+	static uint16_t seq = 0;
+	static uint32_t inUseMask = 0;
+
+	uint32_t mask = locoInUseMask();
+	if (gen == locoRosterGen && seq == m_locoSeq && mask == inUseMask && r.length() > 0) return r;
+	gen = locoRosterGen;
+	seq = m_locoSeq;
+	inUseMask = mask;
+
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "roster";
+	out["seq"] = seq;
+	JsonArray slots = out["locos"].to<JsonArray>();
+
+	int i = 0;
+	for (auto &loc : loco) {
+		JsonObject s = slots.add<JsonObject>();
+		s["slot"] = i;
+		s["address"] = loc.address;
+		s["useLong"] = loc.useLongAddress;
+		s["use128"] = loc.use128;
+		s["inUse"] = (mask & (1UL << i)) != 0;
+		s["name"] = loc.name;
+		++i;
+	}
+	r = "";
+	serializeJson(out, r);
+	trace(Serial.println(r);)
+	return r;
+}
+
+/*2026-10-19 the turnout roster document, rebuilt when the turnout generation changes.  Turnout state is
+part of the document, so a state change also bumps the generation*/
+const String &nsDCCweb::turnoutRosterJson(void) {
+	static String r;
+	static uint16_t gen = 0;
+	static uint16_t seq = 0;
+	if (gen == turnoutRosterGen && seq == m_turnoutSeq && r.length() > 0) return r;
+	gen = turnoutRosterGen;
+	seq = m_turnoutSeq;
+
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "turnout";
+	out["seq"] = seq;
+	JsonArray slots = out["turnouts"].to<JsonArray>();
+
+	int i = 0;
+	for (auto &t : turnout) {
+		JsonObject s = slots.add<JsonObject>();
+		s["slot"] = i++;
+		s["address"] = t.address;
+		s["name"] = t.name;
+		s["state"] = t.thrown ? "thrown" : "closed";
+	}
+	r = "";
+	serializeJson(out, r);
+	trace(Serial.println(r);)
+	return r;
 }
 
 /// <summary>
-/// Overload, Json 7 send doc contents
+/// 2026-10-19 send text that is already serialized, e.g. a cached roster, to the clients subscribed to topic
+/// </summary>
+void nsDCCweb::sendText(const String &payload, uint8_t topic) {
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		if (m_topics[n] & topic) webSocket->sendTXT(n, payload.c_str(), payload.length());
+	}
+}
+
+/// <summary>
+/// Json 7 send doc contents.  2026-10-19 the doc is passed by reference, previously it was deep copied.
+/// The buffer is sized with measureJson rather than a fixed 800 byte stack buffer which truncated large rosters.
+/// WEBSOCKETS_MAX_HEADER_SIZE bytes are reserved ahead of the payload so that the websocket library writes
+/// the frame header in place (headerToPayload) rather than copying the payload again.  With headerToPayload the
+/// library takes the start of the buffer, headroom included, and len is the payload alone.
+/// 2026-10-19 sent only to clients subscribed to topic.  The doc is serialized once however many there are,
+/// each send rewrites the header in the same headroom
+/// 2026-10-19 the buffer is taken from the json arena, in the caller's SCOPE, after the doc's own blocks.  A message
+/// that does not fit goes to the heap and is counted in ARENASTATS.fallbacks
 /// </summary>
 /// <param name="out"></param>
-void nsDCCweb::sendJson(JsonDocument out) {
-	//We can avoid a String class, but need to guesstimate a useful buffer size
-	//2021-10-07 payload increased to 800 bytes to support max loco=8
-	char payload[800];
-	serializeJson(out, payload, sizeof(payload));
-	webSocket->broadcastTXT(payload);
+/// <param name="topic">a TOPIC_ bit</param>
+void nsDCCweb::sendJson(const JsonDocument &out, uint8_t topic) {
+	if (!topicInUse(topic)) return;
+	nsJsonArena::SCOPE arena;
+	size_t len = measureJson(out);
+	uint8_t *buf = (uint8_t*)nsJsonArena::allocator()->allocate(WEBSOCKETS_MAX_HEADER_SIZE + len + 1);
+	if (buf == nullptr) {
+		trace(Serial.printf("sendJson no memory for %d\r\n", len);)
+		return;
+	}
+	serializeJson(out, (char*)buf + WEBSOCKETS_MAX_HEADER_SIZE, len + 1);
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		if (m_topics[n] & topic) webSocket->sendTXT(n, buf, len, true);
+	}
+	nsJsonArena::allocator()->deallocate(buf);
+}
+
+/// <summary>
+/// 2026-10-19 as sendJson, but to a single websocket client.  Used by JsonThrottle
+/// </summary>
+void nsDCCweb::sendJsonTo(uint8_t num, const JsonDocument &out) {
+	nsJsonArena::SCOPE arena;
+	size_t len = measureJson(out);
+	uint8_t *buf = (uint8_t*)nsJsonArena::allocator()->allocate(WEBSOCKETS_MAX_HEADER_SIZE + len + 1);
+	if (buf == nullptr) {
+		trace(Serial.printf("sendJsonTo no memory for %d\r\n", len);)
+		return;
+	}
+	serializeJson(out, (char*)buf + WEBSOCKETS_MAX_HEADER_SIZE, len + 1);
+	webSocket->sendTXT(num, buf, len, true);
+	nsJsonArena::allocator()->deallocate(buf);
 }
 
+/*true if any connected client is subscribed to topic*/
+bool nsDCCweb::topicInUse(uint8_t topic) {
+	for (auto t : m_topics) {
+		if (t & topic) return true;
+	}
+	return false;
+}
+
+uint8_t nsDCCweb::topicBit(const char *name) {
+	if (name == nullptr) return 0;
+	if (strcmp(name, "power") == 0) return TOPIC_POWER;
+	if (strcmp(name, "roster") == 0) return TOPIC_ROSTER;
+	if (strcmp(name, "turnout") == 0) return TOPIC_TURNOUT;
+	if (strcmp(name, "service") == 0) return TOPIC_SERVICE;
+	if (strcmp(name, "telemetry") == 0) return TOPIC_TELEMETRY;
+	return 0;
+}
+
+
+
+/*2026-10-19 websocket command table.  filter lists the fields the handler reads, deserializeJson only
+materializes those, so a large or unexpected message costs no more heap than the fields we use.  Arrays
+in a filter apply their first element to every element*/
+struct WSCOMMAND {
+	const char *cmd;
+	const char *filter;
+	void(*fn)(uint8_t num, JsonDocument &doc);
+};
+
+static const WSCOMMAND m_wsCommands[] = {
+	{ "power", "{\"mA_limit\":true,\"V_limit\":true,\"track\":true,\"SM\":true}", &wsPower },
+	{ "roster", "{\"locos\":[{\"slot\":true,\"address\":true,\"useLong\":true,\"use128\":true,\"inUse\":true,\"name\":true}]}", &wsRoster },
+	{ "turnout", "{\"turnouts\":[{\"slot\":true,\"address\":true,\"name\":true,\"state\":true}]}", &wsTurnout },
+	{ "pom", "{\"action\":true,\"addr\":true,\"cvReg\":true,\"cvVal\":true}", &wsPom },
+	{ "service", "{\"action\":true,\"cvReg\":true,\"cvVal\":true}", &wsService },
+	{ "hardware", "{\"action\":true,\"SSID\":true,\"STA_SSID\":true,\"pwd\":true,\"STA_pwd\":true,\"IP\":true,\"wsPort\":true,\"tcpPort\":true,\"resume\":true}", &wsHardware },
+	{ "subscribe", "{\"topics\":true}", &wsSubscribe },
+	{ "telemetry", "{\"on\":true}", &wsTelemetry },
+	{ "heap", "{\"ring\":true}", &wsHeapStats },
+	{ "tasks", "{}", &wsTasks },
+	{ "loco", "{\"address\":true,\"useLong\":true,\"use128\":true,\"name\":true,\"labels\":true,\"table\":true,\"delete\":true}", &wsLoco },
+};
+#define WS_COMMANDS	(sizeof(m_wsCommands) / sizeof(m_wsCommands[0]))
+
+static JsonDocument m_wsFilter[WS_COMMANDS];
+#ifdef _JSONTHROTTLE_h
+static JsonDocument m_jtFilter;
+#endif
+
+/*filters are parsed once at boot*/
+void nsDCCweb::buildFilters(void) {
+	for (uint8_t i = 0; i < WS_COMMANDS; ++i) {
+		deserializeJson(m_wsFilter[i], m_wsCommands[i].filter);
+	}
+#ifdef _JSONTHROTTLE_h
+	deserializeJson(m_jtFilter, "{\"type\":true,\"c\":true,\"a\":true,\"v\":true,\"d\":true,\"n\":true,\"on\":true,\"steal\":true}");
+#endif
+}
 
+/*find "key":"value" in the raw message and copy value to out, without parsing the message.  Used to pick
+the handler, and its filter, before deserializing.  false if absent, not a plain string, or too long*/
+bool nsDCCweb::jsonPeek(const char *payload, size_t length, const char *key, char *out, size_t outLen) {
+	size_t k = strlen(key);
+	const char *end = payload + length;
+	for (const char *p = payload; p + k + 2 < end; ++p) {
+		if (p[0] != '"' || strncmp(p + 1, key, k) != 0 || p[k + 1] != '"') continue;
+		p += k + 2;
+		while (p < end && (*p == ' ' || *p == '\t')) ++p;
+		if (p >= end || *p != ':') continue;
+		++p;
+		while (p < end && (*p == ' ' || *p == '\t')) ++p;
+		if (p >= end || *p != '"') return false;
+		++p;
+		size_t n = 0;
+		while (p < end && *p != '"') {
+			if (*p == '\\' || n + 1 >= outLen) return false;
+			out[n++] = *p++;
+		}
+		if (p >= end) return false;
+		out[n] = '\0';
+		return true;
+	}
+	return false;
+}
 
 /// <summary>
-/// Process a JSON inbound document
+/// Process an inbound websocket text message.  2026-10-19 replaces the strcmp chain.  type and cmd are read
+/// from the raw text, the message is then deserialized once with that command's filter and the handler is
+/// called with the doc by reference.  Time and arena taken are recorded in m_wsStats, see /hardware.
+/// ArduinoJson 7 always copies strings into the doc, there is no in-place mode, so the filter and the
+/// WS_MAX_PAYLOAD limit are what bound the arena used per command
 /// </summary>
-/// <param name="doc">incoming doc, previously deserialised and validated</param>
-void nsDCCweb::DCCwebWS(JsonDocument doc) {
-	const char* cmd = doc["cmd"];
-	if (cmd == nullptr) return;
-	trace(Serial.println("DCCwebWS");)
-
-	if (strcmp(cmd, "power") == 0) {
-			//if a param is blank, means client web page wants to poll value
-			//if client provides a value for mA_limit or V_limit, write this to EEPROM
-			//to avoid unintential writes, client should send 0 values
-			const char* v = doc["mA_limit"];
-			if (v != nullptr) {
-				if (atoi(v) > 0 && atoi(v) != bootController.currentLimit) {
-					bootController.isDirty = true;
-					bootController.currentLimit = atoi(v);
-					if (bootController.currentLimit > 4000) bootController.currentLimit = 4000;
-					if (bootController.currentLimit < 250) bootController.currentLimit = 250;
+/// <param name="num">websocket client the message came from</param>
+void nsDCCweb::DCCwebWS(uint8_t num, char *payload, size_t length) {
+	if (length > WS_MAX_PAYLOAD) {
+		++m_wsStats.rejected;
+		return;
+	}
+	uint32_t t = micros();
+	char type[8];
+	char cmd[16];
+	if (!jsonPeek(payload, length, "type", type, sizeof(type))) return;
+
+	nsJsonArena::SCOPE arena;
+	JsonDocument doc(nsJsonArena::allocator());
+	void(*fn)(uint8_t, JsonDocument&) = nullptr;
+	DeserializationError err;
+
+	if (strcmp(type, "dccUI") == 0) {
+		if (!jsonPeek(payload, length, "cmd", cmd, sizeof(cmd))) return;
+		uint8_t i = 0;
+		while (i < WS_COMMANDS && strcmp(m_wsCommands[i].cmd, cmd) != 0) ++i;
+		if (i == WS_COMMANDS) {
+			++m_wsStats.unknown;
+			return;
+		}
+		err = deserializeJson(doc, payload, length, DeserializationOption::Filter(m_wsFilter[i]), DeserializationOption::NestingLimit(4));
+		fn = m_wsCommands[i].fn;
+	}
+#ifdef _JSONTHROTTLE_h
+	else if (strcmp(type, "jt") == 0) {
+		//for all other types, call out to the JsonThrottle if module loaded
+		err = deserializeJson(doc, payload, length, DeserializationOption::Filter(m_jtFilter), DeserializationOption::NestingLimit(2));
+		fn = &nsJsonThrottle::processJson;
+	}
+#endif
+	else {
+		++m_wsStats.unknown;
+		return;
+	}
 
-				}
-			}
+	if (err) {
+		trace(Serial.println(F("parseObject() failed"));
+		Serial.println(err.c_str());
+		)
+		++m_wsStats.rejected;
+		return;
+	}
 
-			v = doc["V_limit"];
-			if (v != nullptr) {
-				if (atoi(v) > 0 && atoi(v) != bootController.voltageLimit) {
-					bootController.isDirty = true;
-					bootController.voltageLimit = atoi(v);
-				}
-			}
+	uint32_t used = nsJsonArena::inUse();
+	uint32_t parsed = micros() - t;
+	fn(num, doc);
+	uint32_t total = micros() - t;
 
-			v = doc["track"];
-			if (v != nullptr) {
-				//2021-12-06 if value is unknown, client wants to poll it, not set it
-				if (strcmp(cmd, "unknown") != 0) setPower(cBool(v));
-			}
+	++m_wsStats.commands;
+	if (used > m_wsStats.maxHeap) m_wsStats.maxHeap = used;
+	if (parsed > m_wsStats.maxParse_us) m_wsStats.maxParse_us = parsed;
+	if (total > m_wsStats.max_us) m_wsStats.max_us = total;
+}
 
-			v = doc["SM"];
-			if (v != nullptr) {
-				//additionally set the power.serviceMode flag if present
-				//used for service mode programming
-				power.serviceMode = cBool(v);
-			}
+void nsDCCweb::wsPower(uint8_t num, JsonDocument &doc) {
+	//if a param is blank, means client web page wants to poll value
+	//if client provides a value for mA_limit or V_limit, write this to EEPROM
+	//to avoid unintential writes, client should send 0 values
+	const char* v = doc["mA_limit"];
+	if (v != nullptr) {
+		if (atoi(v) > 0 && atoi(v) != bootController.currentLimit) {
+			bootController.isDirty = true;
+			bootController.currentLimit = atoi(v);
+			if (bootController.currentLimit > 4000) bootController.currentLimit = 4000;
+			if (bootController.currentLimit < 250) bootController.currentLimit = 250;
 
-			dccPutSettings();
-			JsonDocument out;
+		}
+	}
 
-			out["type"] = "dccUI";
-			out["cmd"] = "power";
-			out["mA"] = (int)power.bus_mA;
-			out["V"] = power.bus_volts;
-			out["trip"] = power.trip;
-			out["track"] = power.trackPower;
-			out["mA_limit"] = bootController.currentLimit;
-			out["V_limit"] = bootController.voltageLimit;
-			out["SM"] = power.serviceMode;
+	v = doc["V_limit"];
+	if (v != nullptr) {
+		if (atoi(v) > 0 && atoi(v) != bootController.voltageLimit) {
+			bootController.isDirty = true;
+			bootController.voltageLimit = atoi(v);
+		}
+	}
+
+	v = doc["track"];
+	if (v != nullptr) {
+		//2021-12-06 if value is unknown, client wants to poll it, not set it
+		//DCCcore broadcasts the new state to all clients once it applies the command
+		if (strcmp(v, "unknown") != 0) nsDCCbus::setPower(cBool(v), nsDCCbus::BUS_WEB);
+	}
 
-			trace(serializeJson(out, Serial);)
+	v = doc["SM"];
+	if (v != nullptr) {
+		//additionally set the power.serviceMode flag if present
+		//used for service mode programming
+		power.serviceMode = cBool(v);
+	}
+
+	dccPutSettings();
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
 
-				sendJson(out);
+	out["type"] = "dccUI";
+	out["cmd"] = "power";
+	out["mA"] = (int)power.bus_mA;
+	out["V"] = power.bus_volts;
+	out["trip"] = power.trip;
+	out["track"] = power.trackPower;
+	out["mA_limit"] = bootController.currentLimit;
+	out["V_limit"] = bootController.voltageLimit;
+	out["SM"] = power.serviceMode;
 
+	trace(serializeJson(out, Serial);)
+
+		sendJson(out, TOPIC_POWER);
+}
+
+void nsDCCweb::wsSubscribe(uint8_t num, JsonDocument &doc) {
+	//2026-10-19 {"type":"dccUI","cmd":"subscribe","topics":["power","roster"]} replaces this client's topics
+	//an empty list receives no broadcasts, only replies to its own requests
+	if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+	uint8_t t = 0;
+	for (JsonVariant v : doc["topics"].as<JsonArray>()) t |= topicBit(v.as<const char*>());
+	m_topics[num] = t;
+	return;
+}
+
+void nsDCCweb::wsTelemetry(uint8_t num, JsonDocument &doc) {
+	//2026-10-19 opt in or out of the binary telemetry stream {"type":"dccUI","cmd":"telemetry","on":true}
+	if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+	if (doc["on"].as<bool>()) m_topics[num] |= TOPIC_TELEMETRY;
+	else m_topics[num] &= ~TOPIC_TELEMETRY;
+
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "telemetry";
+	out["on"] = (m_topics[num] & TOPIC_TELEMETRY) != 0;
+	out["batch"] = TELEMETRY_BATCH;
+	out["period"] = 10;
+	out["mA_limit"] = bootController.currentLimit;
+	out["dropped"] = m_teleDropped;
+	sendJsonTo(num, out);
+	return;
+}
+
+void nsDCCweb::wsHeapStats(uint8_t num, JsonDocument &doc) {
+	//2026-10-19 heap use by subsystem {"type":"dccUI","cmd":"heap"}, add "ring":false to omit the samples
+	//samples are oldest first, [sec, free, maxBlock, frag%, core, withrottle, dccweb, json]
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "heap";
+	out["free"] = ESP.getFreeHeap();
+	out["maxBlock"] = ESP.getMaxFreeBlockSize();
+	out["frag"] = ESP.getHeapFragmentation();
+	out["untagged"] = nsHeapStats::untagged();
+	out["period"] = HEAP_SAMPLE_MS / 1000;
+	JsonObject tags = out["tags"].to<JsonObject>();
+	for (uint8_t i = 0; i < nsHeapStats::HEAP_TAGS; ++i) {
+		const nsHeapStats::HEAPUSE &u = nsHeapStats::getUse(i);
+		JsonArray a = tags[nsHeapStats::tagName(i)].to<JsonArray>();
+		a.add(u.held);
+		a.add(u.peak);
+	}
+	if (doc["ring"] | true) {
+		JsonArray ring = out["ring"].to<JsonArray>();
+		for (int16_t age = nsHeapStats::sampleCount() - 1; age >= 0; --age) {
+			const nsHeapStats::HEAPSAMPLE &s = nsHeapStats::getSample(age);
+			JsonArray r = ring.add<JsonArray>();
+			r.add(s.t);
+			r.add(s.freeHeap);
+			r.add(s.maxBlock);
+			r.add(s.frag);
+			for (auto h : s.held) r.add(h);
 		}
+	}
+	sendJsonTo(num, out);
+}
 
-	if (strcmp(cmd, "hardware") == 0) {
-		//{"type":"dccUI", "cmd":"hardware","SSID" : "DDC_01", "Password" : "none", "IP" : "192.168.4.1","version":20201201,"action":"poll" ,"wsPort":10,"wiPort":20}
-		//{ "type": "dccUI", "cmd": "hardware", "SSID": "DCC_02", "IP": "192.168.7.1", "MAC":"return of the", "pwd": "", "wsPort": 12080, "wiPort": 12090, "action": "poll" };
-		//{ "type": "dccUI", "cmd": "hardware", "action": "poll" };
+void nsDCCweb::wsTasks(uint8_t num, JsonDocument &doc) {
+	//2026-10-19 main loop scheduler stats {"type":"dccUI","cmd":"tasks"}
+	//pump is [runs, maxGap_us, late], each task [period, deadline, priority, runs, overruns, skipped, last_us, max_us, avg_us]
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "tasks";
+	const nsScheduler::PUMPSTATS &p = nsScheduler::getPump();
+	JsonArray pump = out["pump"].to<JsonArray>();
+	pump.add(p.runs);
+	pump.add(p.maxGap_us);
+	pump.add(p.late);
+	JsonObject tasks = out["tasks"].to<JsonObject>();
+	for (uint8_t i = 0; i < nsScheduler::taskCount(); ++i) {
+		const nsScheduler::TASK &t = nsScheduler::getTask(i);
+		JsonArray a = tasks[t.name].to<JsonArray>();
+		a.add(t.period);
+		a.add(t.deadline);
+		a.add(t.priority);
+		a.add(t.runs);
+		a.add(t.overruns);
+		a.add(t.skipped);
+		a.add(t.last_us);
+		a.add(t.max_us);
+		a.add(t.runs > 0 ? t.total_us / t.runs : 0);
+	}
+	sendJsonTo(num, out);
+}
 
-		const char* v = doc["action"];
-		bool restart = false;
+void nsDCCweb::wsLoco(uint8_t num, JsonDocument &doc) {
+	//2026-10-19 add, edit or delete an entry in the flash loco roster, GET /locos lists it
+	//{"type":"dccUI","cmd":"loco","address":1234,"useLong":true,"use128":true,"name":"ivor","labels":["light","bell"],"table":[]}
+	//{"type":"dccUI","cmd":"loco","address":1234,"useLong":true,"delete":true}
+	//a loco in a slot cannot be deleted, edits to it apply to the slot
+	nsLocoRoster::LOCOREC r;
+	memset(&r, 0, sizeof(r));
+	r.address = doc["address"] | 0;
+	bool useLong = doc["useLong"] | false;
+	if (r.address > 127) useLong = true;
+	if (useLong) r.flags |= ROSTER_LONG;
+	bool ok = (r.address >= 1) && (r.address <= 10239);
+
+	if (ok && (doc["delete"] | false)) {
+		ok = nsLocoRoster::remove(nsLocoRoster::key(r.address, useLong));
+	}
+	else if (ok) {
+		if (doc["use128"] | false) r.flags |= ROSTER_USE128;
+		strncpy(r.name, doc["name"] | "", sizeof(r.name) - 1);
+		uint8_t n = 0;
+		for (JsonVariant v : doc["labels"].as<JsonArray>()) {
+			if (n >= ROSTER_LABELS) break;
+			strncpy(r.labels[n++], v | "", ROSTER_LABEL_LEN - 1);
+		}
+		n = 0;
+		for (JsonVariant v : doc["table"].as<JsonArray>()) {
+			if (n >= ROSTER_STEPS) break;
+			r.speedTable[n++] = v | 0;
+		}
+		ok = nsLocoRoster::put(r);
+	}
+	if (ok) locoRosterChanged();
 
-		if ((v != nullptr) && strcmp(v, "write") == 0) {
-			//user wishes to set one or more values
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "loco";
+	out["address"] = r.address;
+	out["useLong"] = useLong;
+	out["result"] = ok;
+	sendJsonTo(num, out);
+}
 
-			v = doc["SSID"];
-			if (v != nullptr) {
-				strncpy(bootController.SSID, v, sizeof(bootController.SSID));
-				//cannot set the AP SSID to null
-				if (bootController.SSID[0] == '\0') {
-					strncpy(bootController.SSID, "DCC_ESP\0", sizeof(bootController.SSID));
-				}
+void nsDCCweb::wsHardware(uint8_t num, JsonDocument &doc) {
+	//{"type":"dccUI", "cmd":"hardware","SSID" : "DDC_01", "Password" : "none", "IP" : "192.168.4.1","version":20201201,"action":"poll" ,"wsPort":10,"wiPort":20}
+	//{ "type": "dccUI", "cmd": "hardware", "SSID": "DCC_02", "IP": "192.168.7.1", "MAC":"return of the", "pwd": "", "wsPort": 12080, "wiPort": 12090, "action": "poll" };
+	//{ "type": "dccUI", "cmd": "hardware", "action": "poll" };
 
-				restart = true;
-			}
+	const char* v = doc["action"];
+	bool restart = false;
 
-			v = doc["STA_SSID"];
-			if (v != nullptr) {
-				strncpy(bootController.STA_SSID, v, sizeof(bootController.STA_SSID));
-				//writing null is ok.
-				restart = true;
+	if ((v != nullptr) && strcmp(v, "write") == 0) {
+		//user wishes to set one or more values
+
+		v = doc["SSID"];
+		if (v != nullptr) {
+			strncpy(bootController.SSID, v, sizeof(bootController.SSID));
+			//cannot set the AP SSID to null
+			if (bootController.SSID[0] == '\0') {
+				strncpy(bootController.SSID, "DCC_ESP\0", sizeof(bootController.SSID));
 			}
 
-			v = doc["pwd"];
-			if (v != nullptr) {
-				//"none" is used explicity to instruct system to set a null pwd
-				if (strcmp(v, "none") == 0) { memset(bootController.pwd, '\0', sizeof(bootController.pwd)); }
-				else {
-					//length of password must be 8+ chars
-					int i = 0;
-					while (v[i] != '\0') {
-						i++;
-						if (i == 7) break;
-					}
-
-					//only save passwords 8+ char
-					if (i >= 7) strncpy(bootController.pwd, v, sizeof(bootController.pwd));
+			restart = true;
+		}
+
+		v = doc["STA_SSID"];
+		if (v != nullptr) {
+			strncpy(bootController.STA_SSID, v, sizeof(bootController.STA_SSID));
+			//writing null is ok.
+			restart = true;
+		}
+
+		v = doc["pwd"];
+		if (v != nullptr) {
+			//"none" is used explicity to instruct system to set a null pwd
+			if (strcmp(v, "none") == 0) { memset(bootController.pwd, '\0', sizeof(bootController.pwd)); }
+			else {
+				//length of password must be 8+ chars
+				int i = 0;
+				while (v[i] != '\0') {
+					i++;
+					if (i == 7) break;
 				}
-				restart = true;
+
+				//only save passwords 8+ char
+				if (i >= 7) strncpy(bootController.pwd, v, sizeof(bootController.pwd));
 			}
+			restart = true;
+		}
 
-			v = doc["STA_pwd"];
-			if (v != nullptr) {
-				//"none" is used explicity to instruct system to set a null pwd
-				if (strcmp(v, "none") == 0) { memset(bootController.STA_pwd, '\0', sizeof(bootController.STA_pwd)); }
-				else {
-					//length of password must be 8+ chars
-					int i = 0;
-					while (v[i] != '\0') {
-						i++;
-						if (i == 7) break;
-					}
-
-					//only save passwords 8+ char
-					if (i >= 7) strncpy(bootController.STA_pwd, v, sizeof(bootController.STA_pwd));
+		v = doc["STA_pwd"];
+		if (v != nullptr) {
+			//"none" is used explicity to instruct system to set a null pwd
+			if (strcmp(v, "none") == 0) { memset(bootController.STA_pwd, '\0', sizeof(bootController.STA_pwd)); }
+			else {
+				//length of password must be 8+ chars
+				int i = 0;
+				while (v[i] != '\0') {
+					i++;
+					if (i == 7) break;
 				}
-				restart = true;
-			}
 
-			v = doc["IP"];
-			if (v != nullptr) {
-				//ip address is stored as dot separated
-				strncpy(bootController.IP, v, sizeof(bootController.IP));
-				restart = true;
+				//only save passwords 8+ char
+				if (i >= 7) strncpy(bootController.STA_pwd, v, sizeof(bootController.STA_pwd));
 			}
+			restart = true;
+		}
 
-			v = doc["wsPort"];
-			if (v != nullptr) {
-				if (atoi(v) > 0 && atoi(v) <= 65535) {
-					restart = true;
-					bootController.wsPort = atoi(v);
-				}
+		v = doc["IP"];
+		if (v != nullptr) {
+			//ip address is stored as dot separated
+			strncpy(bootController.IP, v, sizeof(bootController.IP));
+			restart = true;
+		}
+
+		v = doc["wsPort"];
+		if (v != nullptr) {
+			if (atoi(v) > 0 && atoi(v) <= 65535) {
+				restart = true;
+				bootController.wsPort = atoi(v);
 			}
+		}
 
-			v = doc["tcpPort"];
-			if (v != nullptr) {
-				if (atoi(v) > 0 && atoi(v) <= 65535) {
-					restart = true;
-					bootController.tcpPort = atoi(v);
-				}
+		v = doc["tcpPort"];
+		if (v != nullptr) {
+			if (atoi(v) > 0 && atoi(v) <= 65535) {
+				restart = true;
+				bootController.tcpPort = atoi(v);
 			}
+		}
 
+		//2026-10-19 "moving" or "stopped", how locos come back after a warm reset.  no restart needed
+		v = doc["resume"];
+		if (v != nullptr) {
+			bootController.resumeMoving = strcmp(v, "moving") == 0;
+			bootController.isDirty = true;
+			dccPutSettings();
 		}
 
+	}
 
-		JsonDocument out;
 
-		out["type"] = "dccUI";
-		out["cmd"] = "hardware";
-		out["SSID"] = bootController.SSID;
-		out["pwd"] = bootController.pwd[0] == '\0' ? "none" : "*****";
-		out["STA_SSID"] = bootController.STA_SSID;
-		out["STA_pwd"] = bootController.STA_pwd[0] == '\0' ? "none" : "*****";
-		out["version"] = bootController.softwareVersion;
-		out["wsPort"] = bootController.wsPort;
-		out["wiPort"] = bootController.tcpPort;
-		out["IP"] = bootController.IP;
-		byte mac[6];
-		WiFi.macAddress(mac);
-		char buff[30];
-		sprintf(buff, "%02X:%02X:%02X:%02X:%02X:%02X", mac[5], mac[4], mac[3], mac[2], mac[1], mac[0]);
-		out["MAC"] = buff;
-		out["uptime"] = int(millis() / 1000);
-		out["clients"] = nsWiThrottle::clientCount();
-
-
-		if (restart) {
-			//we successfully wrote a new value and a restart is required
-			out["action"] = "success";
-			serializeJson(doc, Serial);
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
 
-			bootController.isDirty = true;
-			dccPutSettings();
-			sendJson(out);  //should complete via ints
-			delay(2000);
-			Serial.println(F("ESP restart required"));
-			//ESP.restart();
+	out["type"] = "dccUI";
+	out["cmd"] = "hardware";
+	out["SSID"] = bootController.SSID;
+	out["pwd"] = bootController.pwd[0] == '\0' ? "none" : "*****";
+	out["STA_SSID"] = bootController.STA_SSID;
+	out["STA_pwd"] = bootController.STA_pwd[0] == '\0' ? "none" : "*****";
+	out["version"] = bootController.softwareVersion;
+	out["wsPort"] = bootController.wsPort;
+	out["wiPort"] = bootController.tcpPort;
+	out["resume"] = bootController.resumeMoving ? "moving" : "stopped";
+	out["IP"] = bootController.IP;
+	byte mac[6];
+	WiFi.macAddress(mac);
+	char buff[30];
+	sprintf(buff, "%02X:%02X:%02X:%02X:%02X:%02X", mac[5], mac[4], mac[3], mac[2], mac[1], mac[0]);
+	out["MAC"] = buff;
+	out["uptime"] = int(millis() / 1000);
+	out["clients"] = nsWiThrottle::clientCount();
 
-			//this may not reliably restart the unit, someone on internet says...
-			//WiFi.forceSleepBegin(); wdt_reset(); ESP.restart(); while (1)wdt_reset();
-			//but there may be a bug - restart may not reliably work after an EEPROM write
 
-			//2020-12-14 a manual hard reset is required.  in the meantime, the server will display
-			//the values it just wrote to eeprom.
+	if (restart) {
+		//we successfully wrote a new value and a restart is required
+		out["action"] = "success";
+		serializeJson(doc, Serial);
 
+		bootController.isDirty = true;
+		dccFlushSettings();  //a restart follows, do not wait for the deferred write
+		sendJsonTo(num, out);  //should complete via ints
+		delay(2000);
+		Serial.println(F("ESP restart required"));
+		//ESP.restart();
 
-		}
+		//this may not reliably restart the unit, someone on internet says...
+		//WiFi.forceSleepBegin(); wdt_reset(); ESP.restart(); while (1)wdt_reset();
+		//but there may be a bug - restart may not reliably work after an EEPROM write
 
-		//did not change anything, no restart required
-		out["action"] = "poll";
-		trace(serializeJson(out, Serial);)
-			sendJson(out);
-
-	}
-
-	if (strcmp(cmd, "roster") == 0) {
-		//incoming loco roster-change messages contain an array.  if we find a value has changed, we act on it
-
-		//{ "type": "dccUI", "cmd" : "roster"}
-		//{"type": "dccUI", "cmd" : "roster", "locos" : [{ "slot": 0, "address" : 3, "useLong" : false, "use128" : true, "name" : "", "inUse" : false },{ "slot": 1, "address" : 4, "useLong" : false, "use128" : true, "name" : "ivor","inUse" : true }]}
-
-		//JSON 7 conversion.  this is more complex, we have a nested array we need to deserialise
-		//I simply deleted the & from &array
-		//ERROR.  this causes the device to crash.  we are not handling the deserialisation of embedded locos correctly.
-		//OK: { "type": "dccUI", "cmd" : "roster"} does dump out a correctly serialised message
-		/* I see this response
-
-
-		{"type":"dccUI","cmd":"roster","locos":[{"slot":0,"address":3,"useLong":false,"use128":false,"inUse":false,"name":""},
-		{"slot":1,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""},
-		{"slot":2,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""},
-		...
-		{"slot":7,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""}]}
-		*/
-
-
-		//2024-4-25 rewrite for JSON 7
-		int i = 0;
-		for (JsonObject locoFromUser : doc["locos"].as<JsonArray>()) {
-
-			int loco_slot = locoFromUser["slot"]; // 0, 1, 2, 7
-			int loco_address = locoFromUser["address"]; // 3, 0, 0, 0
-			bool loco_useLong = locoFromUser["useLong"]; // false, false, false, false
-			bool loco_use128 = locoFromUser["use128"]; // false, false, false, false
-			bool loco_inUse = locoFromUser["inUse"]; // false, false, false, false
-			const char* loco_name = locoFromUser["name"]; // nullptr, nullptr, nullptr, nullptr
-
-		//ignore any unchanged roster entries
-			if (!changeToSlot(i, loco_address, loco_useLong, loco_use128, loco_name)) { i++;continue; }
-
-			{	//changes were made
-				trace(Serial.printf("loco change on %d\r\n", i);)
-				//to prevent runaway locos, you cannot modify a slot if loco is moving or is under control of a WiThrottle.
-				if ((loco[i].speed > 0) || (loco[i].consistID != 0)) continue;
-
-
-				if (loco_address == 0) {
-					//2021-10-02 don't allow the one remaining slot to be deleted. we must always have at least
-					//one loco in the DSKY.  Also what if the DSKY was pointed at slot 2 and that is now deleted?
-					//if it defaults to slot 0, will that be available?  maybe we just never allow deletion of slot zero
-					int8_t activeSlots = 0;
-					for (auto loc : loco) {
-						if (loc.address != 0) activeSlots++;
-					}
-					//exit if this is the last active slot
-					if (activeSlots == 1) continue;
-					//otherwise clear the slot
-					loco[i].address = 0;
-					loco[i].forward = true;
-					loco[i].use128 = false;
-					memset(loco[i].name, '\0', sizeof(loco[i].name));
-					loco[i].consistID = 0;
-					loco[i].speed = 0;
-					continue;
-				}
+		//2020-12-14 a manual hard reset is required.  in the meantime, the server will display
+		//the values it just wrote to eeprom.
 
-				//look for address with short/long flag.  expect to find it in self-slot
-				//if it exists in another slot then ignore it as we don't wish to create a dupe
-				//else write it
-				int j = 0;
-				for (auto loc : loco) {
-					if ((loc.useLongAddress == loco_useLong) && (loc.address == loco_address)) break;
-					++j;
-				}
-				//we exit either with j pointing at the address in a slot, or with j==MAX_LOCOS indicating no match
 
-				//bail if loco exists in another slot
-				if ((j != MAX_LOCO) && (j != i)) continue;
+	}
+
+	//did not change anything, no restart required
+	out["action"] = "poll";
+	trace(serializeJson(out, Serial);)
+		sendJsonTo(num, out);
+}
+
+void nsDCCweb::wsRoster(uint8_t num, JsonDocument &doc) {
+	//incoming loco roster-change messages contain an array.  if we find a value has changed, we act on it
+
+	//{ "type": "dccUI", "cmd" : "roster"}
+	//{"type": "dccUI", "cmd" : "roster", "locos" : [{ "slot": 0, "address" : 3, "useLong" : false, "use128" : true, "name" : "", "inUse" : false },{ "slot": 1, "address" : 4, "useLong" : false, "use128" : true, "name" : "ivor","inUse" : true }]}
+
+	//JSON 7 conversion.  this is more complex, we have a nested array we need to deserialise
+	//I simply deleted the & from &array
+	//ERROR.  this causes the device to crash.  we are not handling the deserialisation of embedded locos correctly.
+	//OK: { "type": "dccUI", "cmd" : "roster"} does dump out a correctly serialised message
+	/* I see this response
 
-				//at this point address was unchanged (j==i) or it does not exist in any slot (j==MAX_LOCO) 
-				//For new and unchanged, write back all params to loco[i];
 
-				//validate the address
-				if (loco_address < 1) { i++; continue; }
-				if (loco_address > 10239) { i++;continue; }
+	{"type":"dccUI","cmd":"roster","locos":[{"slot":0,"address":3,"useLong":false,"use128":false,"inUse":false,"name":""},
+	{"slot":1,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""},
+	{"slot":2,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""},
+	...
+	{"slot":7,"address":0,"useLong":false,"use128":false,"inUse":false,"name":""}]}
+	*/
 
-				//proceed
+
+	//2024-4-25 rewrite for JSON 7
+	int i = 0;
+	for (JsonObject locoFromUser : doc["locos"].as<JsonArray>()) {
+
+		int loco_slot = locoFromUser["slot"]; // 0, 1, 2, 7
+		int loco_address = locoFromUser["address"]; // 3, 0, 0, 0
+		bool loco_useLong = locoFromUser["useLong"]; // false, false, false, false
+		bool loco_use128 = locoFromUser["use128"]; // false, false, false, false
+		bool loco_inUse = locoFromUser["inUse"]; // false, false, false, false
+		const char* loco_name = locoFromUser["name"]; // nullptr, nullptr, nullptr, nullptr
+
+	//ignore any unchanged roster entries
+		if (!changeToSlot(i, loco_address, loco_useLong, loco_use128, loco_name)) { i++;continue; }
+
+		{	//changes were made
+			trace(Serial.printf("loco change on %d\r\n", i);)
+			//to prevent runaway locos, you cannot modify a slot if loco is moving or is under control of a WiThrottle.
+			if ((loco[i].speed > 0) || (loco[i].consistID != 0)) continue;
+
+			if (loco_address == 0) {
+				//2021-10-02 don't allow the one remaining slot to be deleted. we must always have at least
+				//one loco in the DSKY.  Also what if the DSKY was pointed at slot 2 and that is now deleted?
+				//if it defaults to slot 0, will that be available?  maybe we just never allow deletion of slot zero
+				int8_t activeSlots = 0;
+				for (auto loc : loco) {
+					if (loc.address != 0) activeSlots++;
+				}
+				//exit if this is the last active slot
+				if (activeSlots == 1) continue;
+				//otherwise clear the slot.  2026-10-19 the loco leaving stays in the flash roster
+				nsLocoRoster::release(i);
+				loco[i].address = 0;
 				loco[i].forward = true;
-				loco[i].speed = 0;
-				loco[i].consistID = 0;
-				loco[i].address = loco_address;
-				loco[i].useLongAddress = loco_useLong;
-				if (loco_address > 127) loco[i].useLongAddress = true;
-				loco[i].use128 = loco_use128;
+				loco[i].use128 = false;
 				memset(loco[i].name, '\0', sizeof(loco[i].name));
-				strncpy(loco[i].name, loco_name, sizeof(loco[i].name));
+				loco[i].consistID = 0;
+				loco[i].speed = 0;
 				bootController.isDirty = true;
-				trace(Serial.printf("slot %d updated\n\r", i);)
-					i++;
+				continue;
 			}
-		}
-		if (bootController.isDirty) bootController.flagLocoRoster = true;
-		dccPutSettings();
-
 
-		//done with changes, now generate an output
-		JsonDocument out;
-		out["type"] = "dccUI";
-		out["cmd"] = "roster";
-		JsonArray slots = out["locos"].to<JsonArray>();
-		
-		i = 0;
-		for (auto loc : loco) {
-			JsonDocument s;
-			s["slot"] = i++;
-			s["address"] = loc.address;
-			s["useLong"] = loc.useLongAddress;
-			s["use128"] = loc.use128;
-			//slot is in use if speed is >0 or a WiThrottle has taken it
-			s["inUse"] = loc.speed > 0 ? true : (loc.consistID != 0);
-			s["name"] = loc.name;
-			slots.add(s);
+			//look for address with short/long flag.  expect to find it in self-slot
+			//if it exists in another slot then ignore it as we don't wish to create a dupe
+			//else write it
+			int j = 0;
+			for (auto loc : loco) {
+				if ((loc.useLongAddress == loco_useLong) && (loc.address == loco_address)) break;
+				++j;
+			}
+			//we exit either with j pointing at the address in a slot, or with j==MAX_LOCOS indicating no match
+
+			//bail if loco exists in another slot
+			if ((j != MAX_LOCO) && (j != i)) continue;
+
+			//at this point address was unchanged (j==i) or it does not exist in any slot (j==MAX_LOCO) 
+			//For new and unchanged, write back all params to loco[i];
+
+			//validate the address
+			if (loco_address < 1) { i++; continue; }
+			if (loco_address > 10239) { i++;continue; }
+
+			//proceed.  2026-10-19 a different loco in this slot, the one leaving stays in the flash roster
+			if (j != i) nsLocoRoster::release(i);
+			loco[i].forward = true;
+			loco[i].speed = 0;
+			loco[i].consistID = 0;
+			loco[i].address = loco_address;
+			loco[i].useLongAddress = loco_useLong;
+			if (loco_address > 127) loco[i].useLongAddress = true;
+			loco[i].use128 = loco_use128;
+			memset(loco[i].name, '\0', sizeof(loco[i].name));
+			strncpy(loco[i].name, loco_name, sizeof(loco[i].name));
+			bootController.isDirty = true;
+			trace(Serial.printf("slot %d updated\n\r", i);)
+				i++;
 		}
+	}
+	if (bootController.isDirty) locoRosterChanged();
+	dccPutSettings();
 
-		trace(serializeJsonPretty(out, Serial);)
 
-			sendJson(out);
+	//done with changes, now send the roster from the cache
+	sendText(locoRosterJson(), TOPIC_ROSTER);
 
 #ifdef _WITHROTTLE_h
-		nsWiThrottle::broadcastLocoRoster(nullptr);
+	nsWiThrottle::broadcastLocoRoster(nullptr);
 #endif
+}
 
-	}
-
-	//turnout roster
-	if (strcmp(cmd, "turnout") == 0) {
-		//incoming turnout roster-change messages contain an array.  if we find a value has changed, we act on it
-		//example update {"type": "dccUI", "cmd": "turnout", "turnouts": [{ "slot": 0, "address": 3, "state": "closed", "name":"siding 1"},{ "slot": 1, "address" : 4, "state" : "thrown", "name" : "ivor"}] }
+void nsDCCweb::wsTurnout(uint8_t num, JsonDocument &doc) {
+	//incoming turnout roster-change messages contain an array.  if we find a value has changed, we act on it
+	//example update {"type": "dccUI", "cmd": "turnout", "turnouts": [{ "slot": 0, "address": 3, "state": "closed", "name":"siding 1"},{ "slot": 1, "address" : 4, "state" : "thrown", "name" : "ivor"}] }
 
-		/*{"type": "dccUI", "cmd": "turnout"} obtains this response
-		{"type":"dccUI","cmd":"turnout","turnouts":[{"slot":0,"address":0,"name":"","state":"closed"},
-		{"slot":1,"address":0,"name":"","state":"closed"},
-		{"slot":2,"address":0,"name":"","state":"closed"},
-		...
-		{"slot":7,"address":0,"name":"","state":"closed"}]}
-		*/
+	/*{"type": "dccUI", "cmd": "turnout"} obtains this response
+	{"type":"dccUI","cmd":"turnout","turnouts":[{"slot":0,"address":0,"name":"","state":"closed"},
+	{"slot":1,"address":0,"name":"","state":"closed"},
+	{"slot":2,"address":0,"name":"","state":"closed"},
+	...
+	{"slot":7,"address":0,"name":"","state":"closed"}]}
+	*/
 
-		//2024-4-25 rewrite this block for JSON 7
-		//https://arduinojson.org/v7/tutorial/deserialization/
-		//IMPORTANT: when iterating as<JsonArray> you need to explicitly cast the nodes you interrogate
+	//2024-4-25 rewrite this block for JSON 7
+	//https://arduinojson.org/v7/tutorial/deserialization/
+	//IMPORTANT: when iterating as<JsonArray> you need to explicitly cast the nodes you interrogate
 
-		//loop for all turnout objects
-		int i = 0;
+	//loop for all turnout objects
+	int i = 0;
 
 #ifdef ignore_this  
-		//test block
-		for (JsonObject turnoutFromUser : doc["turnouts"].as<JsonArray>()) {
-			//odd, it does not do auto type casting
-			int turnout_slot = turnoutFromUser["slot"]; // 0, 1, 2, 7
-			int turnout_address = turnoutFromUser["address"]; // 0, 0, 0, 0
-			const char* turnout_name = turnoutFromUser["name"]; // nullptr, nullptr, nullptr, nullptr
-			const char* turnout_state = turnoutFromUser["state"]; // "closed", "closed", "closed", "closed"
+	//test block
+	for (JsonObject turnoutFromUser : doc["turnouts"].as<JsonArray>()) {
+		//odd, it does not do auto type casting
+		int turnout_slot = turnoutFromUser["slot"]; // 0, 1, 2, 7
+		int turnout_address = turnoutFromUser["address"]; // 0, 0, 0, 0
+		const char* turnout_name = turnoutFromUser["name"]; // nullptr, nullptr, nullptr, nullptr
+		const char* turnout_state = turnoutFromUser["state"]; // "closed", "closed", "closed", "closed"
 
-			Serial.printf("slot %d name %s\n\r", turnout_slot, turnout_name);
+		Serial.printf("slot %d name %s\n\r", turnout_slot, turnout_name);
 
-		}
+	}
 #endif
 
-		for (JsonObject turnoutFromUser : doc["turnouts"].as<JsonArray>()) {
-			if (i >= MAX_TURNOUT) break;
+	for (JsonObject turnoutFromUser : doc["turnouts"].as<JsonArray>()) {
+		if (i >= MAX_TURNOUT) break;
 
-			uint turnout_slot = turnoutFromUser["slot"];
-			uint turnout_address = turnoutFromUser["address"];
-			const char* turnout_name = turnoutFromUser["name"];
-			const char* turnout_state = turnoutFromUser["state"];
+		uint turnout_slot = turnoutFromUser["slot"];
+		uint turnout_address = turnoutFromUser["address"];
+		const char* turnout_name = turnoutFromUser["name"];
+		const char* turnout_state = turnoutFromUser["state"];
 
-			if (!changeToTurnout(i, turnout_address, turnout_name)) {
-				//if turnout entry appears unchanged, check the state as user may have issued a command to toggle this
-				bool newState = (strcmp(turnout_state, "thrown") == 0);
-				if (turnout[i].thrown != newState) {
-					turnout[i].thrown = newState;
-					turnout[i].changeFlag = true;
-				}
-				//this function always sends the roster back to the webclient even if no changes were made
-				//therefore the updated states will show
-				i++;
-				continue;
+		if (!changeToTurnout(i, turnout_address, turnout_name)) {
+			//if turnout entry appears unchanged, check the state as user may have issued a command to toggle this
+			bool newState = (strcmp(turnout_state, "thrown") == 0);
+			if (turnout[i].thrown != newState) {
+				nsDCCbus::setTurnout(i, turnout[i].address, newState ? 1 : 0, nsDCCbus::BUS_WEB);
 			}
+			//this function always sends the roster back to the webclient even if no changes were made
+			//therefore the updated states will show
+			i++;
+			continue;
+		}
 
-			trace(Serial.printf("turnout change on %d\r\n", i);)
-				if (turnout_address == 0) {
-					//clear the turnout slot
-					turnout[i].address = 0;
-					memset(turnout[i].name, '\0', sizeof(turnout[i].name));
-					turnout[i].thrown = false;
-					turnout[i].selected = false;
-					continue;
-				}
+		trace(Serial.printf("turnout change on %d\r\n", i);)
+			if (turnout_address == 0) {
+				//clear the turnout slot
+				turnout[i].address = 0;
+				memset(turnout[i].name, '\0', sizeof(turnout[i].name));
+				turnout[i].thrown = false;
+				turnout[i].selected = false;
+				bootController.isDirty = true;
+				continue;
+			}
 
 
-			//look for address. expect to find it in self-slot
-			//if it exists in another slot then ignore it as we don't wish to create a dupe
-			//else write it
-			int j = 0;
-			for (auto t : turnout) {
-				if (t.address == turnout_address) break;
-				++j;
-			}
-			//we exit either with j pointing at the address in a slot, or with j==MAX_TURNOUTS indicating no match
+		//look for address. expect to find it in self-slot
+		//if it exists in another slot then ignore it as we don't wish to create a dupe
+		//else write it
+		int j = 0;
+		for (auto t : turnout) {
+			if (t.address == turnout_address) break;
+			++j;
+		}
+		//we exit either with j pointing at the address in a slot, or with j==MAX_TURNOUTS indicating no match
 
-			//bail if turnout exists in another slot
-			if ((j != MAX_TURNOUT) && (j != i)) continue;
+		//bail if turnout exists in another slot
+		if ((j != MAX_TURNOUT) && (j != i)) continue;
 
-			//procceed, validate the address
-			if (turnout_address < 1) continue;
-			if (turnout_address > 1024) continue;
+		//procceed, validate the address
+		if (turnout_address < 1) continue;
+		if (turnout_address > 1024) continue;
 
-			//proceed
-			turnout[i].address = turnout_address;
+		//proceed
+		turnout[i].address = turnout_address;
 
-			memset(turnout[i].name, '\0', sizeof(turnout[i].name));
-			strncpy(turnout[i].name, turnout_name, sizeof(turnout[i].name));
-			bootController.isDirty = true;
-			trace(Serial.printf("turnout slot %d updated\n\r", i);)
-				i++;
+		memset(turnout[i].name, '\0', sizeof(turnout[i].name));
+		strncpy(turnout[i].name, turnout_name, sizeof(turnout[i].name));
+		bootController.isDirty = true;
+		trace(Serial.printf("turnout slot %d updated\n\r", i);)
+			i++;
 
-		}  //end loop through turnouts
+	}  //end loop through turnouts
 
-		dccPutSettings();
+	if (bootController.isDirty) turnoutRosterChanged();
+	dccPutSettings();
 
 #ifdef _WITHROTTLE_h
-		nsWiThrottle::broadcastTurnoutRoster(nullptr);
+	nsWiThrottle::broadcastTurnoutRoster(nullptr);
 #endif
 
 
-		//broadcast the turnout roster
-		JsonDocument out;
-		out["type"] = "dccUI";
-		out["cmd"] = "turnout";
-		JsonArray slots = out["turnouts"].to<JsonArray>();  
-		//https://arduinojson.org/v5/api/jsonobject/createnestedarray/
-		i = 0;
-		for (auto t : turnout) {
-			JsonDocument s;
-			s["slot"] = i++;
-			s["address"] = t.address;
-			s["name"] = t.name;
-			s["state"] = t.thrown ? "thrown" : "closed";
-			slots.add(s);
-		}
-
-		trace(serializeJson(out, Serial);)
-		sendJson(out);
-	}//end turnout
-
-	if (strcmp(cmd, "pom") == 0) {
-		//note to change a long address, send CV17 then CV18. It appears most decoders won't change either until both
-		//are received in sequence
-		//pom = { "type": "dccUI", "cmd": "pom", "action": "byte", "addr":"S3", "cvReg": 0, "cvVal": "B23" };
-		const char* action = doc["action"];
-		const char* addr = doc["addr"];
-		uint16_t cv_reg = doc["cvReg"];
-		const char* cv_val = doc["cvVal"];
-
+	//broadcast the turnout roster
+	sendText(turnoutRosterJson(), TOPIC_TURNOUT);
+}
 
-		if (action == nullptr) return;
-		if (addr == nullptr) return;
-		if (cv_val == nullptr) return;
+void nsDCCweb::wsPom(uint8_t num, JsonDocument &doc) {
+	//note to change a long address, send CV17 then CV18. It appears most decoders won't change either until both
+	//are received in sequence
+	//pom = { "type": "dccUI", "cmd": "pom", "action": "byte", "addr":"S3", "cvReg": 0, "cvVal": "B23" };
+	const char* action = doc["action"];
+	const char* addr = doc["addr"];
+	uint16_t cv_reg = doc["cvReg"];
+	const char* cv_val = doc["cvVal"];
 
-		//the required action is evident in cv_val without need to look at root.action
-		writePOMcommand(addr, cv_reg, cv_val);
 
-		JsonDocument out;
-		out["type"] = "dccUI";
-		out["cmd"] = "pom";
-		out["action"] = "ok";
-		sendJson(out);
-	}
+	if (action == nullptr) return;
+	if (addr == nullptr) return;
+	if (cv_val == nullptr) return;
 
-	if (strcmp(cmd, "service") == 0) {
+	//the required action is evident in cv_val without need to look at root.action
+	nsDCCbus::writePOM(addr, cv_reg, cv_val, nsDCCbus::BUS_WEB);
 
-		//service mode, but will only support byte writes and verifies
-		//var service = { "type": "dccUI", "cmd" : "sevice", "reg" : 12, "value" : 13, "action" : "read" };
-		//action is read|direct|exit|enter|result  direct=byte write in direct mode, and  is the only mode supported
-		//exit is used to leave service mode and restore full power, is generated when you click on a link
-		//entry to service mode will send eStop.
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "dccUI";
+	out["cmd"] = "pom";
+	out["action"] = "ok";
+	sendJson(out, TOPIC_SERVICE);
+}
 
-		const char* action = doc["action"];
-		uint16_t cv_reg = doc["cvReg"];
-		uint8_t cv_val = doc["cvVal"];
+void nsDCCweb::wsService(uint8_t num, JsonDocument &doc) {
+	//service mode, but will only support byte writes and verifies
+	//var service = { "type": "dccUI", "cmd" : "sevice", "reg" : 12, "value" : 13, "action" : "read" };
+	//action is read|direct|exit|enter|result  direct=byte write in direct mode, and  is the only mode supported
+	//exit is used to leave service mode and restore full power, is generated when you click on a link
+	//entry to service mode will send eStop.
 
-		if (action == nullptr) return;
+	const char* action = doc["action"];
+	uint16_t cv_reg = doc["cvReg"];
+	uint8_t cv_val = doc["cvVal"];
 
-		if (strcmp(action, "enter") == 0) {
-			//enter service mode, will send estop to all locos and set a 250mA trip threshold
+	if (action == nullptr) return;
 
-			//causes exception 29
-			//from WS: {"type":"dccUI","cmd":"service","reg":0,"value":-1,"action":"enter"}
-			writeServiceCommand(0, 0, false, true, false);
-		}
+	if (strcmp(action, "enter") == 0) {
+		//enter service mode, will send estop to all locos and set a 250mA trip threshold
 
-		//if you fail to exit SM, service.mode wll be true which limits power
-		//to confirm, if you invoke dccSE=service i think it stays in this mode (service idle)
-		//until you chose to exit
-		if (strcmp(action, "exit") == 0) {
-			//exit service mode, returns to full power
-			Serial.println("svc#4");
-			writeServiceCommand(0, 0, false, false, true);
-		}
+		//causes exception 29
+		//from WS: {"type":"dccUI","cmd":"service","reg":0,"value":-1,"action":"enter"}
+		nsDCCbus::service(nsDCCbus::SVC_ENTER, 0, 0, nsDCCbus::BUS_WEB);
+	}
 
-		if (strcmp(action, "direct") == 0) {
-			//direct write
-			if (cv_val == 0) return;
-			writeServiceCommand(cv_reg, cv_val, false, false, false);
-		}
+	//if you fail to exit SM, service.mode wll be true which limits power
+	//to confirm, if you invoke dccSE=service i think it stays in this mode (service idle)
+	//until you chose to exit
+	if (strcmp(action, "exit") == 0) {
+		//exit service mode, returns to full power
+		Serial.println("svc#4");
+		nsDCCbus::service(nsDCCbus::SVC_EXIT, 0, 0, nsDCCbus::BUS_WEB);
+	}
 
-		if (strcmp(action, "read") == 0) {
-			//call once to iniate a read. the result is provided via a callback
-			if (cv_reg == 0) return;
-			writeServiceCommand(cv_reg, 0, true, false, false);
-		}
-		return;
+	if (strcmp(action, "direct") == 0) {
+		//direct write
+		if (cv_val == 0) return;
+		nsDCCbus::service(nsDCCbus::SVC_DIRECT, cv_reg, cv_val, nsDCCbus::BUS_WEB);
 	}
 
+	if (strcmp(action, "read") == 0) {
+		//call once to iniate a read. the result is provided via a callback
+		if (cv_reg == 0) return;
+		nsDCCbus::service(nsDCCbus::SVC_READ, cv_reg, 0, nsDCCbus::BUS_WEB);
+	}
+	return;
 }
 
 
 
 
+
 /// <summary>
 /// Check parameters against a nominated loco slot
 /// </summary>
@@ -899,7 +1336,9 @@ bool nsDCCweb::changeToTurnout(uint8_t slot, const char* addr, const char* name)
 
 //transmit current power status over websocket
 void nsDCCweb::broadcastPower(void) {
-	JsonDocument out;
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
 
 	out["type"] = "dccUI";
 	out["cmd"] = "power";
@@ -909,36 +1348,63 @@ void nsDCCweb::broadcastPower(void) {
 	out["track"] = power.trackPower;
 	out["mA_limit"] = bootController.currentLimit;
 	out["V_limit"] = bootController.voltageLimit;
+	out["SM"] = power.serviceMode;
 
-	sendJson(out);
+	sendJson(out, TOPIC_POWER);
 }
 
 
 
-void nsDCCweb::setPower(bool powerOn) {
-	if (powerOn) {
-		/*turn on track power*/
-		power.trip = false;
-		power.trackPower = true;
-		}
-	else {
-		/*turn off track power*/
-		power.trackPower = false;
-		power.trip = false;
+/*2026-10-19 called by DCCcore on each 10mS tick once the current sample is taken.  Power is only reported in
+json every 2 sec, whereas here each sample is kept and pushed in binary frames of TELEMETRY_BATCH to the
+websocket clients that opted in, 8 bytes per sample.  Nothing is done when no client has opted in.
+If the main loop has not sent the previous frame by the time this one fills, the older is dropped*/
+void nsDCCweb::telemetrySample(void) {
+	if (!topicInUse(TOPIC_TELEMETRY)) return;
+
+	TELEMETRYFRAME &f = m_tele[m_teleFill];
+	uint32_t now = millis();
+	if (f.h.count == 0) {
+		f.h.magic = 'T';
+		f.h.seq = m_teleSeq++;
+		f.h.t0 = now;
+	}
+	TELEMETRYSAMPLE &t = f.s[f.h.count];
+	t.dt = now - f.h.t0;
+	t.mA = power.bus_mA < 0 ? 0 : (power.bus_mA > 65535 ? 65535 : (uint16_t)power.bus_mA);
+	t.cV = power.bus_volts < 0 ? 0 : (uint16_t)(power.bus_volts * 100);
+	t.flags = (power.trip ? TELEMETRY_TRIP : 0) | (power.trackPower ? TELEMETRY_TRACK : 0) |
+		(power.serviceMode ? TELEMETRY_SM : 0) | (power.ackFlag ? TELEMETRY_ACK : 0);
+	t.spare = 0;
+	if (++f.h.count < TELEMETRY_BATCH) return;
+
+	m_teleReady[m_teleFill] = true;
+	m_teleFill ^= 1;
+	if (m_teleReady[m_teleFill]) {
+		m_teleReady[m_teleFill] = false;
+		++m_teleDropped;
 	}
+	m_tele[m_teleFill].h.count = 0;
+}
 
-	{//block scope
-		//using namespace nsWiThrottle;
-		nsWiThrottle::broadcastPower();
-		//do we need this or is the broadcast message regularly sent anyway?
+/*push the completed frame to the opted in clients.  only the buffer not being filled can be ready*/
+void nsDCCweb::telemetrySend(void) {
+	uint8_t b = m_teleFill ^ 1;
+	if (!m_teleReady[b]) return;
+	size_t len = sizeof(TELEMETRYHDR) + m_tele[b].h.count * sizeof(TELEMETRYSAMPLE);
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		if (m_topics[n] & TOPIC_TELEMETRY) webSocket->sendBIN(n, (const uint8_t*)&m_tele[b], len);
 	}
+	m_teleReady[b] = false;
 }
 
 
 //send CV read result message
 void nsDCCweb::broadcastReadResult(uint16_t cvReg, int16_t cvVal) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
 	//this routine is a callback from DCCcore
-	JsonDocument out;
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
 
 	out["type"] = "dccUI";
 	out["cmd"] = "service";
@@ -948,7 +1414,7 @@ void nsDCCweb::broadcastReadResult(uint16_t cvReg, int16_t cvVal) {
 	out["cvVal"] = cvVal;
 	trace(serializeJsonPretty(out, Serial);)
 
-		sendJson(out);
+		sendJson(out, TOPIC_SERVICE);
 }
 
 //evaluate char array for 'true' keyword
@@ -959,63 +1425,100 @@ bool nsDCCweb::cBool(const char* v) {
 
 
 //broadcast any turnout changes that occurred outside of this module
+//2026-10-19 only the slots that differ from what browsers were last sent go out, as locoDelta and turnoutDelta
+//messages carrying just the changed fields.  Each carries a sequence number, a page that sees a gap asks for
+//the full roster
 void nsDCCweb::broadcastChanges(void) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
 
+	//binary telemetry frames that are complete
+	telemetrySend();
 
-	//if the loco roster has changed, send it
-	if (bootController.flagLocoRoster) {
+	//if the loco roster has changed, send the changed slots. inUse follows speed rather than the roster flag
+	uint32_t mask = locoInUseMask();
+	if (bootController.flagLocoRoster || mask != m_locoSentMask) {
 		trace(Serial.println(F("nsDCCweb::broadcastChanges"));)
-			JsonDocument out;
-		out["type"] = "dccUI";
-		out["cmd"] = "roster";
-		JsonArray slots = out["locos"].to<JsonArray>();
-
-		int i = 0;
-		for (auto loc : loco) {
-			JsonDocument s;
-			s["slot"] = i++;
-			s["address"] = loc.address;
-			s["useLong"] = loc.useLongAddress;
-			s["use128"] = loc.use128;
-			//slot is in use if speed is >0 or a WiThrottle has taken it
-			s["inUse"] = loc.speed > 0 ? true : (loc.consistID != 0);
-			s["name"] = loc.name;
-			slots.add(s);
+		for (int i = 0; i < MAX_LOCO; ++i) {
+			LOCO &loc = loco[i];
+			LOCOSENT &was = m_locoSent[i];
+			bool inUse = (mask & (1UL << i)) != 0;
+			if (loc.address == was.address && loc.useLongAddress == was.useLong && loc.use128 == was.use128
+				&& inUse == was.inUse && strncmp(loc.name, was.name, sizeof(was.name)) == 0) continue;
+
+			nsJsonArena::SCOPE arena;
+			JsonDocument out(nsJsonArena::allocator());
+			out["type"] = "dccUI";
+			out["cmd"] = "locoDelta";
+			out["seq"] = ++m_locoSeq;
+			out["slot"] = i;
+			if (loc.address != was.address) out["address"] = loc.address;
+			if (loc.useLongAddress != was.useLong) out["useLong"] = loc.useLongAddress;
+			if (loc.use128 != was.use128) out["use128"] = loc.use128;
+			if (inUse != was.inUse) out["inUse"] = inUse;
+			if (strncmp(loc.name, was.name, sizeof(was.name)) != 0) out["name"] = loc.name;
+			sendJson(out, TOPIC_ROSTER);
+
+			was.address = loc.address;
+			was.useLong = loc.useLongAddress;
+			was.use128 = loc.use128;
+			was.inUse = inUse;
+			strncpy(was.name, loc.name, sizeof(was.name));
 		}
-		sendJson(out);
+		m_locoSentMask = mask;
 	}
 
 
-	//if the turnout roster has changed, send it
+	//if the turnout roster or any turnout state has changed, send the changed slots
 	int i;
 	if (!bootController.flagTurnoutRoster) {
-		//if there's a turnout state change, also send the roster
 		for (i = 0;i < MAX_TURNOUT;i++) {
 			if (turnout[i].changeFlag) break;
 		}
 		if (i >= MAX_TURNOUT) return;
 	}
 
+	for (i = 0; i < MAX_TURNOUT; ++i) {
+		TURNOUT &t = turnout[i];
+		TURNOUTSENT &was = m_turnoutSent[i];
+		if (t.address == was.address && t.thrown == was.thrown && strncmp(t.name, was.name, sizeof(was.name)) == 0) continue;
 
-	//send the turnout roster
-	JsonDocument out;
-	out["type"] = "dccUI";
-	out["cmd"] = "turnout";
-	JsonArray slots = out["turnouts"].to<JsonArray>();
-
-	i = 0;
-	for (auto t : turnout) {
-		JsonDocument s;
-		s["slot"] = i++;
-		s["address"] = t.address;
-		s["name"] = t.name;
-		s["state"] = t.thrown ? "thrown" : "closed";
-		slots.add(s);
+		//{"type":"dccUI","cmd":"turnoutDelta","seq":12,"slot":3,"state":"thrown"}
+		nsJsonArena::SCOPE arena;
+		JsonDocument out(nsJsonArena::allocator());
+		out["type"] = "dccUI";
+		out["cmd"] = "turnoutDelta";
+		out["seq"] = ++m_turnoutSeq;
+		out["slot"] = i;
+		if (t.address != was.address) out["address"] = t.address;
+		if (strncmp(t.name, was.name, sizeof(was.name)) != 0) out["name"] = t.name;
+		if (t.thrown != was.thrown) out["state"] = t.thrown ? "thrown" : "closed";
+		sendJson(out, TOPIC_TURNOUT);
+
+		was.address = t.address;
+		was.thrown = t.thrown;
+		strncpy(was.name, t.name, sizeof(was.name));
 	}
-	sendJson(out);
 
 }
 
+/*record the current rosters as sent, without sending anything*/
+void nsDCCweb::syncSent(void) {
+	uint32_t mask = locoInUseMask();
+	for (int i = 0; i < MAX_LOCO; ++i) {
+		m_locoSent[i].address = loco[i].address;
+		m_locoSent[i].useLong = loco[i].useLongAddress;
+		m_locoSent[i].use128 = loco[i].use128;
+		m_locoSent[i].inUse = (mask & (1UL << i)) != 0;
+		strncpy(m_locoSent[i].name, loco[i].name, sizeof(m_locoSent[i].name));
+	}
+	m_locoSentMask = mask;
+	for (int i = 0; i < MAX_TURNOUT; ++i) {
+		m_turnoutSent[i].address = turnout[i].address;
+		m_turnoutSent[i].thrown = turnout[i].thrown;
+		strncpy(m_turnoutSent[i].name, turnout[i].name, sizeof(m_turnoutSent[i].name));
+	}
+}
+
 
 #pragma endregion
 
@@ -11,7 +11,8 @@
 
 #include "Global.h"
 #include <ArduinoJson.h>   //from arduino library manager.  you want VERSION 7 only!
-#include <ESP8266WebServer.h>
+#include "JsonArena.h"
+#include "HttpServer.h"
 #include <LittleFS.h>   
 #include <WebSockets.h>  //from arduino library manager. Markus Sattler 
 #include <WebSocketsServer.h>
@@ -21,21 +22,105 @@
 
 namespace nsDCCweb {
 
+	/*2026-10-19 roster slots as last broadcast, deltas are generated against these*/
+	struct LOCOSENT {
+		uint16_t address;
+		bool useLong;
+		bool use128;
+		bool inUse;
+		char name[9];
+	};
+
+	struct TURNOUTSENT {
+		uint16_t address;
+		bool thrown;
+		char name[9];
+	};
+
+	/*2026-10-19 websocket topics.  broadcasts go only to clients subscribed to the topic, see "subscribe".
+	A client that has not subscribed gets TOPIC_DEFAULT, as before topics existed*/
+#define TOPIC_POWER		0x01
+#define TOPIC_ROSTER	0x02
+#define TOPIC_TURNOUT	0x04
+#define TOPIC_SERVICE	0x08  //service mode and POM results
+#define TOPIC_TELEMETRY	0x10  //binary, opt in only
+#define TOPIC_DEFAULT	(TOPIC_POWER | TOPIC_ROSTER | TOPIC_TURNOUT | TOPIC_SERVICE)
+
+	/*2026-10-19 binary telemetry, see telemetrySample.  Little endian, a frame is TELEMETRYHDR followed by
+	count TELEMETRYSAMPLEs*/
+#define TELEMETRY_BATCH		10   //samples per frame, at one per 10mS this is 10 frames per sec
+#define TELEMETRY_TRIP		0x01
+#define TELEMETRY_TRACK		0x02
+#define TELEMETRY_SM		0x04  //service mode
+#define TELEMETRY_ACK		0x08  //service mode ack pulse detected
+
+	struct TELEMETRYHDR {
+		uint8_t magic;		//'T'
+		uint8_t count;
+		uint16_t seq;		//increments per frame, a gap means frames were dropped
+		uint32_t t0;		//millis() of the first sample
+	};
+
+	struct TELEMETRYSAMPLE {
+		uint16_t dt;		//mS after t0
+		uint16_t mA;
+		uint16_t cV;		//bus volts x100
+		uint8_t flags;
+		uint8_t spare;
+	};
+
+	struct TELEMETRYFRAME {
+		TELEMETRYHDR h;
+		TELEMETRYSAMPLE s[TELEMETRY_BATCH];
+	};
+
+	/*2026-10-19 websocket command costs, see DCCwebWS*/
+#define WS_MAX_PAYLOAD	2048  //longer text messages are discarded unparsed
+	struct WSSTATS {
+		uint32_t commands;
+		uint32_t unknown;		//unrecognised type or cmd
+		uint32_t rejected;		//too long or malformed
+		uint32_t max_us;		//parse and handle, longest
+		uint32_t maxParse_us;
+		uint32_t maxHeap;		//most arena held by a parsed doc
+	};
+
 	void startWebServices();
 	void loopWebServices(void);
 	void broadcastPower(void);
 	void broadcastReadResult(uint16_t cvReg, int16_t cvVal);
 	void broadcastChanges(void);
+	void sendJsonTo(uint8_t num, const JsonDocument &out);
+	void telemetrySample(void);
 
 	static void webSocketEvent(uint8_t num, WStype_t type, uint8_t * payload, size_t length);
-	static void DCCwebWS(JsonDocument doc);
-	static void sendJson(JsonObject& out);
-	static void sendJson(JsonDocument out);
+	static void DCCwebWS(uint8_t num, char *payload, size_t length);
+	static void buildFilters(void);
+	static bool jsonPeek(const char *payload, size_t length, const char *key, char *out, size_t outLen);
+	static void wsPower(uint8_t num, JsonDocument &doc);
+	static void wsSubscribe(uint8_t num, JsonDocument &doc);
+	static void wsTelemetry(uint8_t num, JsonDocument &doc);
+	static void wsHardware(uint8_t num, JsonDocument &doc);
+	static void wsRoster(uint8_t num, JsonDocument &doc);
+	static void wsTurnout(uint8_t num, JsonDocument &doc);
+	static void wsPom(uint8_t num, JsonDocument &doc);
+	static void wsService(uint8_t num, JsonDocument &doc);
+	static void wsHeapStats(uint8_t num, JsonDocument &doc);
+	static void wsLoco(uint8_t num, JsonDocument &doc);
+	static void wsTasks(uint8_t num, JsonDocument &doc);
+	static void telemetrySend(void);
+	static void sendJson(const JsonDocument &out, uint8_t topic);
+	static void sendText(const String &payload, uint8_t topic);
+	static bool topicInUse(uint8_t topic);
+	static uint8_t topicBit(const char *name);
+	static const String &locoRosterJson(void);
+	static const String &turnoutRosterJson(void);
+	static uint32_t locoInUseMask(void);
+	static void syncSent(void);
 	static bool changeToTurnout(uint8_t slot, uint16_t addr, const char* name);
 	static bool changeToTurnout(uint8_t slot, const char* addr, const char* name);
 	static bool changeToSlot(uint8_t slot, uint16_t address, bool useLong, bool use128, const char* name);
 	static bool changeToSlot(uint8_t slot, const char* addr, bool useLong, bool use128, const char* name);
-	static void setPower(bool powerOn);
 	static bool cBool(const char* v);
 	}
 
@@ -43,6 +43,10 @@ This system uses LittleFS, not SPIFFs
 #include "DCClayer1.h"
 #include "DCCweb.h"
 #include "WiThrottle.h"
+#include "JsonThrottle.h"
+#include "HeapStats.h"
+#include "RtcSnapshot.h"
+#include "Scheduler.h"
 
 
 
@@ -51,8 +55,45 @@ This system uses LittleFS, not SPIFFs
 //Had to switch to regular ints.  There is no conflict with Websockets
 
 
-uint16_t secCount;
-bool    bLED;
+
+
+/*2020-05-03 new approach to broadcasting changes over all channels.
+A change can occur on any comms channel, might be WiThrottle, Websockets or the local hardware UI
+Flags are set in the loco and turnout objects to denote the need to broadcast.
+These flags are cleared by the local UI updater as the last in sequence*/
+static void broadcastTask(void) {
+#ifdef _DCCWEB_h
+	nsDCCweb::broadcastChanges();
+	nsScheduler::serve();
+#endif
+
+#ifdef _JSONTHROTTLE_h
+	nsJsonThrottle::broadcastJSONchanges(false);
+	nsScheduler::serve();
+#endif
+
+#ifdef _WITHROTTLE_h
+	nsWiThrottle::broadcastChanges(false);
+	nsScheduler::serve();
+#endif
+
+	//broadcast turnout changes to line and clear the flags
+	updateLocalMachine();
+}
+
+/*send power status out every 2s.  2026-10-19 was counted off quarterSecFlag in loop()*/
+static void powerTask(void) {
+#ifdef _DCCWEB_h
+	nsDCCweb::broadcastPower();
+#endif
+
+#ifdef _JSONTHROTTLE_h
+	/*transmit power status to websocket*/
+	nsJsonThrottle::broadcastJsonPower();
+#endif
+
+	//2020-11-28 WiThrottles are not sent power status this frequently
+}
 
 
 void setup() {
@@ -93,73 +134,29 @@ void setup() {
 	nsWiThrottle::startThrottle();
 #endif
 
+	//2026-10-19 heap use from here on is attributed to subsystems, type heap on the serial console for a report
+	nsHeapStats::begin();
 
-} //end boot
-
-
-
-
-void loop() {
-
-#ifdef _DCCWEB_h
-		nsDCCweb::loopWebServices();   // constantly check for websocket events
-
-		/*2020-05-03 new approach to broadcasting changes over all channels.
-		A change can occur on any comms channel, might be WiThrottle, Websockets or the local hardware UI
-		Flags are set in the loco and turnout objects to denote the need to broadcast.
-		These flags are cleared by the local UI updater as the last in sequence*/
-
-		nsDCCweb::broadcastChanges();
-#endif
-
-#ifdef _JSONTHROTTLE_h
-		nsJsonThrottle::broadcastJSONchanges(false);
-#endif
-
-#ifdef _WITHROTTLE_h
-		nsWiThrottle::broadcastChanges(false);   
-#endif
+	//2026-10-19 runtime state to RTC memory from here on, restored by dccGetSettings after a warm reset
+	nsRtcSnapshot::begin();
 
-		//broadcast turnout changes to line and clear the flags
-		updateLocalMachine();
-		
-		//call DCCcore once per loop. We no longer use the return value
-		DCCcore();
-		
-
-	if (quarterSecFlag) {
-		/*isQuarterSecFlag will return true and also clear the flag*/
-		quarterSecFlag = false;
-
-		//2021-01-29 call processTimeout every 250mS to give better resolution over timeouts
-#ifdef _WITHROTTLE_h
-		nsWiThrottle::processTimeout();
-#endif
-		
-		secCount++;
-		if (secCount >= 8) {
-			/*toggle heartbeat LED, every 2s*/
-			bLED = !bLED;
-			secCount = 0;
-			
-			//send power status out to web sockets
+	//2026-10-19 the main loop is a set of scheduler tasks, see Scheduler.cpp.  period and deadline in mS, lower
+	//priority wins between equal deadlines.  The packet engine is served ahead of every task
+	nsScheduler::setPump(&dccPump);
+	nsScheduler::add("core", &dccTick, 10, 10, 0);
+	nsScheduler::add("broadcast", &broadcastTask, 20, 20, 1);
 #ifdef _DCCWEB_h
-			nsDCCweb::broadcastPower();
+	nsScheduler::add("web", &nsDCCweb::loopWebServices, 0, 20, 2);
 #endif
+	nsScheduler::add("power", &powerTask, 2000, 250, 3);
+	nsScheduler::add("console", &nsHeapStats::pollSerial, 50, 100, 4);
 
-#ifdef _JSONTHROTTLE_h
-			/*transmit power status to websocket*/
-			nsJsonThrottle::broadcastJsonPower();
-#endif
+} //end boot
 
-#ifdef _WITHROTTLE_h
-			/*transmit power status to WiThrottles*/
-			//2020-11-28 no need to do this so frequently
-			//nsWiThrottle::broadcastWiPower();
-#endif
-		}
 
 
-	}//qtr sec
 
+void loop() {
+	//2026-10-19 runs the packet engine and then the task that is due soonest, see setup()
+	nsScheduler::run();
 }
@@ -11,10 +11,10 @@
 
 //see DDCcore.h for IP address and websocket port
 
-/*Set Max loco and turnouts here. If you increase max loco or turnout, beware of exceeding the EEPROM dimensions*/
-/*and more importantly beware exceeding the JSON output buffer length, 800 is ok for 8 locos*/
-/*important: if you change max loco, change the software version date in DCCcore.h to force a wipe and reload of
-the EEPROM*/
+/*Set Max loco and turnouts here.*/
+/*2026-10-19 websocket JSON buffers are now sized per message, so the JSON output no longer limits max loco*/
+/*2026-10-19 settings are stored per slot in LittleFS, see DCCstore.cpp.  Changing max loco or turnout keeps the
+existing slots, there is no need to change the software version to force a wipe*/
 #define	MAX_LOCO	8   
 #define	MAX_TURNOUT	8
 #define LOCO_ESTOP_TIMEOUT 8
@@ -0,0 +1,151 @@
+//
+//
+//
+
+#include "HeapStats.h"
+#include "Scheduler.h"
+
+/*
+2026-10-19 heap instrumentation.  /hardware previously gave only the free heap, which cannot tell whether an
+unexpected reset after hours of use came from WiThrottle, the web side, json documents or a library.
+
+Each subsystem entry point opens a TAG.  The change in free heap between open and close is charged to that
+subsystem, so allocations made by libraries on its behalf, e.g. the websockets library within DCCweb, are
+included.  ESP.getFreeHeap is a read of a running total in umm_malloc, so a tag costs two reads and is left
+enabled.  Heap taken by code outside any tag, such as AsyncTCP callbacks not routed through a tagged
+function, is reported as untagged against the free heap recorded by begin().
+
+Largest free block and fragmentation walk the free list, so they are only read when sampling, every
+HEAP_SAMPLE_MS into a ring of HEAP_RING.  Available as the websocket command "heap" and on the serial
+console by typing heap.
+*/
+
+using namespace nsHeapStats;
+
+static HEAPUSE m_use[HEAP_TAGS];
+static uint8_t m_tagStack[HEAP_DEPTH];
+static uint32_t m_mark[HEAP_DEPTH];
+static uint8_t m_depth = 0;
+static uint32_t m_baseline = 0;
+
+static HEAPSAMPLE m_ring[HEAP_RING];
+static uint8_t m_head = 0;		//next sample written here
+static uint8_t m_count = 0;
+static nsTimerWheel::TIMER m_timer;
+
+static char m_console[HEAP_CONSOLE];
+static uint8_t m_consoleLen = 0;
+
+static const char *const m_names[HEAP_TAGS] = { "core", "withrottle", "dccweb", "json" };
+
+
+nsHeapStats::TAG::TAG(uint8_t tag) {
+	if (m_depth < HEAP_DEPTH && tag < HEAP_TAGS) {
+		m_tagStack[m_depth] = tag;
+		m_mark[m_depth] = ESP.getFreeHeap();
+	}
+	else if (m_depth < HEAP_DEPTH) {
+		m_tagStack[m_depth] = HEAP_TAGS;
+	}
+	++m_depth;
+}
+
+nsHeapStats::TAG::~TAG() {
+	--m_depth;
+	if (m_depth >= HEAP_DEPTH || m_tagStack[m_depth] >= HEAP_TAGS) return;
+	int32_t used = (int32_t)(m_mark[m_depth] - ESP.getFreeHeap());
+	HEAPUSE &u = m_use[m_tagStack[m_depth]];
+	u.held += used;
+	if (u.held > u.peak) u.peak = u.held;
+	++u.calls;
+	//the enclosing tag should not be charged for this
+	if (m_depth > 0) m_mark[m_depth - 1] -= used;
+}
+
+
+/*call once setup is complete, heap used before this is not attributed*/
+void nsHeapStats::begin(void) {
+	m_baseline = ESP.getFreeHeap();
+	sample();
+}
+
+/*take a ring sample, also called from the timer*/
+void nsHeapStats::sample(void) {
+	HEAPSAMPLE &s = m_ring[m_head];
+	uint32_t f = ESP.getFreeHeap();
+	uint32_t b = ESP.getMaxFreeBlockSize();
+	s.t = millis() / 1000;
+	s.freeHeap = f > 0xFFFF ? 0xFFFF : f;
+	s.maxBlock = b > 0xFFFF ? 0xFFFF : b;
+	s.frag = ESP.getHeapFragmentation();
+	s.spare = 0;
+	for (uint8_t i = 0; i < HEAP_TAGS; ++i) {
+		int32_t h = m_use[i].held;
+		s.held[i] = h > 32767 ? 32767 : (h < -32768 ? -32768 : h);
+	}
+	m_head = (m_head + 1) % HEAP_RING;
+	if (m_count < HEAP_RING) ++m_count;
+	nsTimerWheel::start(m_timer, HEAP_SAMPLE_MS, &sampleTimer, nullptr);
+}
+
+void nsHeapStats::sampleTimer(void *arg) {
+	sample();
+}
+
+const HEAPUSE &nsHeapStats::getUse(uint8_t tag) {
+	if (tag >= HEAP_TAGS) tag = HEAP_CORE;
+	return m_use[tag];
+}
+
+const char *nsHeapStats::tagName(uint8_t tag) {
+	return tag < HEAP_TAGS ? m_names[tag] : "";
+}
+
+/*heap used since begin() that no tag accounts for*/
+int32_t nsHeapStats::untagged(void) {
+	int32_t u = (int32_t)(m_baseline - ESP.getFreeHeap());
+	for (auto &h : m_use) {
+		u -= h.held;
+	}
+	return u;
+}
+
+uint8_t nsHeapStats::sampleCount(void) {
+	return m_count;
+}
+
+/*age 0 is the newest sample*/
+const HEAPSAMPLE &nsHeapStats::getSample(uint8_t age) {
+	if (age >= m_count) age = m_count > 0 ? m_count - 1 : 0;
+	return m_ring[(m_head + HEAP_RING - 1 - age) % HEAP_RING];
+}
+
+/*human readable report, oldest sample first*/
+void nsHeapStats::dump(Print &out) {
+	out.printf("heap free %u maxBlock %u frag %u%% untagged %d\r\n", ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(),
+		ESP.getHeapFragmentation(), untagged());
+	for (uint8_t i = 0; i < HEAP_TAGS; ++i) {
+		out.printf("  %-10s held %6d peak %6d calls %u\r\n", m_names[i], m_use[i].held, m_use[i].peak, m_use[i].calls);
+	}
+	out.printf("  sec     free  block frag   core  withr dccweb   json\r\n");
+	for (int16_t a = m_count - 1; a >= 0; --a) {
+		const HEAPSAMPLE &s = getSample(a);
+		out.printf("  %-6u %5u  %5u %3u%% %6d %6d %6d %6d\r\n", s.t, s.freeHeap, s.maxBlock, s.frag,
+			s.held[HEAP_CORE], s.held[HEAP_WITHROTTLE], s.held[HEAP_DCCWEB], s.held[HEAP_JSON]);
+	}
+}
+
+/*serial console, run as a scheduler task.  Type heap and press enter for the report, or tasks for the scheduler*/
+void nsHeapStats::pollSerial(void) {
+	while (Serial.available() > 0) {
+		char ch = Serial.read();
+		if (ch != '\r' && ch != '\n') {
+			if (m_consoleLen < HEAP_CONSOLE - 1) m_console[m_consoleLen++] = ch;
+			continue;
+		}
+		m_console[m_consoleLen] = '\0';
+		if (strcmp(m_console, "heap") == 0) dump(Serial);
+		else if (strcmp(m_console, SCHED_CONSOLE) == 0) nsScheduler::dump(Serial);
+		m_consoleLen = 0;
+	}
+}
@@ -0,0 +1,70 @@
+// HeapStats.h
+//Heap use attributed to subsystems, with free heap, largest block and fragmentation sampled into a ring
+
+#ifndef _HEAPSTATS_h
+#define _HEAPSTATS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "TimerWheel.h"
+
+namespace nsHeapStats {
+
+#define HEAP_SAMPLE_MS	300000  //5 minutes, the ring then covers 4 hours.  must be within the timer wheel range
+#define HEAP_RING		48
+#define HEAP_DEPTH		4       //nested tags that are tracked, deeper ones are ignored
+#define HEAP_CONSOLE	16      //serial console line
+
+	enum HEAPTAG {
+		HEAP_CORE,
+		HEAP_WITHROTTLE,
+		HEAP_DCCWEB,		//web server, websockets library and JsonThrottle
+		HEAP_JSON,			//ArduinoJson documents that did not fit the arena, and the static filters
+		HEAP_TAGS
+	};
+
+	/*net heap held by a subsystem.  Can go negative if it frees what another allocated*/
+	struct HEAPUSE {
+		int32_t held;
+		int32_t peak;
+		uint32_t calls;
+	};
+
+	struct HEAPSAMPLE {
+		uint32_t t;				//seconds since boot
+		uint16_t freeHeap;
+		uint16_t maxBlock;
+		uint8_t frag;			//percent
+		uint8_t spare;
+		int16_t held[HEAP_TAGS];	//clamped
+	};
+
+	/*open at the top of a subsystem entry point.  The heap taken or given back until it closes is charged
+	to the tag.  Tags nest, an inner tag's share is not also charged to the outer one*/
+	struct TAG {
+		explicit TAG(uint8_t tag);
+		~TAG();
+		TAG(const TAG&) = delete;
+		TAG &operator=(const TAG&) = delete;
+	};
+
+	/*function prototypes*/
+	void begin(void);
+	void sample(void);
+	void pollSerial(void);
+	void dump(Print &out);
+	const HEAPUSE &getUse(uint8_t tag);
+	const char *tagName(uint8_t tag);
+	int32_t untagged(void);
+	uint8_t sampleCount(void);
+	const HEAPSAMPLE &getSample(uint8_t age);
+
+	/*local scope, hence declared static*/
+	static void sampleTimer(void *arg);
+
+}
+#endif
@@ -0,0 +1,507 @@
+//
+//
+//
+
+#include "HttpServer.h"
+#include "Global.h"
+#include "WebAssets.h"
+#include "HeapStats.h"
+
+/*
+2026-10-19 replaces ESP8266WebServer.  That server streamed a whole file from handleClient(), so a 13k page
+held up loop() until the last byte had been acknowledged over WiFi and DCCcore did not run in that time.
+
+Here the request is assembled from AsyncTCP callbacks, and loop() hands at most HTTP_CHUNK bytes per connection
+to TCP on each call, limited also by the TCP window.  The remainder follows on later loops, so a page
+transfer is interleaved with the packet engine, keypad and throttles rather than blocking them.
+
+Only GET is supported.  Each reply carries Content-Length and the connection is closed once the reply is
+queued, as the pages make few requests.  Handlers registered with on() build a body which is streamed the
+same way as a file.
+
+2026-10-19 pages are also embedded in flash by tools/embed_assets.py, minified and gzipped, see WebAssets.h.
+These are served first with Content-Encoding: gzip and a strong ETag taken from the compressed bytes.
+Cache-Control: no-cache makes the browser revalidate on each navigation, and a matching If-None-Match
+is answered with a 304 and no body, so an unchanged page costs one short exchange.  A firmware update with
+changed pages changes the ETag.  Files not embedded, or a LittleFS copy if HTTP_FS_OVERRIDE is defined,
+are served from LittleFS as before.
+
+2026-10-19 generated replies that may be large, such as the roster, are streamed by a HTTPPRODUCER which writes
+the next piece straight into the chunk buffer on each loop, so no copy of the whole reply is held.  HTTP/1.1
+clients get Transfer-Encoding: chunked, HTTP/1.0 clients get the raw stream ended by the close.
+?fields=a,b on such a request limits the reply to those fields, see fieldWanted.
+
+2026-10-19 a connection that makes no progress for HTTP_IDLE_MS is aborted, whatever its state.  Progress is
+request bytes received, reply bytes handed to TCP, or an ack from the client, so a reply to a client that has
+stopped reading, or one that never acks the last bytes after the close, cannot hold an HTTPCONN for good.
+AsyncTCP's own ack timeout aborts too.
+
+getStats() reports the longest gap between loop() calls while a reply was in progress.  That is the worst-case
+stall seen by the rest of the main loop while serving, and is included in the /hardware reply.
+*/
+
+using namespace nsHttpServer;
+
+struct ROUTE {
+	const char *path;
+	HTTPHANDLER fn;
+};
+
+static HTTPCONN m_conn[HTTP_MAX_CONN];
+static ROUTE m_routes[HTTP_MAX_ROUTES];
+static uint8_t m_routeCount = 0;
+static HTTPSTATS m_stats;
+static uint8_t m_chunk[HTTP_CHUNK];
+static uint32_t m_lastLoop_us = 0;
+static bool m_serving = false;
+
+
+#pragma region AsyncTCP_callbacks
+
+/*request bytes arrive here.  only the request line is kept, headers are scanned for the blank line and discarded*/
+static void httpData(void *arg, AsyncClient *client, void *data, size_t len) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	HTTPCONN *cp = (HTTPCONN*)arg;
+	if (cp == nullptr || cp->client != client) return;
+	if (cp->state != HTTP_REQUEST) return;
+	cp->progressAt = millis();
+
+	const char *d = (const char*)data;
+	for (size_t i = 0; i < len; ++i) {
+		char ch = d[i];
+		if (cp->path == nullptr) {
+			//request line
+			if (ch == '\r' || ch == '\n') {
+				cp->req[cp->len] = '\0';
+				cp->path = cp->req;	//marks request line complete, parsed in startReply
+			}
+			else if (cp->len < HTTP_REQ_SIZE - 1) {
+				cp->req[cp->len++] = ch;
+			}
+			else {
+				cp->overflow = true;
+			}
+		}
+		else if (ch == '\n') {
+			//header line complete
+			cp->hdr[cp->hlen] = '\0';
+			requestHeader(*cp);
+			cp->hlen = 0;
+		}
+		else if (ch != '\r' && cp->hlen < HTTP_HDR_SIZE - 1) {
+			cp->hdr[cp->hlen++] = ch;
+		}
+		//match \r\n\r\n, also accept bare \n\n
+		if (ch == '\n') {
+			if (++cp->eoh >= 2) {
+				cp->state = HTTP_READY;
+				return;
+			}
+		}
+		else if (ch != '\r') {
+			cp->eoh = 0;
+		}
+	}
+}
+
+static void httpDisconnect(void *arg, AsyncClient *client) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	HTTPCONN *cp = (HTTPCONN*)arg;
+	if (cp != nullptr && cp->client == client) release(*cp);
+	//server side clients belong to us
+	delete client;
+}
+
+static void httpError(void *arg, AsyncClient *client, int8_t error) {
+	trace(Serial.printf("http error %s\r\n", client->errorToString(error));)
+}
+
+/*the client is reading, the reply is making progress*/
+static void httpAck(void *arg, AsyncClient *client, size_t len, uint32_t time) {
+	HTTPCONN *cp = (HTTPCONN*)arg;
+	if (cp != nullptr && cp->client == client) cp->progressAt = millis();
+}
+
+/*no ack within AsyncTCP's ack timeout*/
+static void httpTimeout(void *arg, AsyncClient *client, uint32_t time) {
+	trace(Serial.printf("http timeout %dms\r\n", time);)
+	client->close(true);
+}
+
+static void httpNewClient(void *arg, AsyncClient *client) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	HTTPCONN *cp = nullptr;
+	for (auto &c : m_conn) {
+		if (c.state == HTTP_FREE) { cp = &c; break; }
+	}
+	if (cp == nullptr) {
+		++m_stats.rejected;
+		client->close(true);
+		delete client;
+		return;
+	}
+	cp->client = client;
+	cp->state = HTTP_REQUEST;
+	cp->len = 0;
+	cp->eoh = 0;
+	cp->overflow = false;
+	cp->path = nullptr;
+	cp->query = nullptr;
+	cp->hlen = 0;
+	cp->ifNoneMatch[0] = '\0';
+	cp->gzip = false;
+	cp->flash = nullptr;
+	cp->producer = nullptr;
+	cp->cursor = 0;
+	cp->http11 = false;
+	cp->pos = 0;
+	cp->size = 0;
+	cp->progressAt = millis();
+	client->setNoDelay(true);
+	client->onData(&httpData, cp);
+	client->onDisconnect(&httpDisconnect, cp);
+	client->onError(&httpError, cp);
+	client->onAck(&httpAck, cp);
+	client->onTimeout(&httpTimeout, cp);
+}
+
+#pragma endregion
+
+
+#pragma region Public
+
+void nsHttpServer::begin(void) {
+	AsyncServer *server = new AsyncServer(HTTP_PORT);
+	server->onClient(&httpNewClient, server);
+	server->begin();
+}
+
+/*register a GET handler for an exact path.  returns false if the table is full*/
+bool nsHttpServer::on(const char *path, HTTPHANDLER fn) {
+	if (m_routeCount >= HTTP_MAX_ROUTES) return false;
+	m_routes[m_routeCount].path = path;
+	m_routes[m_routeCount].fn = fn;
+	++m_routeCount;
+	return true;
+}
+
+/*call from the main loop.  starts complete requests and moves each reply on by at most HTTP_CHUNK bytes*/
+void nsHttpServer::loop(void) {
+	uint32_t t = micros();
+	if (m_serving) {
+		uint32_t gap = t - m_lastLoop_us;
+		if (gap > m_stats.maxStall_us) m_stats.maxStall_us = gap;
+	}
+
+	bool serving = false;
+	for (auto &c : m_conn) {
+		switch (c.state) {
+		case HTTP_FREE:
+			continue;
+		case HTTP_REQUEST:
+			//client connected but did not complete a request
+			idle(c);
+			continue;
+		case HTTP_READY:
+			startReply(c);
+			break;
+		case HTTP_SENDING:
+			if (c.producer != nullptr) pumpStream(c);
+			else pump(c);
+			//client stopped reading, nothing could be handed to TCP
+			if (c.state == HTTP_SENDING && idle(c)) continue;
+			break;
+		case HTTP_DONE:
+			//closed on our side, the client has not acked what remains
+			idle(c);
+			continue;
+		}
+		if (c.state == HTTP_SENDING) serving = true;
+	}
+
+	uint32_t now = micros();
+	if (now - t > m_stats.maxPump_us) m_stats.maxPump_us = now - t;
+	m_lastLoop_us = now;
+	m_serving = serving;
+}
+
+/*reply with a generated body.  call from a handler, the body is copied and streamed from loop()*/
+void nsHttpServer::send(HTTPCONN &c, int code, const char *contentType, const String &body) {
+	if (c.state != HTTP_READY) return;
+	c.body = body;
+	c.size = c.body.length();
+	c.pos = 0;
+	sendHeader(c, code, contentType, c.size);
+	c.state = HTTP_SENDING;
+}
+
+/*reply with a body written piecewise by producer from loop().  call from a handler*/
+void nsHttpServer::sendStream(HTTPCONN &c, const char *contentType, HTTPPRODUCER producer) {
+	if (c.state != HTTP_READY) return;
+	c.producer = producer;
+	c.cursor = 0;
+	char h[200];
+	snprintf(h, sizeof(h), "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nCache-Control: no-cache\r\n%sConnection: close\r\n\r\n",
+		contentType, c.http11 ? "Transfer-Encoding: chunked\r\n" : "");
+	c.client->add(h, strlen(h), ASYNC_WRITE_FLAG_COPY);
+	c.state = HTTP_SENDING;
+}
+
+/*true if name is listed in ?fields=a,b,c or there is no fields parameter*/
+bool nsHttpServer::fieldWanted(const HTTPCONN &c, const char *name) {
+	if (c.query == nullptr) return true;
+	const char *f = strstr(c.query, "fields=");
+	if (f == nullptr) return true;
+	if (f != c.query && f[-1] != '&') return true;
+	f += 7;
+	size_t n = strlen(name);
+	while (*f != '\0' && *f != '&') {
+		//commas may arrive url encoded
+		if (*f == ',') { ++f; continue; }
+		if (f[0] == '%' && f[1] == '2' && (f[2] == 'C' || f[2] == 'c')) { f += 3; continue; }
+		const char *e = f;
+		while (*e != '\0' && *e != '&' && *e != ',' && *e != '%') ++e;
+		if ((size_t)(e - f) == n && strncmp(f, name, n) == 0) return true;
+		f = (e == f) ? e + 1 : e;
+	}
+	return false;
+}
+
+const HTTPSTATS &nsHttpServer::getStats(void) {
+	return m_stats;
+}
+
+void nsHttpServer::clearStats(void) {
+	memset(&m_stats, 0, sizeof(m_stats));
+}
+
+#pragma endregion
+
+
+#pragma region Local
+
+/*parse the request line and route it.  GET /path?query HTTP/1.1*/
+void nsHttpServer::startReply(HTTPCONN &c) {
+	++m_stats.requests;
+	if (c.overflow || c.path == nullptr) {
+		++m_stats.rejected;
+		send(c, 414, "text/plain", statusText(414));
+		return;
+	}
+	char *p = strchr(c.req, ' ');
+	if (p == nullptr || strncmp(c.req, "GET ", 4) != 0) {
+		++m_stats.rejected;
+		send(c, 405, "text/plain", statusText(405));
+		return;
+	}
+	char *path = p + 1;
+	p = strchr(path, ' ');
+	if (p != nullptr) {
+		*p = '\0';
+		c.http11 = strcmp(p + 1, "HTTP/1.1") == 0;
+	}
+	p = strchr(path, '?');
+	if (p != nullptr) {
+		*p = '\0';
+		c.query = p + 1;
+	}
+	c.path = path;
+	trace(Serial.printf("http GET %s\r\n", c.path);)
+
+	for (uint8_t i = 0; i < m_routeCount; ++i) {
+		if (strcmp(m_routes[i].path, c.path) != 0) continue;
+		m_routes[i].fn(c);
+		//a handler that does not reply is treated as not found
+		if (c.state == HTTP_READY) break;
+		return;
+	}
+
+	//Engine Driver requests the root if its Web menu item is used
+	if (strcmp(c.path, "/") == 0) c.path = "/index.htm";
+#ifdef HTTP_FS_OVERRIDE
+	if (sendFile(c, c.path)) return;
+	if (sendAsset(c, c.path)) return;
+#else
+	if (sendAsset(c, c.path)) return;
+	if (sendFile(c, c.path)) return;
+#endif
+
+	++m_stats.notFound;
+	send(c, 404, "text/plain", "404: Not Found");
+}
+
+bool nsHttpServer::sendFile(HTTPCONN &c, const char *path) {
+	if (strstr(path, "..") != nullptr) return false;
+	if (!LittleFS.exists(path)) return false;
+	c.file = LittleFS.open(path, "r");
+	if (!c.file) return false;
+	c.size = c.file.size();
+	c.pos = 0;
+	sendHeader(c, 200, contentType(path), c.size);
+	c.state = HTTP_SENDING;
+	return true;
+}
+
+/*embedded page, gzip with ETag.  a client that cannot take gzip falls through to LittleFS*/
+bool nsHttpServer::sendAsset(HTTPCONN &c, const char *path) {
+	if (!c.gzip) return false;
+	for (uint8_t i = 0; i < nsWebAssets::assetCount; ++i) {
+		const nsWebAssets::ASSET &a = nsWebAssets::assets[i];
+		if (strcmp(a.path, path) != 0) continue;
+
+		char extra[96];
+		snprintf(extra, sizeof(extra), "ETag: %s\r\nCache-Control: no-cache\r\n", a.etag);
+		if (strcmp(c.ifNoneMatch, a.etag) == 0) {
+			++m_stats.notModified;
+			sendHeader(c, 304, a.contentType, 0, extra);
+			c.size = 0;
+		}
+		else {
+			strcat(extra, "Content-Encoding: gzip\r\n");
+			sendHeader(c, 200, a.contentType, a.length, extra);
+			c.flash = a.data;
+			c.size = a.length;
+		}
+		c.pos = 0;
+		c.state = HTTP_SENDING;
+		return true;
+	}
+	return false;
+}
+
+/*only the headers we act on are kept*/
+void nsHttpServer::requestHeader(HTTPCONN &c) {
+	char *v = strchr(c.hdr, ':');
+	if (v == nullptr) return;
+	*v++ = '\0';
+	while (*v == ' ') ++v;
+	if (strcasecmp(c.hdr, "If-None-Match") == 0) {
+		strncpy(c.ifNoneMatch, v, sizeof(c.ifNoneMatch));
+		c.ifNoneMatch[sizeof(c.ifNoneMatch) - 1] = '\0';
+	}
+	else if (strcasecmp(c.hdr, "Accept-Encoding") == 0) {
+		c.gzip = strstr(v, "gzip") != nullptr;
+	}
+}
+
+void nsHttpServer::sendHeader(HTTPCONN &c, int code, const char *contentType, size_t length, const char *extra) {
+	char h[256];
+	int n = snprintf(h, sizeof(h), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %u\r\n%sConnection: close\r\n\r\n",
+		code, statusText(code), contentType, (unsigned)length, extra);
+	c.client->add(h, n, ASYNC_WRITE_FLAG_COPY);
+	//header goes out with the first chunk from pump
+}
+
+/*hand the next piece of the reply to TCP, bounded by HTTP_CHUNK and the space AsyncTCP has*/
+void nsHttpServer::pump(HTTPCONN &c) {
+	size_t n = c.size - c.pos;
+	if (n > HTTP_CHUNK) n = HTTP_CHUNK;
+	size_t space = c.client->space();
+	if (n > space) n = space;
+
+	if (n > 0) {
+		if (c.flash != nullptr) {
+			memcpy_P(m_chunk, c.flash + c.pos, n);
+			c.client->add((const char*)m_chunk, n, ASYNC_WRITE_FLAG_COPY);
+		}
+		else if (c.file) {
+			n = c.file.read(m_chunk, n);
+			c.client->add((const char*)m_chunk, n, ASYNC_WRITE_FLAG_COPY);
+		}
+		else {
+			c.client->add(c.body.c_str() + c.pos, n, ASYNC_WRITE_FLAG_COPY);
+		}
+		c.pos += n;
+		m_stats.bytes += n;
+		c.progressAt = millis();
+	}
+	c.client->send();
+
+	if (c.pos < c.size) return;
+	finish(c);
+}
+
+/*streamed reply.  each piece is framed as a chunk for HTTP/1.1.  the chunk size line and trailer take
+at most 8 bytes, the final chunk 5*/
+void nsHttpServer::pumpStream(HTTPCONN &c) {
+	size_t room = c.client->space();
+	if (room > HTTP_CHUNK) room = HTTP_CHUNK;
+	if (room <= 16) {
+		c.client->send();
+		return;
+	}
+	room -= 16;
+
+	size_t n = 0;
+	if (c.cursor != HTTP_CURSOR_END) n = c.producer(c, (char*)m_chunk, room);
+	if (n > 0) {
+		if (c.http11) {
+			char h[8];
+			snprintf(h, sizeof(h), "%x\r\n", (unsigned)n);
+			c.client->add(h, strlen(h), ASYNC_WRITE_FLAG_COPY);
+		}
+		c.client->add((const char*)m_chunk, n, ASYNC_WRITE_FLAG_COPY);
+		if (c.http11) c.client->add("\r\n", 2, ASYNC_WRITE_FLAG_COPY);
+		m_stats.bytes += n;
+		c.progressAt = millis();
+	}
+	if (c.cursor != HTTP_CURSOR_END) {
+		c.client->send();
+		return;
+	}
+	if (c.http11) c.client->add("0\r\n\r\n", 5, ASYNC_WRITE_FLAG_COPY);
+	c.client->send();
+	finish(c);
+}
+
+/*all queued. lwip sends what remains after close.  httpDisconnect releases the entry*/
+void nsHttpServer::finish(HTTPCONN &c) {
+	c.state = HTTP_DONE;
+	if (c.file) c.file.close();
+	c.body = String();
+	c.producer = nullptr;
+	c.client->close();
+}
+
+/*abort a connection that has made no progress for HTTP_IDLE_MS.  httpDisconnect then releases the entry, so
+true means it is gone*/
+bool nsHttpServer::idle(HTTPCONN &c) {
+	if ((millis() - c.progressAt) <= HTTP_IDLE_MS) return false;
+	trace(Serial.printf("http idle, state %d\r\n", c.state);)
+	c.client->close(true);
+	return true;
+}
+
+/*return a connection entry to the free state*/
+void nsHttpServer::release(HTTPCONN &c) {
+	if (c.file) c.file.close();
+	c.body = String();
+	c.flash = nullptr;
+	c.producer = nullptr;
+	c.client = nullptr;
+	c.state = HTTP_FREE;
+}
+
+const char *nsHttpServer::contentType(const char *path) {
+	const char *ext = strrchr(path, '.');
+	if (ext == nullptr) return "text/plain";
+	if (strcmp(ext, ".htm") == 0 || strcmp(ext, ".html") == 0) return "text/html";
+	if (strcmp(ext, ".css") == 0) return "text/css";
+	if (strcmp(ext, ".js") == 0) return "application/javascript";
+	if (strcmp(ext, ".ico") == 0) return "image/x-icon";
+	if (strcmp(ext, ".json") == 0) return "text/json";
+	return "text/plain";
+}
+
+const char *nsHttpServer::statusText(int code) {
+	switch (code) {
+	case 200: return "OK";
+	case 304: return "Not Modified";
+	case 404: return "Not Found";
+	case 405: return "Method Not Allowed";
+	case 414: return "URI Too Long";
+	}
+	return "Error";
+}
+
+#pragma endregion
@@ -0,0 +1,103 @@
+// HttpServer.h
+//Minimal non-blocking HTTP/1.1 server on ESPAsyncTCP.  Serves LittleFS files and registered GET handlers
+
+#ifndef _HTTPSERVER_h
+#define _HTTPSERVER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include <ESPAsyncTCP.h>  //Github me-no-dev/ESPAsyncTCP
+#include <LittleFS.h>
+
+namespace nsHttpServer {
+
+#define HTTP_PORT		80
+#define HTTP_MAX_CONN	4     //concurrent connections, browsers open 2 or 3 per page
+#define HTTP_REQ_SIZE	128   //request line.  longer request lines are rejected
+#define HTTP_CHUNK		1024  //max bytes handed to TCP per connection per loop
+#define HTTP_IDLE_MS	5000  //close a connection that has made no progress for this long, in any state
+#define HTTP_MAX_ROUTES	8
+#define HTTP_CURSOR_END	0xFFFF  //a producer sets HTTPCONN.cursor to this when it has written everything
+#define HTTP_HDR_SIZE	64    //header lines are examined up to this length, see httpData
+//#define HTTP_FS_OVERRIDE	  //uncomment to serve a LittleFS copy of a page in preference to WebAssets.h, useful when editing pages
+
+	enum HTTPSTATE {
+		HTTP_FREE,
+		HTTP_REQUEST,	//receiving the request
+		HTTP_READY,		//request complete, awaiting loop()
+		HTTP_SENDING,	//streaming file or body
+		HTTP_DONE		//all queued, closing
+	};
+
+	struct HTTPCONN;
+	/*writes the next part of a streamed reply into buf, at most len bytes, and returns the count written.
+	progress is kept in HTTPCONN.cursor.  returning 0 without setting HTTP_CURSOR_END means try again with more room*/
+	typedef size_t(*HTTPPRODUCER)(HTTPCONN &c, char *buf, size_t len);
+
+	struct HTTPCONN {
+		AsyncClient *client = nullptr;
+		uint8_t state = HTTP_FREE;
+		char req[HTTP_REQ_SIZE];	//request line, null terminated when complete
+		uint16_t len = 0;
+		uint8_t eoh = 0;			//chars of the \r\n\r\n terminator matched so far
+		bool overflow = false;
+		const char *path = nullptr;	//into req, once parsed
+		const char *query = nullptr;	//text after ?, or nullptr
+		char hdr[HTTP_HDR_SIZE];	//header line being assembled
+		uint8_t hlen = 0;
+		char ifNoneMatch[24];		//If-None-Match request header, empty if absent
+		bool gzip = false;			//client sent Accept-Encoding: gzip
+		const uint8_t *flash = nullptr;	//embedded asset being sent, in place of file or body
+		HTTPPRODUCER producer = nullptr;	//streamed reply, in place of file or body
+		uint16_t cursor = 0;		//producer progress
+		bool http11 = false;		//client can take Transfer-Encoding: chunked
+		File file;
+		String body;				//used in place of file for generated replies
+		size_t pos = 0;				//bytes of file or body sent
+		size_t size = 0;
+		uint32_t progressAt = 0;	//millis() of the last request bytes, reply bytes handed to TCP or ack
+	};
+
+	/*health figures, the stall is the longest gap between loop() calls while a reply was in progress*/
+	struct HTTPSTATS {
+		uint32_t requests;
+		uint32_t notFound;
+		uint32_t notModified;	//304 replies to a matching ETag
+		uint32_t rejected;		//table full, bad or oversized request
+		uint32_t bytes;
+		uint32_t maxPump_us;	//longest single loop() call
+		uint32_t maxStall_us;	//longest gap between loop() calls while serving
+	};
+
+	typedef void(*HTTPHANDLER)(HTTPCONN &c);
+
+	/*function prototypes*/
+	void begin(void);
+	void loop(void);
+	bool on(const char *path, HTTPHANDLER fn);
+	void send(HTTPCONN &c, int code, const char *contentType, const String &body);
+	void sendStream(HTTPCONN &c, const char *contentType, HTTPPRODUCER producer);
+	bool fieldWanted(const HTTPCONN &c, const char *name);
+	const HTTPSTATS &getStats(void);
+	void clearStats(void);
+
+	/*local scope, hence declared static*/
+	static void startReply(HTTPCONN &c);
+	static bool sendFile(HTTPCONN &c, const char *path);
+	static bool sendAsset(HTTPCONN &c, const char *path);
+	static void sendHeader(HTTPCONN &c, int code, const char *contentType, size_t length, const char *extra = "");
+	static void requestHeader(HTTPCONN &c);
+	static void pump(HTTPCONN &c);
+	static void pumpStream(HTTPCONN &c);
+	static void finish(HTTPCONN &c);
+	static bool idle(HTTPCONN &c);
+	static void release(HTTPCONN &c);
+	static const char *contentType(const char *path);
+	static const char *statusText(int code);
+
+}
+#endif
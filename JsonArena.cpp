@@ -0,0 +1,128 @@
+//
+//
+//
+
+#include "JsonArena.h"
+#include "HeapStats.h"
+
+/*
+2026-10-19 arena for the ArduinoJson documents built and parsed by DCCweb and JsonThrottle.  Previously every
+message and broadcast took its pool and strings from the heap, a roster broadcast one document per slot,
+which left holes between the longer lived allocations of WiThrottle and the TCP stack.
+
+Allocations bump a pointer through a static buffer.  Each block carries a small header so that a block can be
+grown in place when it is the last, ArduinoJson grows its pool list and strings this way, and so that freeing
+the last block, and any freed blocks behind it, gives the space back.  A document per loop iteration therefore
+reuses the same bytes.  Whatever is left is discarded when the outermost SCOPE closes.
+
+An allocation that does not fit, or that is made with no SCOPE open, goes to the heap and is counted.  Static
+documents, the websocket filters, are built outside a scope and so live on the heap as before.
+Single threaded, the websocket and web server callbacks all run from the main loop.
+*/
+
+using namespace nsJsonArena;
+
+alignas(ARENA_ALIGN) static uint8_t m_arena[ARENA_SIZE];
+static uint16_t m_top = 0;				//first free byte
+static uint16_t m_last = ARENA_NONE;	//header of the last block
+static uint8_t m_depth = 0;				//open scopes
+static ARENASTATS m_stats;
+static ArenaAllocator m_allocator;
+
+
+ArduinoJson::Allocator *nsJsonArena::allocator(void) {
+	return &m_allocator;
+}
+
+/*bytes of the arena in use right now*/
+uint16_t nsJsonArena::inUse(void) {
+	return m_top;
+}
+
+const ARENASTATS &nsJsonArena::getStats(void) {
+	return m_stats;
+}
+
+bool nsJsonArena::owns(const void *ptr) {
+	return ptr >= m_arena && ptr < m_arena + ARENA_SIZE;
+}
+
+ARENABLOCK *nsJsonArena::block(uint16_t offset) {
+	return (ARENABLOCK*)(m_arena + offset);
+}
+
+
+nsJsonArena::SCOPE::SCOPE() {
+	++m_depth;
+}
+
+nsJsonArena::SCOPE::~SCOPE() {
+	if (--m_depth > 0) return;
+	m_top = 0;
+	m_last = ARENA_NONE;
+	++m_stats.resets;
+}
+
+
+void *nsJsonArena::ArenaAllocator::allocate(size_t size) {
+	if (m_depth == 0) {
+		++m_stats.unscoped;
+		nsHeapStats::TAG tag(nsHeapStats::HEAP_JSON);
+		return malloc(size);
+	}
+	size_t n = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	if (m_top + sizeof(ARENABLOCK) + n > ARENA_SIZE) {
+		++m_stats.fallbacks;
+		nsHeapStats::TAG tag(nsHeapStats::HEAP_JSON);
+		return malloc(size);
+	}
+	ARENABLOCK *b = block(m_top);
+	b->size = n;
+	b->prev = m_last;
+	b->freed = 0;
+	m_last = m_top;
+	m_top += sizeof(ARENABLOCK) + n;
+	if (m_top > m_stats.highWater) m_stats.highWater = m_top;
+	return b + 1;
+}
+
+/*a freed block is only marked, space is given back once everything after it is also free*/
+void nsJsonArena::ArenaAllocator::deallocate(void *ptr) {
+	if (!owns(ptr)) {
+		nsHeapStats::TAG tag(nsHeapStats::HEAP_JSON);
+		free(ptr);
+		return;
+	}
+	((ARENABLOCK*)ptr - 1)->freed = 1;
+	while (m_last != ARENA_NONE && block(m_last)->freed) {
+		m_top = m_last;
+		m_last = block(m_last)->prev;
+	}
+}
+
+void *nsJsonArena::ArenaAllocator::reallocate(void *ptr, size_t newSize) {
+	if (ptr == nullptr) return allocate(newSize);
+	if (!owns(ptr)) {
+		nsHeapStats::TAG tag(nsHeapStats::HEAP_JSON);
+		return realloc(ptr, newSize);
+	}
+
+	ARENABLOCK *b = (ARENABLOCK*)ptr - 1;
+	uint16_t offset = (uint8_t*)b - m_arena;
+	size_t n = (newSize + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+	//the last block grows or shrinks in place
+	if (offset == m_last && offset + sizeof(ARENABLOCK) + n <= ARENA_SIZE) {
+		b->size = n;
+		m_top = offset + sizeof(ARENABLOCK) + n;
+		if (m_top > m_stats.highWater) m_stats.highWater = m_top;
+		return ptr;
+	}
+	//any other shrinks in place, the tail is recovered on reset
+	if (n <= b->size) return ptr;
+
+	void *p = allocate(newSize);
+	if (p == nullptr) return nullptr;
+	memcpy(p, ptr, b->size);
+	deallocate(ptr);
+	return p;
+}
@@ -0,0 +1,63 @@
+// JsonArena.h
+//Static bump allocator for ArduinoJson 7 documents.  Reset at the end of each websocket message or broadcast
+
+#ifndef _JSONARENA_h
+#define _JSONARENA_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include <ArduinoJson.h>   //VERSION 7, for the Allocator interface
+
+namespace nsJsonArena {
+
+#define ARENA_SIZE		4096  //bytes, a roster broadcast plus the message that caused it fits comfortably
+#define ARENA_ALIGN		8     //ArduinoJson stores 64 bit values in its slots
+#define ARENA_NONE		0xFFFF
+
+	/*ahead of each block in the arena*/
+	struct ARENABLOCK {
+		uint16_t size;		//payload bytes, a multiple of ARENA_ALIGN
+		uint16_t prev;		//offset of the block before, or ARENA_NONE
+		uint16_t freed;
+		uint16_t spare;
+	};
+
+	struct ARENASTATS {
+		uint32_t resets;		//outermost scopes closed
+		uint32_t highWater;		//most arena bytes in use at once, headers included
+		uint32_t fallbacks;		//allocations that did not fit and went to the heap
+		uint32_t unscoped;		//allocations made outside any SCOPE, these also go to the heap
+	};
+
+	/*plugged into each JsonDocument, JsonDocument doc(nsJsonArena::allocator());*/
+	class ArenaAllocator : public ArduinoJson::Allocator {
+	public:
+		void *allocate(size_t size) override;
+		void deallocate(void *ptr) override;
+		void *reallocate(void *ptr, size_t newSize) override;
+	};
+
+	/*open one at the top of any function that creates an arena document, before the document is declared.
+	Scopes nest, the arena is reset when the outermost one closes, so no arena document may outlive it*/
+	struct SCOPE {
+		SCOPE();
+		~SCOPE();
+		SCOPE(const SCOPE&) = delete;
+		SCOPE &operator=(const SCOPE&) = delete;
+	};
+
+	/*function prototypes*/
+	ArduinoJson::Allocator *allocator(void);
+	uint16_t inUse(void);
+	const ARENASTATS &getStats(void);
+
+	/*local scope, hence declared static*/
+	static bool owns(const void *ptr);
+	static ARENABLOCK *block(uint16_t offset);
+
+}
+#endif
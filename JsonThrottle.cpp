@@ -0,0 +1,384 @@
+//
+//
+//
+
+#include "JsonThrottle.h"
+#include "DCCcore.h"
+#include "DCCweb.h"
+#include "WiThrottle.h"
+#include "HeapStats.h"
+#include "LocoRoster.h"
+
+/*
+2026-10-19 JSON throttle.  A browser throttle, data/throttle.htm, which shares the DCCweb websocket rather than
+opening another TCP server.  DCCweb passes any message whose type is not dccUI to processJson.
+
+Messages are compact, type "jt" and a command "c".  Addresses are written as WiThrottle writes them, S3 or L1234
+browser to server
+{"type":"jt","c":"hello"}					returns the roster, power and any locos already held
+{"type":"jt","c":"acq","a":"S3"}			acquire, add "steal":1 to confirm taking it from another throttle
+{"type":"jt","c":"rel","a":"S3"}			release
+{"type":"jt","c":"v","a":"S3","v":63}		speed 0-126, -1 is eStop
+{"type":"jt","c":"r","a":"S3","d":1}		direction 1=forward 0=reverse
+{"type":"jt","c":"f","a":"S3","n":5}		toggle function F0-F28
+{"type":"jt","c":"pw","on":1}				track power
+{"type":"jt","c":"stop"}					stop all locos
+{"type":"jt","c":"hb"}						heartbeat, any message also counts
+
+server to browser
+{"type":"jt","c":"roster","o":0,"n":40,"l":[["S3","name"],...]}	entries o onward of n, o=0 starts the list
+{"type":"jt","c":"acq","a":"S3"}  {"type":"jt","c":"rel","a":"S3"}  {"type":"jt","c":"steal","a":"S3"}
+{"type":"jt","c":"pw","on":1}
+{"type":"jt","c":"s","l":[{"a":"S3","v":63,"r":1,"f":5},...]}	state of held locos that changed
+
+State is not pushed per change.  broadcastJSONchanges compares each held loco with what that browser was last
+sent, and at most every JT_FRAME_MS sends one message covering all changed locos, so a slider drag on another
+throttle costs one small message per frame.  The page likewise sends its own slider at most once per frame.
+
+Steal and release follow WiThrottle.  A loco held by another browser, or by a WiThrottle, needs a steal
+confirmation.  The previous holder is then released and, for a browser, told so.  A WiThrottle steal
+releases the browser via releaseLoco.  If the slot is reassigned to another address the browser is released.
+If a browser goes quiet for JT_TIMEOUT its locos are stopped, as for a WiThrottle.  On disconnect they are
+stopped and released.
+*/
+
+using namespace nsJsonThrottle;
+
+static JTCLIENT m_clients[WEBSOCKETS_SERVER_CLIENT_MAX];
+
+
+#pragma region Inbound
+
+/*process a message from websocket client num*/
+void nsJsonThrottle::processJson(uint8_t num, JsonDocument &doc) {
+	if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+	const char *type = doc["type"];
+	const char *cmd = doc["c"];
+	if (type == nullptr || cmd == nullptr) return;
+	if (strcmp(type, "jt") != 0) return;
+
+	JTCLIENT &jc = m_clients[num];
+	//any message counts as a heartbeat
+	nsTimerWheel::start(jc.heartbeat, JT_TIMEOUT * 1000UL, &clientTimeout, &jc);
+
+	if (strcmp(cmd, "hello") == 0) {
+		jc.active = true;
+		jc.powerValid = false;
+		sendRoster(num);
+		for (uint8_t i = 0; i < jc.count; ++i) {
+			jc.loco[i].valid = false;
+			sendLoco(num, "acq", jc.loco[i].address);
+		}
+		return;
+	}
+	if (!jc.active) return;
+
+	if (strcmp(cmd, "hb") == 0) return;
+
+	if (strcmp(cmd, "pw") == 0) {
+		nsDCCbus::setPower(doc["on"].as<int>() != 0, nsDCCbus::BUS_WEB);
+		return;
+	}
+
+	if (strcmp(cmd, "stop") == 0) {
+		nsDCCbus::stopAll(nsDCCbus::BUS_WEB);
+		return;
+	}
+
+	//remaining commands act on a loco
+	const char *a = doc["a"];
+	if (a == nullptr) return;
+	if (a[0] != 'S' && a[0] != 'L') return;
+	if (strlen(a) > 6) return;
+
+	if (strcmp(cmd, "acq") == 0) {
+		acquire(num, a, doc["steal"].as<int>() != 0);
+		return;
+	}
+
+	if (strcmp(cmd, "rel") == 0) {
+		release(num, addrKey(a), true);
+		return;
+	}
+
+	//speed, direction and function require the loco to be held by this browser
+	JTLOCO *h = findHeld(num, addrKey(a));
+	if (h == nullptr) return;
+
+	if (strcmp(cmd, "v") == 0) {
+		//negative speed is an estop
+		nsDCCbus::locoSpeed(h->slot, doc["v"].as<int>(), nsDCCbus::BUS_WEB);
+		return;
+	}
+
+	if (strcmp(cmd, "r") == 0) {
+		nsDCCbus::locoDirection(h->slot, doc["d"].as<int>() != 0 ? 1 : 0, nsDCCbus::BUS_WEB);
+		return;
+	}
+
+	if (strcmp(cmd, "f") == 0) {
+		int n = doc["n"].as<int>();
+		if (n < 0 || n > 28) return;
+		nsDCCbus::locoFunction(h->slot, n, nsDCCbus::BUS_WEB);
+		return;
+	}
+}
+
+/*websocket client has gone. stop and release its locos*/
+void nsJsonThrottle::disconnect(uint8_t num) {
+	if (num >= WEBSOCKETS_SERVER_CLIENT_MAX) return;
+	JTCLIENT &jc = m_clients[num];
+	nsTimerWheel::cancel(jc.heartbeat);
+	for (uint8_t i = 0; i < jc.count; ++i) {
+		nsDCCbus::locoSpeed(jc.loco[i].slot, 0, nsDCCbus::BUS_WEB);
+	}
+	jc.count = 0;
+	jc.active = false;
+	jc.rosterNext = JT_ROSTER_IDLE;
+}
+
+/*heartbeat expiry from the timer wheel. stop the locos but keep them held, the browser may recover*/
+void nsJsonThrottle::clientTimeout(void *arg) {
+	JTCLIENT *jc = (JTCLIENT*)arg;
+	for (uint8_t i = 0; i < jc->count; ++i) {
+		nsDCCbus::locoSpeed(jc->loco[i].slot, 0, nsDCCbus::BUS_WEB);
+		trace(Serial.printf("jt timeout %s\r\n", jc->loco[i].address);)
+	}
+}
+
+#pragma endregion
+
+
+#pragma region Ownership
+
+/*acquire a loco for browser num.  returns the slot, or -1 if it was not acquired*/
+int8_t nsJsonThrottle::acquire(uint8_t num, const char *address, bool steal) {
+	JTCLIENT &jc = m_clients[num];
+	uint16_t key = addrKey(address);
+
+	//already ours, resend the state
+	JTLOCO *h = findHeld(num, key);
+	if (h != nullptr) {
+		h->valid = false;
+		sendLoco(num, "acq", address);
+		return h->slot;
+	}
+	if (jc.count >= JT_MAX_LOCOS) return -1;
+
+	char addr[8];
+	char slotAddress[10];
+	strncpy(addr, address, sizeof(addr));
+	addr[sizeof(addr) - 1] = '\0';
+	if (findLoco(addr, slotAddress) < 0) return -1;
+
+	//slotAddress is the address currently in the slot we would take, which differs from address if a slot is bumped
+	//is that held by another browser or a WiThrottle?
+	bool held = isLocoHeld(slotAddress) || nsWiThrottle::isLocoHeld(slotAddress);
+	if (held) {
+		if (!steal) {
+			//ask the browser to confirm
+			sendLoco(num, "steal", address);
+			return -1;
+		}
+		releaseLoco(slotAddress);
+		nsWiThrottle::releaseLoco(slotAddress);
+	}
+
+	int8_t slot = findLoco(addr, nullptr);
+	if (slot < 0) return -1;
+	uint16_t address16 = atoi(addr + 1);
+	bool useLong = addr[0] == 'L';
+	if (loco[slot].address != address16 || loco[slot].useLongAddress != useLong) {
+		//taking an empty or bumped slot, as a WiThrottle add does.  paged from the roster
+		nsLocoRoster::page(slot, address16, useLong);
+		locoRosterChanged();
+	}
+	loco[slot].changeFlag = true;
+	incrLocoHistory(&loco[slot]);
+
+	h = &jc.loco[jc.count++];
+	strncpy(h->address, addr, sizeof(h->address));
+	h->key = key;
+	h->slot = slot;
+	h->valid = false;
+	sendLoco(num, "acq", addr);
+	return slot;
+}
+
+/*release a loco held by browser num, optionally telling the browser. speed is left as is, as for WiThrottle*/
+bool nsJsonThrottle::release(uint8_t num, uint16_t key, bool tell) {
+	JTCLIENT &jc = m_clients[num];
+	for (uint8_t i = 0; i < jc.count; ++i) {
+		if (jc.loco[i].key != key) continue;
+		if (tell) sendLoco(num, "rel", jc.loco[i].address);
+		//keep the list packed
+		jc.loco[i] = jc.loco[--jc.count];
+		return true;
+	}
+	return false;
+}
+
+/*is the loco held by any browser?  used by WiThrottle to decide if a steal is required*/
+bool nsJsonThrottle::isLocoHeld(const char *address) {
+	if (address == nullptr || address[0] == '\0') return false;
+	uint16_t key = addrKey(address);
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		if (findHeld(n, key) != nullptr) return true;
+	}
+	return false;
+}
+
+/*release the loco from any browser holding it, the browser is told it was stolen*/
+void nsJsonThrottle::releaseLoco(const char *address) {
+	if (address == nullptr || address[0] == '\0') return;
+	uint16_t key = addrKey(address);
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		release(n, key, true);
+	}
+}
+
+JTLOCO *nsJsonThrottle::findHeld(uint8_t num, uint16_t key) {
+	JTCLIENT &jc = m_clients[num];
+	for (uint8_t i = 0; i < jc.count; ++i) {
+		if (jc.loco[i].key == key) return &jc.loco[i];
+	}
+	return nullptr;
+}
+
+/*same numeric form as WiThrottle, S3 and L3 differ*/
+uint16_t nsJsonThrottle::addrKey(const char *address) {
+	if (address == nullptr) return 0;
+	uint16_t k = atoi(address + 1) & 0x3FFF;
+	if (address[0] == 'L') k |= 0x8000;
+	return k;
+}
+
+uint16_t nsJsonThrottle::locoKey(int8_t slot) {
+	if (slot < 0 || slot >= MAX_LOCO) return 0;
+	return loco[slot].address | (loco[slot].useLongAddress ? 0x8000 : 0);
+}
+
+#pragma endregion
+
+
+#pragma region Outbound
+
+/*send changed loco state to each browser, at most once per JT_FRAME_MS. call from main loop.
+clearFlags is accepted for symmetry with WiThrottle, flags are not used here as state is compared directly*/
+void nsJsonThrottle::broadcastJSONchanges(bool clearFlags) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	uint32_t now = millis();
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		JTCLIENT &jc = m_clients[n];
+		if (!jc.active) continue;
+
+		//track power changes go out immediately
+		if (!jc.powerValid || jc.powerSent != power.trackPower) sendPower(n);
+
+		if (jc.rosterNext != JT_ROSTER_IDLE) rosterPage(n);
+
+		if (jc.count == 0) continue;
+		if ((now - jc.sentAt) < JT_FRAME_MS) continue;
+
+		nsJsonArena::SCOPE arena;
+		JsonDocument out(nsJsonArena::allocator());
+		JsonArray l;
+		for (uint8_t i = 0; i < jc.count;) {
+			JTLOCO &h = jc.loco[i];
+			//slot was reassigned to another address, e.g. bumped from the keypad
+			if (locoKey(h.slot) != h.key) {
+				release(n, h.key, true);
+				continue;
+			}
+			LOCO &loc = loco[h.slot];
+			uint8_t speed = uint8_t(126 * loc.speed + 0.5);
+			++i;
+			if (h.valid && h.speed == speed && h.forward == loc.forward && h.function == loc.function) continue;
+
+			if (l.isNull()) {
+				out["type"] = "jt";
+				out["c"] = "s";
+				l = out["l"].to<JsonArray>();
+			}
+			JsonObject s = l.add<JsonObject>();
+			s["a"] = h.address;
+			s["v"] = speed;
+			s["r"] = loc.forward ? 1 : 0;
+			s["f"] = loc.function;
+			h.speed = speed;
+			h.forward = loc.forward;
+			h.function = loc.function;
+			h.valid = true;
+		}
+		if (l.isNull()) continue;
+		nsDCCweb::sendJsonTo(n, out);
+		jc.sentAt = now;
+	}
+}
+
+/*periodic power status to all browsers*/
+void nsJsonThrottle::broadcastJsonPower(void) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_DCCWEB);
+	for (uint8_t n = 0; n < WEBSOCKETS_SERVER_CLIENT_MAX; ++n) {
+		if (m_clients[n].active) sendPower(n);
+	}
+}
+
+void nsJsonThrottle::sendPower(uint8_t num) {
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "jt";
+	out["c"] = "pw";
+	out["on"] = power.trackPower ? 1 : 0;
+	out["trip"] = power.trip ? 1 : 0;
+	nsDCCweb::sendJsonTo(num, out);
+	m_clients[num].powerSent = power.trackPower;
+	m_clients[num].powerValid = true;
+}
+
+/*roster as address and name pairs, for the loco picker.  2026-10-19 the flash roster rather than the slots, so any
+loco can be picked and acquire pages it into a slot.  It can run to hundreds of entries, so it goes a page at a
+time from broadcastJSONchanges, see rosterPage*/
+void nsJsonThrottle::sendRoster(uint8_t num) {
+	m_clients[num].rosterNext = 0;
+	rosterPage(num);
+}
+
+/*next JT_ROSTER_PAGE entries from nsLocoRoster::get().  An edit to the roster while the pages are going out can
+shift an entry by one, the page is a picker and the next hello corrects it*/
+void nsJsonThrottle::rosterPage(uint8_t num) {
+	JTCLIENT &jc = m_clients[num];
+	uint16_t count = nsLocoRoster::count();
+	if (jc.rosterNext > count) jc.rosterNext = count;
+
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "jt";
+	out["c"] = "roster";
+	out["o"] = jc.rosterNext;
+	out["n"] = count;
+	JsonArray l = out["l"].to<JsonArray>();
+	char a[8];
+	nsLocoRoster::LOCOREC r;
+	for (uint8_t i = 0; i < JT_ROSTER_PAGE && nsLocoRoster::get(jc.rosterNext, r); ++i) {
+		JsonArray e = l.add<JsonArray>();
+		snprintf(a, sizeof(a), "%c%u", (r.flags & ROSTER_LONG) ? 'L' : 'S', r.address);
+		e.add(a);
+		e.add(r.name);
+		++jc.rosterNext;
+	}
+	if (jc.rosterNext >= count) jc.rosterNext = JT_ROSTER_IDLE;
+	nsDCCweb::sendJsonTo(num, out);
+}
+
+/*short acq, rel or steal message for one loco*/
+void nsJsonThrottle::sendLoco(uint8_t num, const char *cmd, const char *address) {
+	nsJsonArena::SCOPE arena;
+	JsonDocument out(nsJsonArena::allocator());
+	out["type"] = "jt";
+	out["c"] = cmd;
+	out["a"] = address;
+	nsDCCweb::sendJsonTo(num, out);
+}
+
+#pragma endregion
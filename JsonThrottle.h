@@ -0,0 +1,71 @@
+// JsonThrottle.h
+//Browser throttle over the DCCweb websocket.  See data/throttle.htm
+
+#ifndef _JSONTHROTTLE_h
+#define _JSONTHROTTLE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "Global.h"
+#include <ArduinoJson.h>
+#include "JsonArena.h"
+#include <WebSockets.h>
+#include "TimerWheel.h"
+
+namespace nsJsonThrottle {
+
+#define JT_MAX_LOCOS	4    //locos held per browser
+#define JT_FRAME_MS		40   //min interval between state updates to a browser, about one animation frame at 25fps
+#define JT_TIMEOUT		6    //sec without a message before held locos are stopped, the page sends hb every 2 sec
+#define JT_ROSTER_PAGE	24   //roster entries per message, the roster is sent a page per broadcastJSONchanges pass
+#define JT_ROSTER_IDLE	-1
+
+	/*a loco held by a browser, and the state last sent to it*/
+	struct JTLOCO {
+		char address[8];	//S3 or L1234
+		uint16_t key;		//numeric form of address, see addrKey()
+		int8_t slot;
+		uint8_t speed;		//126 step scale, as sent
+		bool forward;
+		uint32_t function;
+		bool valid;			//false forces the full state to be sent
+	};
+
+	/*one per websocket client number*/
+	struct JTCLIENT {
+		bool active = false;	//has sent hello
+		uint8_t count = 0;		//locos held
+		JTLOCO loco[JT_MAX_LOCOS];
+		uint32_t sentAt = 0;	//millis() of last state message
+		bool powerSent = false;
+		bool powerValid = false;
+		int16_t rosterNext = JT_ROSTER_IDLE;	//next roster entry to send
+		nsTimerWheel::TIMER heartbeat;
+	};
+
+	/*function prototypes*/
+	void processJson(uint8_t num, JsonDocument &doc);
+	void disconnect(uint8_t num);
+	void broadcastJSONchanges(bool clearFlags);
+	void broadcastJsonPower(void);
+	bool isLocoHeld(const char *address);
+	void releaseLoco(const char *address);
+
+	/*local scope, hence declared static*/
+	static void sendRoster(uint8_t num);
+	static void rosterPage(uint8_t num);
+	static void sendPower(uint8_t num);
+	static void sendLoco(uint8_t num, const char *cmd, const char *address);
+	static int8_t acquire(uint8_t num, const char *address, bool steal);
+	static bool release(uint8_t num, uint16_t key, bool tell);
+	static JTLOCO *findHeld(uint8_t num, uint16_t key);
+	static uint16_t addrKey(const char *address);
+	static uint16_t locoKey(int8_t slot);
+	static void clientTimeout(void *arg);
+
+}
+#endif
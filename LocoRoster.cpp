@@ -0,0 +1,457 @@
+//
+//
+//
+
+#include "LocoRoster.h"
+#include "DCCcore.h"
+#include "DCCstore.h"
+
+/*
+2026-10-19 loco roster.  The controller previously knew only the MAX_LOCO loco[] slots, so a club roster of a
+few hundred decoders could not be held, and a loco bumped from its slot by findLoco lost its name and speed steps.
+
+The roster is now a log of fixed size LOCOREC records in ROSTER_FILE, each carrying the address, name, speed
+steps, F0-F12 labels and a speed table.  An edit appends a new record for the loco, a deletion appends a record
+flagged ROSTER_DELETED.  RAM holds only an index of key and record number, sorted by key, built by one
+sequential read at boot.  A listing reads one record at a time, so neither WiThrottle RL nor the web page needs
+the roster in RAM.  The log is rewritten with just the live records once it holds ROSTER_SLACK superseded
+records, at boot or when track power is off.  It is never rewritten with power on.  A damaged log holds its
+edits until power is off and it can be rewritten.
+
+loco[] remains the set of slots the packet engine refreshes.  A slot is paged from the roster when a loco is
+acquired into it, findLoco choosing the least recently used stationary slot when none is free.  Labels and
+speed table for a slot are held in m_slotRec, the name and speed steps in loco[] as before.  Slot edits from the
+keypad or web page are written back to the roster by sync, which runs from dccFlushSettings, so writes follow the
+same deferral as the settings store.  A slot that changes address without page or release being called, e.g. a
+keypad edit, is bound to its new entry by sync.  Edits to entries not in a slot wait in m_pending.
+*/
+
+using namespace nsLocoRoster;
+
+static ROSTERENTRY m_index[ROSTER_MAX];
+static ROSTERSTATS m_stats;
+static File m_file;
+static bool m_damaged = false;		//the log needs rewriting
+
+static LOCOREC m_slotRec[MAX_LOCO];		//labels and speed table of the loco in each slot
+static uint16_t m_slotKey[MAX_LOCO];	//entry each slot is bound to, 0 if none
+static uint32_t m_slotCrc[MAX_LOCO];	//crc of that entry as last written or read, 0 if never written
+
+static LOCOREC m_pending[ROSTER_PENDING];
+static uint8_t m_pendingCount = 0;
+
+
+uint16_t nsLocoRoster::key(uint16_t address, bool useLong) {
+	uint16_t k = address & 0x3FFF;
+	if (useLong) k |= 0x8000;
+	return k;
+}
+
+uint16_t nsLocoRoster::count(void) {
+	return m_stats.count;
+}
+
+const ROSTERSTATS &nsLocoRoster::getStats(void) {
+	return m_stats;
+}
+
+/*binary search, returns the position of key or where it would be inserted*/
+int16_t nsLocoRoster::findIndex(uint16_t key, bool &found) {
+	int16_t lo = 0;
+	int16_t hi = m_stats.count;
+	while (lo < hi) {
+		int16_t mid = (lo + hi) / 2;
+		if (m_index[mid].key < key) lo = mid + 1;
+		else hi = mid;
+	}
+	found = lo < m_stats.count && m_index[lo].key == key;
+	return lo;
+}
+
+/*apply a record to the index, as read at boot or just appended*/
+void nsLocoRoster::indexRec(const LOCOREC &r, uint16_t rec) {
+	bool found;
+	uint16_t k = key(r.address, r.flags & ROSTER_LONG);
+	int16_t i = findIndex(k, found);
+	if (r.flags & ROSTER_DELETED) {
+		if (!found) return;
+		memmove(&m_index[i], &m_index[i + 1], (m_stats.count - i - 1) * sizeof(ROSTERENTRY));
+		--m_stats.count;
+		return;
+	}
+	if (found) {
+		m_index[i].rec = rec;
+		return;
+	}
+	if (m_stats.count >= ROSTER_MAX) {
+		++m_stats.full;
+		return;
+	}
+	memmove(&m_index[i + 1], &m_index[i], (m_stats.count - i) * sizeof(ROSTERENTRY));
+	m_index[i].key = k;
+	m_index[i].rec = rec;
+	++m_stats.count;
+}
+
+int8_t nsLocoRoster::findPending(uint16_t key) {
+	for (uint8_t i = 0; i < m_pendingCount; ++i) {
+		if (nsLocoRoster::key(m_pending[i].address, m_pending[i].flags & ROSTER_LONG) == key) return i;
+	}
+	return ROSTER_NONE;
+}
+
+void nsLocoRoster::seal(LOCOREC &r) {
+	r.magic = ROSTER_MAGIC;
+	r.crc = nsDCCstore::crc32(0, (const uint8_t*)&r, offsetof(LOCOREC, crc));
+}
+
+bool nsLocoRoster::valid(const LOCOREC &r) {
+	return r.magic == ROSTER_MAGIC && r.crc == nsDCCstore::crc32(0, (const uint8_t*)&r, offsetof(LOCOREC, crc));
+}
+
+bool nsLocoRoster::readRec(uint16_t rec, LOCOREC &r) {
+	if (rec == ROSTER_UNWRITTEN || !m_file) return false;
+	++m_stats.reads;
+	if (!m_file.seek((uint32_t)rec * sizeof(LOCOREC))) return false;
+	if (m_file.read((uint8_t*)&r, sizeof(LOCOREC)) != sizeof(LOCOREC)) return false;
+	return valid(r);
+}
+
+/*r must be sealed.  writes at the end of the log, the file is opened for append*/
+bool nsLocoRoster::append(const LOCOREC &r) {
+	if (!m_file) return false;
+	if (m_file.write((const uint8_t*)&r, sizeof(LOCOREC)) != sizeof(LOCOREC)) {
+		//a partial record would misalign the rest of the log
+		m_damaged = true;
+		return false;
+	}
+	indexRec(r, m_stats.records++);
+	++m_stats.appends;
+	return true;
+}
+
+/*the entry for the loco in a slot, as it stands.  Labels and speed table only if the slot is bound to it*/
+void nsLocoRoster::encodeSlot(int8_t slot, LOCOREC &r) {
+	LOCO &loc = loco[slot];
+	uint16_t k = key(loc.address, loc.useLongAddress);
+	if (m_slotKey[slot] == k) {
+		r = m_slotRec[slot];
+	}
+	else {
+		memset(&r, 0, sizeof(r));
+	}
+	r.address = loc.address;
+	r.flags = (loc.use128 ? ROSTER_USE128 : 0) | (loc.useLongAddress ? ROSTER_LONG : 0);
+	memset(r.name, '\0', sizeof(r.name));
+	strncpy(r.name, loc.name, sizeof(r.name) - 1);
+	seal(r);
+}
+
+/*bind a slot to the entry for its address.  fromRoster copies the entry's name and speed steps into the slot,
+otherwise the slot's own values stand and are written by the next sync.  Creates the entry if there is none.
+returns true if the entry existed*/
+bool nsLocoRoster::bindSlot(int8_t slot, bool fromRoster) {
+	LOCO &loc = loco[slot];
+	uint16_t k = key(loc.address, loc.useLongAddress);
+	m_slotKey[slot] = k;
+	LOCOREC &r = m_slotRec[slot];
+	bool found;
+	int16_t i = findIndex(k, found);
+	int8_t p = findPending(k);
+
+	if (p != ROSTER_NONE && (m_pending[p].flags & ROSTER_DELETED)) {
+		//deleted and now wanted again, the slot's record replaces the tombstone
+		m_pending[p] = m_pending[--m_pendingCount];
+		p = ROSTER_NONE;
+	}
+	if (p != ROSTER_NONE) {
+		//the slot now holds this edit
+		r = m_pending[p];
+		m_pending[p] = m_pending[--m_pendingCount];
+		m_slotCrc[slot] = 0;
+	}
+	else if (found && readRec(m_index[i].rec, r)) {
+		m_slotCrc[slot] = r.crc;
+	}
+	else {
+		memset(&r, 0, sizeof(r));
+		m_slotCrc[slot] = 0;
+		if (!found) {
+			r.address = loc.address;
+			r.flags = loc.useLongAddress ? ROSTER_LONG : 0;
+			indexRec(r, ROSTER_UNWRITTEN);
+		}
+		return false;
+	}
+
+	if (fromRoster) {
+		loc.use128 = (r.flags & ROSTER_USE128) != 0;
+		memset(loc.name, '\0', sizeof(loc.name));
+		strncpy(loc.name, r.name, sizeof(loc.name) - 1);
+	}
+	return true;
+}
+
+/*hold an edit until the next write.  Once the list is full the write is made due, and dccTick makes it at its
+next safe point.  Not written here, this can be reached from a TCP callback.  false if the list is still full*/
+bool nsLocoRoster::stash(const LOCOREC &r) {
+	int8_t p = findPending(key(r.address, r.flags & ROSTER_LONG));
+	if (p == ROSTER_NONE) {
+		if (m_pendingCount >= ROSTER_PENDING) {
+			++m_stats.full;
+			nsDCCstore::hurry();
+			trace(Serial.printf("roster pending full %d\r\n", r.address);)
+			return false;
+		}
+		p = m_pendingCount++;
+	}
+	m_pending[p] = r;
+	if (m_pendingCount >= ROSTER_PENDING) nsDCCstore::hurry();
+	else nsDCCstore::defer();
+	return true;
+}
+
+
+/*call once settings are loaded, and before track power is applied.  Slots are bound to their entries, with the
+roster's name and speed steps.  Slot locos not yet in the roster are added, this imports the slots on first boot*/
+void nsLocoRoster::begin(void) {
+	LittleFS.begin();
+	m_file = LittleFS.open(ROSTER_FILE, "a+");
+	m_stats.count = 0;
+	m_stats.records = 0;
+	if (m_file) {
+		LOCOREC r;
+		m_file.seek(0);
+		while (m_file.read((uint8_t*)&r, sizeof(r)) == sizeof(r)) {
+			if (!valid(r)) {
+				m_damaged = true;
+				break;
+			}
+			indexRec(r, m_stats.records++);
+		}
+		//a short record at the end also means a damaged tail
+		if (m_file.size() != (uint32_t)m_stats.records * sizeof(LOCOREC)) m_damaged = true;
+	}
+	trace(Serial.printf("roster %d entries %d records\r\n", m_stats.count, m_stats.records);)
+
+	for (int8_t i = 0; i < MAX_LOCO; ++i) {
+		m_slotKey[i] = 0;
+		if (loco[i].address != 0) bindSlot(i, true);
+	}
+	sync(true);
+}
+
+/*entry n in address order, false once n is past the end.  Slot locos are reported as they stand, which may be
+ahead of the log.  An entry that cannot be read is reported by its address alone*/
+bool nsLocoRoster::get(uint16_t n, LOCOREC &r) {
+	if (n >= m_stats.count) return false;
+	uint16_t k = m_index[n].key;
+	if (lookup(k, r)) return true;
+	memset(&r, 0, sizeof(r));
+	r.address = k & 0x3FFF;
+	r.flags = (k & 0x8000) ? ROSTER_LONG : 0;
+	return true;
+}
+
+bool nsLocoRoster::lookup(uint16_t key, LOCOREC &r) {
+	int8_t s = slotOf(key);
+	if (s != ROSTER_NONE) {
+		encodeSlot(s, r);
+		return true;
+	}
+	int8_t p = findPending(key);
+	if (p != ROSTER_NONE) {
+		r = m_pending[p];
+		return (r.flags & ROSTER_DELETED) == 0;
+	}
+	bool found;
+	int16_t i = findIndex(key, found);
+	if (!found) return false;
+	return readRec(m_index[i].rec, r);
+}
+
+/*the slot holding a loco, or ROSTER_NONE*/
+int8_t nsLocoRoster::slotOf(uint16_t key) {
+	for (int8_t i = 0; i < MAX_LOCO; ++i) {
+		if (loco[i].address != 0 && nsLocoRoster::key(loco[i].address, loco[i].useLongAddress) == key) return i;
+	}
+	return ROSTER_NONE;
+}
+
+/*acquire a loco into a slot, in place of setting loco[slot].address.  The loco leaving the slot is kept in the
+roster, with any unwritten edits.  Name and speed steps come from the roster, a loco not in the roster is added
+with an empty name*/
+void nsLocoRoster::page(int8_t slot, uint16_t address, bool useLong) {
+	if (slot < 0 || slot >= MAX_LOCO) return;
+	LOCO &loc = loco[slot];
+	uint16_t k = key(address, useLong);
+	if (loc.address == address && loc.useLongAddress == useLong && m_slotKey[slot] == k) return;
+	release(slot);
+	loc.address = address;
+	loc.useLongAddress = useLong;
+	if (!bindSlot(slot, true)) {
+		memset(loc.name, '\0', sizeof(loc.name));
+		nsDCCstore::defer();
+	}
+}
+
+/*call before overwriting a slot with another loco.  Unwritten edits to the loco leaving are held for the next write*/
+void nsLocoRoster::release(int8_t slot) {
+	if (slot < 0 || slot >= MAX_LOCO) return;
+	uint16_t k = m_slotKey[slot];
+	if (k == 0 || loco[slot].address == 0 || key(loco[slot].address, loco[slot].useLongAddress) != k) {
+		m_slotKey[slot] = 0;
+		return;
+	}
+	LOCOREC r;
+	encodeSlot(slot, r);
+	m_slotKey[slot] = 0;
+	if (r.crc != m_slotCrc[slot]) stash(r);
+}
+
+/*add or replace an entry, e.g. from the web page.  If the loco is in a slot the slot is updated*/
+bool nsLocoRoster::put(const LOCOREC &in) {
+	if (in.address == 0) return false;
+	LOCOREC r = in;
+	r.flags &= ROSTER_USE128 | ROSTER_LONG;
+	r.name[sizeof(r.name) - 1] = '\0';
+	for (auto &l : r.labels) l[ROSTER_LABEL_LEN - 1] = '\0';
+	uint16_t k = key(r.address, r.flags & ROSTER_LONG);
+
+	int8_t s = slotOf(k);
+	if (s != ROSTER_NONE) {
+		if (m_slotKey[s] != k) bindSlot(s, false);
+		memcpy(m_slotRec[s].labels, r.labels, sizeof(r.labels));
+		memcpy(m_slotRec[s].speedTable, r.speedTable, sizeof(r.speedTable));
+		loco[s].use128 = (r.flags & ROSTER_USE128) != 0;
+		memset(loco[s].name, '\0', sizeof(loco[s].name));
+		strncpy(loco[s].name, r.name, sizeof(loco[s].name) - 1);
+		nsDCCstore::defer();
+		return true;
+	}
+
+	bool found;
+	findIndex(k, found);
+	if (!found && m_stats.count >= ROSTER_MAX) {
+		++m_stats.full;
+		return false;
+	}
+	//on the index only once the record is held, so there is never an entry with nothing behind it
+	seal(r);
+	if (!stash(r)) return false;
+	if (!found) indexRec(r, ROSTER_UNWRITTEN);
+	return true;
+}
+
+/*delete an entry.  Not permitted while the loco is in a slot*/
+bool nsLocoRoster::remove(uint16_t key) {
+	if (slotOf(key) != ROSTER_NONE) return false;
+	bool found;
+	int16_t i = findIndex(key, found);
+	if (!found) return false;
+	LOCOREC r;
+	memset(&r, 0, sizeof(r));
+	r.address = key & 0x3FFF;
+	r.flags = ROSTER_DELETED | ((key & 0x8000) ? ROSTER_LONG : 0);
+	if (m_index[i].rec == ROSTER_UNWRITTEN) {
+		//never written, so nothing to delete from the log
+		int8_t p = findPending(key);
+		if (p != ROSTER_NONE) m_pending[p] = m_pending[--m_pendingCount];
+		indexRec(r, ROSTER_UNWRITTEN);
+		return true;
+	}
+	//off the index once the tombstone is held, it follows with the next write
+	seal(r);
+	if (!stash(r)) return false;
+	indexRec(r, ROSTER_UNWRITTEN);
+	return true;
+}
+
+/*write slot edits and pending edits to the log.  Call from dccFlushSettings, which covers the stall.
+mayCompact permits a rewrite of the log to drop superseded records, pass true only with track power off*/
+void nsLocoRoster::sync(bool mayCompact) {
+	for (int8_t i = 0; i < MAX_LOCO; ++i) {
+		LOCO &loc = loco[i];
+		if (loc.address == 0) {
+			m_slotKey[i] = 0;
+			continue;
+		}
+		//slot edited to another loco without a page
+		if (m_slotKey[i] != key(loc.address, loc.useLongAddress)) bindSlot(i, false);
+		//past a damaged tail an append would be misaligned, the edit waits for the rewrite
+		if (m_damaged) continue;
+		LOCOREC r;
+		encodeSlot(i, r);
+		if (r.crc != m_slotCrc[i] && append(r)) m_slotCrc[i] = r.crc;
+	}
+	uint8_t kept = 0;
+	for (uint8_t i = 0; i < m_pendingCount; ++i) {
+		if (m_damaged || !append(m_pending[i])) m_pending[kept++] = m_pending[i];
+	}
+	m_pendingCount = kept;
+	if (m_file) m_file.flush();
+
+	//slot and pending edits held back are written with the live records
+	if (mayCompact && compactDue()) compact();
+}
+
+/*true if the log should be rewritten at the next chance with track power off*/
+bool nsLocoRoster::compactDue(void) {
+	return m_damaged || m_stats.records > m_stats.count + ROSTER_SLACK;
+}
+
+/*rewrite the log with one record per entry, slot and pending edits included*/
+void nsLocoRoster::compact(void) {
+	File f = LittleFS.open(ROSTER_TEMP, "w");
+	if (!f) return;
+	bool ok = true;
+	uint16_t n = 0;
+	uint8_t skipped[(ROSTER_MAX + 7) / 8];	//entries with nothing to write, dropped from the index
+	memset(skipped, 0, sizeof(skipped));
+	for (uint16_t i = 0; i < m_stats.count && ok; ++i) {
+		LOCOREC r;
+		if (!lookup(m_index[i].key, r)) {
+			skipped[i / 8] |= 1 << (i % 8);
+			continue;
+		}
+		seal(r);
+		ok = f.write((const uint8_t*)&r, sizeof(r)) == sizeof(r);
+		++n;
+	}
+	f.close();
+	if (m_file) m_file.close();
+	//LittleFS rename replaces the old log in one step, a reset before it leaves the old log in place
+	if (!ok || !LittleFS.rename(ROSTER_TEMP, ROSTER_FILE)) {
+		LittleFS.remove(ROSTER_TEMP);
+		m_file = LittleFS.open(ROSTER_FILE, "a+");
+		return;
+	}
+	m_file = LittleFS.open(ROSTER_FILE, "a+");
+
+	//renumber, the log is now in index order
+	uint16_t kept = 0;
+	for (uint16_t i = 0; i < m_stats.count; ++i) {
+		if (skipped[i / 8] & (1 << (i % 8))) continue;
+		m_index[kept].key = m_index[i].key;
+		m_index[kept].rec = kept;
+		++kept;
+	}
+	m_stats.count = kept;
+	m_stats.records = n;
+	m_pendingCount = 0;
+	for (int8_t i = 0; i < MAX_LOCO; ++i) {
+		if (m_slotKey[i] == 0) continue;
+		LOCOREC r;
+		encodeSlot(i, r);
+		m_slotCrc[i] = r.crc;
+	}
+	m_damaged = false;
+	++m_stats.compactions;
+}
+
+/*function label for a slot's loco, empty if none*/
+const char *nsLocoRoster::label(int8_t slot, uint8_t fn) {
+	if (slot < 0 || slot >= MAX_LOCO || fn >= ROSTER_LABELS) return "";
+	if (m_slotKey[slot] != key(loco[slot].address, loco[slot].useLongAddress)) return "";
+	return m_slotRec[slot].labels[fn];
+}
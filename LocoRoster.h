@@ -0,0 +1,90 @@
+// LocoRoster.h
+//Loco roster of several hundred entries held in LittleFS, with the loco[] slots as an LRU working set paged from it
+
+#ifndef _LOCOROSTER_h
+#define _LOCOROSTER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "Global.h"
+#include <LittleFS.h>
+
+namespace nsLocoRoster {
+
+#define ROSTER_FILE			"/roster.dat"
+#define ROSTER_TEMP			"/roster.new"
+#define ROSTER_MAGIC		0x5A
+#define ROSTER_MAX			300    //entries in the roster, the index holds 4 bytes for each
+#define ROSTER_PENDING		8      //edits to entries not in a slot, held until the next write
+#define ROSTER_SLACK		64     //superseded records tolerated before compacting at boot or with track power off
+#define ROSTER_LABELS		13     //F0-F12
+#define ROSTER_LABEL_LEN	10
+#define ROSTER_STEPS		28     //speed table, all zero if not used
+#define ROSTER_NONE			-1
+
+	/*one fixed size record per write, appended to ROSTER_FILE.  crc covers everything ahead of it*/
+	struct LOCOREC {
+		uint8_t magic;
+		uint8_t flags;		//ROSTER_USE128, ROSTER_LONG, ROSTER_DELETED
+		uint16_t address;
+		char name[9];
+		uint8_t spare[3];
+		char labels[ROSTER_LABELS][ROSTER_LABEL_LEN];
+		uint8_t speedTable[ROSTER_STEPS];
+		uint32_t crc;
+	};
+#define ROSTER_USE128	0x01
+#define ROSTER_LONG		0x02
+#define ROSTER_DELETED	0x80
+
+	/*in RAM, sorted by key*/
+	struct ROSTERENTRY {
+		uint16_t key;		//address as for WiThrottle addrKey, bit 15 set for a long address
+		uint16_t rec;		//record number in ROSTER_FILE, or ROSTER_UNWRITTEN
+	};
+#define ROSTER_UNWRITTEN	0xFFFF  //held in a slot or the pending list until the next write
+
+	struct ROSTERSTATS {
+		uint16_t count;			//entries
+		uint16_t records;		//records in the log, live and superseded
+		uint32_t reads;			//records read from flash after boot
+		uint32_t appends;
+		uint32_t compactions;
+		uint32_t full;			//entries that could not be added, or edits that could not be held
+	};
+
+	/*function prototypes*/
+	void begin(void);
+	uint16_t key(uint16_t address, bool useLong);
+	uint16_t count(void);
+	bool get(uint16_t n, LOCOREC &r);
+	bool lookup(uint16_t key, LOCOREC &r);
+	int8_t slotOf(uint16_t key);
+	void page(int8_t slot, uint16_t address, bool useLong);
+	void release(int8_t slot);
+	bool put(const LOCOREC &r);
+	bool remove(uint16_t key);
+	void sync(bool mayCompact);
+	bool compactDue(void);
+	const char *label(int8_t slot, uint8_t fn);
+	const ROSTERSTATS &getStats(void);
+
+	/*local scope, hence declared static*/
+	static int16_t findIndex(uint16_t key, bool &found);
+	static void indexRec(const LOCOREC &r, uint16_t rec);
+	static int8_t findPending(uint16_t key);
+	static void seal(LOCOREC &r);
+	static bool valid(const LOCOREC &r);
+	static bool readRec(uint16_t rec, LOCOREC &r);
+	static bool append(const LOCOREC &r);
+	static void encodeSlot(int8_t slot, LOCOREC &r);
+	static bool bindSlot(int8_t slot, bool fromRoster);
+	static bool stash(const LOCOREC &r);
+	static void compact(void);
+
+}
+#endif
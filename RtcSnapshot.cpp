@@ -0,0 +1,187 @@
+//
+//
+//
+
+#include "RtcSnapshot.h"
+#include "DCCcore.h"
+#include "DCCstore.h"
+#include "WiThrottle.h"
+
+/*
+2026-10-19 runtime snapshot.  After any reset dccGetSettings zeroed every speed, direction, function and turnout
+state, the track stayed unpowered for the 4 second boot, and every WiThrottle had to reacquire its locos.  A
+watchdog reset or a brown-out that the ESP survives left the layout stopped and the operators starting again.
+
+RTC user memory keeps its contents through any reset other than loss of power.  A crash is resumed, i.e. a
+watchdog, soft watchdog or exception reset, and so is a brown-out.  The ESP8266 reports a brown-out that RTC
+memory survives as a power on reset, so a power on reset is resumed if the snapshot is intact.  A true power on
+has lost RTC memory and fails the crc.  After the reset button or a requested restart the snapshot is dropped and
+the boot is cold, so a deliberate reset stops the layout as it always has.  Every RTC_SAVE_MS the live state
+is encoded into an RTCSNAPSHOT: per slot the address, direction, speed and functions, the turnout states, and
+each WiThrottle throttle with the slot, MT and a hash of its client's HU.  It is written only if its crc differs
+from the last one written, a write of some 80 words taking a few microseconds.  No flash is involved.
+
+At boot, a crash or brown-out and a snapshot with a good magic, layout and crc means a warm reset.  dccGetSettings then
+restores the slots and turnouts from it.  If the track was live it is powered without the boot delay, if it was
+off, tripped or in eStop it stays off and locos are restored stopped.  Otherwise bootController.resumeMoving picks
+the policy, locos restored stopped, or at the speed they had.  Directions and functions are restored either way.
+startThrottle then puts the throttles back in the pool unclaimed, and a client sending the same HU on reconnect
+takes them over as if it had never left.  A throttle whose client does not return is stopped and later dropped,
+see nsWiThrottle::resumeTimeout.
+
+A resume that leads straight to another reset, e.g. a loco that stalls and trips the supply, would repeat.  The
+snapshot counts resumes, and after RTC_MAX_RESUMES without RTC_STABLE_MS of running between them locos are
+restored stopped regardless of the policy.  A cold start finds garbage in RTC memory and fails the crc.
+*/
+
+using namespace nsRtcSnapshot;
+
+static_assert(sizeof(RTCSNAPSHOT) <= RTC_BYTES, "RTC snapshot exceeds RTC user memory");
+static_assert(MAX_TURNOUT <= 32, "RTCSNAPSHOT.thrown holds 32 turnouts");
+
+static RTCSNAPSHOT m_snap;		//as last written, or as read at boot
+static RTCSNAPSHOT m_next;		//being encoded, static to keep it off the stack
+static RTCSTATS m_stats;
+static nsTimerWheel::TIMER m_saveTimer;
+static nsTimerWheel::TIMER m_stableTimer;
+
+
+/*crc of everything ahead of the crc field*/
+void nsRtcSnapshot::seal(RTCSNAPSHOT &s) {
+	s.crc = nsDCCstore::crc32(0, (const uint8_t*)&s, offsetof(RTCSNAPSHOT, crc));
+}
+
+/*call from dccGetSettings once the settings are loaded.  true if a snapshot was restored, the caller then skips
+the boot delay*/
+bool nsRtcSnapshot::restore(void) {
+	memset(&m_stats, 0, sizeof(m_stats));
+	RTCSNAPSHOT &s = m_snap;
+	bool ok = ESP.rtcUserMemoryRead(RTC_OFFSET, (uint32_t*)&s, sizeof(s));
+	uint32_t crc = s.crc;
+	seal(s);
+	uint32_t reason = ESP.getResetInfoPtr()->reason;
+	//a brown-out reports as REASON_DEFAULT_RST, the crc tells it from a cold power on
+	bool warm = reason == REASON_WDT_RST || reason == REASON_EXCEPTION_RST || reason == REASON_SOFT_WDT_RST ||
+		reason == REASON_DEFAULT_RST;
+	if (!ok || !warm || s.magic != RTC_MAGIC || s.layout != sizeof(s) || s.crc != crc) {
+		//a deliberate reset is a cold boot, drop whatever is there
+		memset(&s, 0, sizeof(s));
+		ESP.rtcUserMemoryWrite(RTC_OFFSET, (uint32_t*)&s, sizeof(s));
+		return false;
+	}
+
+	bool live = (s.state & RTC_POWER) && !(s.state & (RTC_TRIP | RTC_ESTOP));
+	bool moving = live && bootController.resumeMoving && s.resumes < RTC_MAX_RESUMES;
+	for (uint8_t i = 0; i < MAX_LOCO; ++i) {
+		const RTCLOCO &r = s.loco[i];
+		LOCO &loc = loco[i];
+		//a slot changed within the settings write deferral is older in the store, the snapshot wins
+		if (loc.address != r.address || loc.useLongAddress != ((r.flags & RTC_LONG) != 0)) {
+			loc.address = r.address;
+			loc.useLongAddress = (r.flags & RTC_LONG) != 0;
+			loc.use128 = (r.flags & RTC_USE128) != 0;
+			bootController.isDirty = true;
+		}
+		if (loc.address == 0) continue;
+		loc.forward = (r.flags & RTC_FORWARD) != 0;
+		loc.function = r.function;
+		if (moving) {
+			loc.speed = r.speed;
+			loc.speedStep = r.speedStep;
+		}
+		loc.changeFlag = true;
+		loc.functionFlag = true;
+	}
+
+	//the turnouts have not moved, so no changeFlag.  It would have updateLocalMachine send them to line again
+	for (uint8_t i = 0; i < MAX_TURNOUT; ++i) {
+		turnout[i].thrown = (s.thrown >> i) & 1;
+	}
+
+	//count the resume now, in case it does not last until the first save
+	if (s.resumes < 0xFF) ++s.resumes;
+	seal(s);
+	ESP.rtcUserMemoryWrite(RTC_OFFSET, (uint32_t*)&s, sizeof(s));
+
+	m_stats.resumed = true;
+	m_stats.moving = moving;
+	m_stats.live = live;
+	m_stats.resumes = s.resumes;
+	m_stats.throttles = s.throttles;
+	trace(Serial.printf("RTC resume %d, %s, power %s, %d throttles\r\n", s.resumes, moving ? "moving" : "stopped", live ? "on" : "off", s.throttles);)
+	return true;
+}
+
+/*call from startThrottle once the throttle pool is cleared.  The restored throttles wait for their clients*/
+void nsRtcSnapshot::resumeThrottles(void) {
+	if (!m_stats.resumed) return;
+	for (uint8_t i = 0; i < m_snap.throttles && i < RTC_THROTTLES; ++i) {
+		const RTCTHROTTLE &r = m_snap.throttle[i];
+		if (r.slot < 0 || r.slot >= MAX_LOCO) continue;
+		nsWiThrottle::resumeThrottle(r, m_snap.loco[r.slot].consistID);
+	}
+}
+
+/*call once setup is complete, snapshots start from here*/
+void nsRtcSnapshot::begin(void) {
+	if (m_stats.resumed) nsTimerWheel::start(m_stableTimer, RTC_STABLE_MS, &stableTimer, nullptr);
+	save();
+}
+
+void nsRtcSnapshot::encode(RTCSNAPSHOT &s) {
+	memset(&s, 0, sizeof(s));
+	s.magic = RTC_MAGIC;
+	s.layout = sizeof(s);
+	s.resumes = m_stats.resumes;
+	if (power.trackPower) s.state |= RTC_POWER;
+	if (power.trip) s.state |= RTC_TRIP;
+	if (dccEstopActive()) s.state |= RTC_ESTOP;
+	for (uint8_t i = 0; i < MAX_TURNOUT; ++i) {
+		if (turnout[i].thrown) s.thrown |= 1UL << i;
+	}
+	for (uint8_t i = 0; i < MAX_LOCO; ++i) {
+		const LOCO &loc = loco[i];
+		RTCLOCO &r = s.loco[i];
+		r.address = loc.address;
+		r.flags = (loc.forward ? RTC_FORWARD : 0) | (loc.useLongAddress ? RTC_LONG : 0) | (loc.use128 ? RTC_USE128 : 0);
+		r.speedStep = loc.speedStep;
+		r.speed = loc.speed;
+		r.function = loc.function;
+		r.consistID = loc.consistID;
+	}
+	s.throttles = nsWiThrottle::snapshot(s.throttle, RTC_THROTTLES);
+}
+
+/*encode the live state and write it if it has changed.  Also called from the timer*/
+void nsRtcSnapshot::save(void) {
+	uint32_t t0 = micros();
+	encode(m_next);
+	seal(m_next);
+	if (m_next.crc != m_snap.crc) {
+		m_snap = m_next;
+		ESP.rtcUserMemoryWrite(RTC_OFFSET, (uint32_t*)&m_snap, sizeof(m_snap));
+		++m_stats.saves;
+		m_stats.save_us = micros() - t0;
+	}
+	nsTimerWheel::start(m_saveTimer, RTC_SAVE_MS, &saveTimer, nullptr);
+}
+
+void nsRtcSnapshot::saveTimer(void *arg) {
+	save();
+}
+
+/*the resume held, a later reset is not part of a loop*/
+void nsRtcSnapshot::stableTimer(void *arg) {
+	m_stats.resumes = 0;
+}
+
+/*HU identifiers can be 40 chars, the snapshot holds a hash.  0 is reserved for none*/
+uint32_t nsRtcSnapshot::huHash(const char *HU) {
+	if (HU == nullptr || HU[0] == '\0') return 0;
+	uint32_t h = nsDCCstore::crc32(0, (const uint8_t*)HU, strlen(HU));
+	return h == 0 ? 1 : h;
+}
+
+const RTCSTATS &nsRtcSnapshot::getStats(void) {
+	return m_stats;
+}
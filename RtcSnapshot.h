@@ -0,0 +1,91 @@
+// RtcSnapshot.h
+//Runtime state of locos, turnouts and WiThrottle ownership kept in RTC user memory, restored after a warm reset
+
+#ifndef _RTCSNAPSHOT_h
+#define _RTCSNAPSHOT_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+#include "Global.h"
+#include "TimerWheel.h"
+
+namespace nsRtcSnapshot {
+
+#define RTC_MAGIC		0x52544331  //RTC1
+#define RTC_OFFSET		32     //blocks of 4 bytes.  the first 128 bytes of user memory hold the OTA eboot command
+#define RTC_BYTES		384    //user memory from RTC_OFFSET to the end
+#define RTC_THROTTLES	24     //WiThrottle throttles held, any beyond this are not restored
+#define RTC_SAVE_MS		100    //snapshot interval, written only if something changed
+#define RTC_STABLE_MS	60000  //running this long after a resume clears the resume count
+#define RTC_MAX_RESUMES	3      //consecutive resumes after which locos are restored stopped regardless
+
+	struct RTCLOCO {
+		uint16_t address;
+		uint8_t flags;		//RTC_FORWARD, RTC_LONG, RTC_USE128
+		uint8_t speedStep;
+		float speed;
+		uint32_t function;
+		uint8_t consistID;
+		uint8_t spare[3];
+	};
+#define RTC_FORWARD		0x01
+#define RTC_LONG		0x02
+#define RTC_USE128		0x04
+
+	/*a WiThrottle throttle, identified by a hash of its client's HU so the client can claim it on reconnect*/
+	struct RTCTHROTTLE {
+		uint32_t hu;
+		int8_t slot;
+		char MT;
+		uint8_t orientation;
+		uint8_t spare;
+	};
+
+	/*crc covers everything ahead of it.  layout is the size of the struct, so a firmware with a different
+	layout ignores the snapshot*/
+	struct RTCSNAPSHOT {
+		uint32_t magic;
+		uint16_t layout;
+		uint8_t resumes;		//consecutive warm resumes without RTC_STABLE_MS between them
+		uint8_t throttles;
+		uint8_t state;			//RTC_POWER, RTC_TRIP, RTC_ESTOP
+		uint8_t spare[3];
+		uint32_t thrown;		//turnout states, bit n for turnout[n]
+		RTCLOCO loco[MAX_LOCO];
+		RTCTHROTTLE throttle[RTC_THROTTLES];
+		uint32_t crc;
+	};
+#define RTC_POWER		0x01
+#define RTC_TRIP		0x02
+#define RTC_ESTOP		0x04
+
+	struct RTCSTATS {
+		bool resumed;			//this boot restored a snapshot
+		bool moving;			//and restored the loco speeds
+		bool live;				//track was powered, not tripped and not in eStop before the reset
+		uint8_t resumes;
+		uint8_t throttles;		//WiThrottle throttles restored
+		uint32_t saves;
+		uint32_t save_us;		//last snapshot, including the crc
+	};
+
+	/*function prototypes*/
+	bool restore(void);
+	void resumeThrottles(void);
+	void begin(void);
+	void save(void);
+	uint32_t huHash(const char *HU);
+	const RTCSTATS &getStats(void);
+
+	/*local scope, hence declared static*/
+	static void saveTimer(void *arg);
+	static void stableTimer(void *arg);
+	static void encode(RTCSNAPSHOT &s);
+	static void seal(RTCSNAPSHOT &s);
+
+}
+#endif
@@ -0,0 +1,134 @@
+//
+//
+//
+
+#include "Scheduler.h"
+
+/*
+2026-10-19 main loop scheduler.  loop() previously called the web services, the three broadcasters,
+updateLocalMachine and DCCcore in a fixed order on every pass, and DCCcore and loop() each polled a flag for their
+10mS and 250mS work.  A slow web request held up everything behind it, including the packet engine, and the
+10mS work ran late by however long the rest of the pass took.
+
+Each subsystem is now a TASK with a period, a deadline and a priority.  run() is called once per pass of loop()
+and runs one task, of those whose release time has come the one with the earliest deadline, priority breaking
+a tie.  A task with period 0 is released again as soon as it has run, so it runs whenever nothing with an earlier
+deadline is due.  The next release of a periodic task is one period after the last, so a late task catches up
+once, but one that falls a whole period behind drops the missed releases.
+
+The packet engine is not a task.  It is the pump, run by run() ahead of every task, and a task that does several
+things in turn can call serve() between them.  Tasks are cooperative, so the pump can wait as long as the longest
+task runs.  That wait is measured as maxGap_us, and layer 1 repeats the last packet if the engine is late.
+
+Per task run time, overruns of the deadline and dropped releases are kept from boot.  Available as the websocket
+command "tasks" and on the serial console by typing tasks.
+*/
+
+using namespace nsScheduler;
+
+static TASK m_tasks[SCHED_TASKS];
+static uint8_t m_count = 0;
+static TASKFN m_pump = nullptr;
+static PUMPSTATS m_pumpStats;
+static uint32_t m_pumpAt = 0;	//micros() of the last serve
+
+
+/*the packet engine, run ahead of every task*/
+void nsScheduler::setPump(TASKFN fn) {
+	m_pump = fn;
+	m_pumpAt = micros();
+}
+
+/*register a task, first released now.  Returns its index, or -1 if the table is full*/
+int8_t nsScheduler::add(const char *name, TASKFN fn, uint16_t period, uint16_t deadline, uint8_t priority) {
+	if (m_count >= SCHED_TASKS || fn == nullptr) return -1;
+	TASK &t = m_tasks[m_count];
+	t.name = name;
+	t.fn = fn;
+	t.period = period;
+	t.deadline = deadline;
+	t.priority = priority;
+	t.release = millis();
+	return m_count++;
+}
+
+/*run the pump now.  Called by run(), and by a task between steps that each take a while*/
+void nsScheduler::serve(void) {
+	uint32_t now = micros();
+	uint32_t gap = now - m_pumpAt;
+	if (gap > m_pumpStats.maxGap_us) m_pumpStats.maxGap_us = gap;
+	if (gap > SCHED_PUMP_US) ++m_pumpStats.late;
+	m_pumpAt = now;
+	++m_pumpStats.runs;
+	if (m_pump != nullptr) m_pump();
+}
+
+/*earliest deadline among the tasks released by now, -1 if none are*/
+int8_t nsScheduler::pick(uint32_t now) {
+	int8_t best = -1;
+	int32_t bestLeft = 0;
+	for (uint8_t i = 0; i < m_count; ++i) {
+		TASK &t = m_tasks[i];
+		if ((int32_t)(now - t.release) < 0) continue;
+		//time left to the deadline, negative if already past it
+		int32_t left = (int32_t)(t.release + t.deadline - now);
+		if (best < 0 || left < bestLeft || (left == bestLeft && t.priority < m_tasks[best].priority)) {
+			best = i;
+			bestLeft = left;
+		}
+	}
+	return best;
+}
+
+/*call on every pass of loop()*/
+void nsScheduler::run(void) {
+	serve();
+	int8_t i = pick(millis());
+	if (i < 0) return;
+
+	TASK &t = m_tasks[i];
+	uint32_t t0 = micros();
+	t.fn();
+	uint32_t us = micros() - t0;
+	uint32_t now = millis();
+
+	++t.runs;
+	t.last_us = us;
+	t.total_us += us;
+	if (us > t.max_us) t.max_us = us;
+	if ((int32_t)(now - (t.release + t.deadline)) > 0) ++t.overruns;
+
+	if (t.period == 0) {
+		t.release = now;
+		return;
+	}
+	t.release += t.period;
+	if ((int32_t)(now - t.release) >= (int32_t)t.period) {
+		t.skipped += (now - t.release) / t.period;
+		t.release = now;
+	}
+}
+
+uint8_t nsScheduler::taskCount(void) {
+	return m_count;
+}
+
+const TASK &nsScheduler::getTask(uint8_t i) {
+	if (i >= m_count) i = 0;
+	return m_tasks[i];
+}
+
+const PUMPSTATS &nsScheduler::getPump(void) {
+	return m_pumpStats;
+}
+
+/*human readable report*/
+void nsScheduler::dump(Print &out) {
+	out.printf("pump runs %u maxGap %uus late %u\r\n", m_pumpStats.runs, m_pumpStats.maxGap_us, m_pumpStats.late);
+	out.printf("  task       period deadline pri      runs  overrun  skipped   last_us    max_us    avg_us\r\n");
+	for (uint8_t i = 0; i < m_count; ++i) {
+		const TASK &t = m_tasks[i];
+		out.printf("  %-10s %6u %8u %3u %9u %8u %8u %9u %9u %9u\r\n", t.name, t.period, t.deadline, t.priority,
+			t.runs, t.overruns, t.skipped, t.last_us, t.max_us, t.runs > 0 ? t.total_us / t.runs : 0);
+	}
+}
@@ -0,0 +1,57 @@
+// Scheduler.h
+//Cooperative main loop scheduler.  Tasks have a period, deadline and priority, the packet engine is served ahead of each
+
+#ifndef _SCHEDULER_h
+#define _SCHEDULER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+namespace nsScheduler {
+
+#define SCHED_TASKS		8
+#define SCHED_PUMP_US	5000   //packet engine should be served within this, about the shortest packet on the wire
+#define SCHED_CONSOLE	"tasks"  //serial console command for dump, see nsHeapStats::pollSerial
+
+	typedef void(*TASKFN)(void);
+
+	struct TASK {
+		const char *name = nullptr;		//nullptr if this entry is free
+		TASKFN fn = nullptr;
+		uint16_t period = 0;	//mS between releases, 0 is released again as soon as it has run
+		uint16_t deadline = 0;	//mS after release by which it should have completed
+		uint8_t priority = 0;	//lower wins between tasks with the same deadline
+		uint32_t release = 0;	//millis() at which it is next due
+		/*stats*/
+		uint32_t runs = 0;
+		uint32_t overruns = 0;	//completed after the deadline
+		uint32_t skipped = 0;	//releases dropped because the task fell a whole period behind
+		uint32_t last_us = 0;
+		uint32_t max_us = 0;
+		uint32_t total_us = 0;	//wraps after an hour or so of run time, use for averages over short spans
+	};
+
+	struct PUMPSTATS {
+		uint32_t runs;
+		uint32_t maxGap_us;		//longest time the packet engine went unserved
+		uint32_t late;			//gaps over SCHED_PUMP_US
+	};
+
+	/*function prototypes*/
+	void setPump(TASKFN fn);
+	int8_t add(const char *name, TASKFN fn, uint16_t period, uint16_t deadline, uint8_t priority);
+	void run(void);
+	void serve(void);
+	uint8_t taskCount(void);
+	const TASK &getTask(uint8_t i);
+	const PUMPSTATS &getPump(void);
+	void dump(Print &out);
+
+	/*local scope, hence declared static*/
+	static int8_t pick(uint32_t now);
+
+}
+#endif
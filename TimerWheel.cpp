@@ -0,0 +1,109 @@
+//
+//
+//
+
+#include "TimerWheel.h"
+
+/*
+2026-10-19 hierarchical timer wheel.  Previously each module decremented its own countdowns on the 250mS tick,
+eStop per loco, CV and POM display timeouts, the general machine timer and the WiThrottle client heartbeats,
+so the idle cost grew with the number of locos and clients.
+
+A timer is placed in a slot on level 0 if it expires within 32 ticks, otherwise on level 1 or 2 according
+to how far away it is.  Each tick fires the current level 0 slot.  When level 0 wraps, the next level 1 slot
+is redistributed to level 0, and likewise level 2 into level 1.  Insert and cancel are O(1) using an
+intrusive doubly linked list, and a tick with nothing due touches a single slot.
+
+Resolution is the 10mS tick, delays are rounded up to whole ticks so a timer never fires early.
+Callbacks run from DCCcore in the main loop context, never from an interrupt, so no locking is required.
+A callback may start or cancel any timer, including its own.
+*/
+
+using namespace nsTimerWheel;
+
+static TIMER *m_wheel[TIMER_LEVELS][TIMER_SLOTS];
+static uint32_t m_now = 0;  //ticks since boot
+static uint16_t m_active = 0;
+
+
+/*arm a timer. If it is already pending, it is rescheduled. ms is rounded up to whole ticks*/
+void nsTimerWheel::start(TIMER &t, uint32_t ms, TIMERFN callback, void *arg) {
+	cancel(t);
+	uint32_t ticks = (ms + TIMER_TICK_MS - 1) / TIMER_TICK_MS;
+	if (ticks == 0) ticks = 1;
+	//clamp to the range of the wheel
+	const uint32_t maxTicks = (1UL << (TIMER_SLOT_BITS * TIMER_LEVELS)) - 1;
+	if (ticks > maxTicks) ticks = maxTicks;
+	t.callback = callback;
+	t.arg = arg;
+	t.expires = m_now + ticks;
+	insert(t);
+	++m_active;
+}
+
+void nsTimerWheel::cancel(TIMER &t) {
+	if (t.pprev == nullptr) return;
+	*t.pprev = t.next;
+	if (t.next != nullptr) t.next->pprev = t.pprev;
+	t.next = nullptr;
+	t.pprev = nullptr;
+	--m_active;
+}
+
+bool nsTimerWheel::pending(const TIMER &t) {
+	return t.pprev != nullptr;
+}
+
+/*mS until the timer fires, 0 if not pending*/
+uint32_t nsTimerWheel::remaining(const TIMER &t) {
+	if (t.pprev == nullptr) return 0;
+	return (t.expires - m_now) * TIMER_TICK_MS;
+}
+
+/*number of pending timers, for debug*/
+uint16_t nsTimerWheel::active(void) {
+	return m_active;
+}
+
+/*place the timer on a level according to how far away it is*/
+void nsTimerWheel::insert(TIMER &t) {
+	uint32_t delta = t.expires - m_now;
+	uint8_t level = 0;
+	while (level < TIMER_LEVELS - 1 && delta >= (1UL << (TIMER_SLOT_BITS * (level + 1)))) {
+		++level;
+	}
+	TIMER *&head = m_wheel[level][(t.expires >> (TIMER_SLOT_BITS * level)) & (TIMER_SLOTS - 1)];
+	t.next = head;
+	if (head != nullptr) head->pprev = &t.next;
+	head = &t;
+	t.pprev = &head;
+}
+
+/*move the timers in the current slot of a level down to the levels below*/
+void nsTimerWheel::cascade(uint8_t level) {
+	TIMER *&head = m_wheel[level][(m_now >> (TIMER_SLOT_BITS * level)) & (TIMER_SLOTS - 1)];
+	TIMER *t = head;
+	head = nullptr;
+	while (t != nullptr) {
+		TIMER *next = t->next;
+		insert(*t);
+		t = next;
+	}
+}
+
+/*advance the wheel one tick and fire anything now due. call every TIMER_TICK_MS*/
+void nsTimerWheel::tick(void) {
+	++m_now;
+	//level 0 wrapped, pull in the next slot from level 1, and from level 2 if level 1 also wrapped
+	for (uint8_t level = 1; level < TIMER_LEVELS; ++level) {
+		if ((m_now & ((1UL << (TIMER_SLOT_BITS * level)) - 1)) != 0) break;
+		cascade(level);
+	}
+	//a callback may restart its own timer, which cannot land in this slot as the minimum delay is one tick
+	TIMER *&head = m_wheel[0][m_now & (TIMER_SLOTS - 1)];
+	while (head != nullptr) {
+		TIMER *t = head;
+		cancel(*t);
+		if (t->callback != nullptr) t->callback(t->arg);
+	}
+}
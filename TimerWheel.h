@@ -0,0 +1,46 @@
+// TimerWheel.h
+//Hierarchical timer wheel.  Countdown timers register a deadline and a callback here instead of being
+//decremented on every tick by their owning module.
+
+#ifndef _TIMERWHEEL_h
+#define _TIMERWHEEL_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+namespace nsTimerWheel {
+
+#define TIMER_TICK_MS		10   //wheel advances on the DCCcore 10mS tick
+#define TIMER_SLOT_BITS		5
+#define TIMER_SLOTS			(1 << TIMER_SLOT_BITS)  //slots per level
+#define TIMER_LEVELS		3    //32 x 10mS, 32 x 320mS, 32 x 10.24s.  Longest delay is about 5 minutes
+
+	typedef void(*TIMERFN)(void *arg);
+
+	/*owned by the caller, typically a static or a member of a long lived struct. Must not be copied or
+	destroyed whilst pending*/
+	struct TIMER {
+		TIMERFN callback = nullptr;
+		void *arg = nullptr;
+		uint32_t expires = 0;		//wheel tick at which the timer fires
+		TIMER *next = nullptr;
+		TIMER **pprev = nullptr;	//nullptr if not pending
+	};
+
+	/*function prototypes*/
+	void start(TIMER &t, uint32_t ms, TIMERFN callback, void *arg);
+	void cancel(TIMER &t);
+	bool pending(const TIMER &t);
+	uint32_t remaining(const TIMER &t);
+	void tick(void);
+	uint16_t active(void);
+
+	/*local scope, hence declared static*/
+	static void insert(TIMER &t);
+	static void cascade(uint8_t level);
+
+}
+#endif
@@ -0,0 +1,973 @@
+// WebAssets.h
+//GENERATED by tools/embed_assets.py from data/, do not edit
+
+#ifndef _WEBASSETS_h
+#define _WEBASSETS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+	#include "Arduino.h"
+#else
+	#include "WProgram.h"
+#endif
+
+namespace nsWebAssets {
+
+	struct ASSET {
+		const char *path;
+		const char *contentType;
+		const char *etag;
+		const uint8_t *data;	//gzip, in flash
+		uint32_t length;
+	};
+
+	//hardware.htm 15267 bytes, minified 8426, gzip 3158
+	static const uint8_t asset_hardware_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x5a,0x7b,0x73,0xdb,0x36,0x12,0xff,0x5f,0x9f,
+		0x02,0xe1,0xf5,0x52,0xe9,0x6c,0x51,0x92,0xeb,0xa4,0xb6,0x5e,0x1d,0xd5,0xb1,0x1b,0xdf,0xd8,0x89,0xa7,
+		0x52,0x72,0xed,0xe5,0x7c,0x19,0x88,0x84,0x24,0xd4,0x24,0xc8,0x82,0x90,0x28,0x5d,0xe2,0xef,0x7e,0xbb,
+		0x00,0xf8,0xd2,0xc3,0xce,0xcd,0x35,0x8d,0x48,0x2e,0x16,0x3f,0x2c,0x16,0xfb,0x02,0x90,0xfe,0x42,0x85,
+		0x01,0x59,0x87,0x81,0x48,0x06,0xce,0x42,0xa9,0xb8,0xdb,0x6a,0xa5,0x69,0xea,0xa6,0x3f,0xb8,0x91,0x9c,
+		0xb7,0x3a,0xe7,0xe7,0xe7,0xad,0x35,0xf2,0x38,0xc3,0x5a,0x7f,0xc1,0xa8,0x0f,0x0f,0xc5,0x55,0xc0,0x86,
+		0x6f,0x2e,0x2e,0xc8,0xe5,0xf8,0x8e,0x78,0x91,0x50,0x32,0x0a,0x02,0x26,0x49,0x93,0x2c,0xa8,0xf4,0x53,
+		0x2a,0x59,0xbf,0x65,0x98,0x6a,0xfd,0x90,0x29,0x4a,0x04,0x0d,0xd9,0xc0,0x59,0x71,0x96,0xc6,0x91,0x54,
+		0x8e,0xee,0xc3,0x84,0x1a,0x38,0x29,0xf7,0xd5,0x62,0xe0,0xb3,0x15,0xf7,0x58,0x53,0x7f,0x1c,0x13,0x2e,
+		0xb8,0xe2,0x34,0x68,0x26,0x1e,0x0d,0xd8,0xa0,0xe3,0xb6,0x71,0xe8,0x44,0x6d,0x10,0xce,0x8d,0x96,0x0a,
+		0x06,0xfa,0x52,0x9b,0x46,0xd2,0x67,0xb2,0x4b,0x92,0x28,0xe0,0x7e,0xcf,0x7e,0x1a,0x84,0x2e,0xe9,0xc4,
+		0xeb,0x5e,0x2d,0xa6,0xbe,0xcf,0xc5,0xbc,0x19,0xb0,0x99,0xea,0x92,0x93,0x55,0xda,0xab,0x3d,0xda,0xfe,
+		0xbf,0x01,0x80,0xcf,0x93,0x38,0xa0,0x9b,0x2e,0x99,0x05,0x0c,0xb8,0xf1,0xb7,0xe9,0x73,0xc9,0x3c,0xc5,
+		0x23,0xd1,0x05,0x09,0x83,0x65,0x28,0x00,0x98,0x7a,0x0f,0x73,0x19,0x2d,0x85,0xdf,0x25,0x22,0x12,0xac,
+		0x57,0x5b,0x30,0x3e,0x5f,0x00,0x62,0xa7,0xdd,0xfe,0xab,0x86,0x54,0x92,0xc7,0x28,0x51,0xce,0xd9,0x84,
+		0xce,0x11,0xc8,0x16,0x49,0x2a,0xe6,0x4c,0x32,0xdf,0x8c,0x2c,0xf6,0x32,0x05,0x88,0x36,0x97,0x8c,0x09,
+		0xcd,0x25,0xa2,0x90,0x0b,0x1a,0x00,0xeb,0x8a,0x27,0x7c,0xca,0x03,0xae,0x40,0xc6,0x05,0xf7,0x7d,0xc3,
+		0xc0,0x45,0xbc,0x54,0x9f,0xd4,0x26,0x66,0x03,0xc5,0xd6,0xea,0x1e,0x18,0x67,0xa0,0xcc,0x66,0xc2,0xff,
+		0xc3,0xba,0xe4,0x74,0x05,0xbd,0x7b,0x35,0xab,0x86,0xd3,0x36,0x4e,0xda,0xea,0xa1,0x4b,0xda,0xf1,0x1a,
+		0xff,0xf6,0x6a,0x21,0x95,0x73,0x2e,0x2c,0x01,0x75,0xb7,0xc6,0xee,0x9a,0xc7,0xea,0x11,0x48,0x5b,0x83,
+		0x4d,0x97,0x4a,0x45,0x02,0x87,0xab,0x80,0xef,0x8e,0xfd,0x58,0xfb,0xf9,0xfd,0x9b,0xdf,0x81,0xef,0xea,
+		0xfd,0xbb,0x49,0x73,0x7c,0xfd,0xcf,0xcb,0xbc,0x49,0x53,0xae,0x46,0xb7,0xd7,0x37,0xbf,0x77,0xc9,0x47,
+		0x26,0x7d,0x2a,0xe8,0x31,0x19,0x49,0x58,0xec,0x63,0xf2,0x96,0x05,0x2b,0xa6,0xb8,0x07,0x94,0x84,0x8a,
+		0xa4,0x99,0x30,0xc9,0x67,0x80,0x16,0xef,0x9d,0xe1,0x63,0x4d,0xd1,0x69,0xc0,0x0e,0xb4,0xf5,0x5b,0xd6,
+		0x5c,0xfa,0x89,0x07,0x8b,0xa3,0x88,0x9e,0x82,0x83,0x0a,0x6b,0xfd,0x41,0x57,0xd4,0x50,0xc1,0xac,0x56,
+		0x54,0x92,0x34,0xf9,0x20,0x39,0x19,0x10,0x27,0x4d,0xc0,0xf6,0x3b,0xe7,0x27,0x6e,0xe7,0xf5,0x99,0xfb,
+		0xda,0xed,0x74,0x3b,0x27,0xed,0xb3,0x76,0xcb,0xe9,0x69,0xb6,0xcc,0xb2,0x81,0xf3,0x0b,0x71,0x10,0xd0,
+		0xe9,0x12,0xc7,0xf7,0xbc,0x0f,0xd7,0xce,0x31,0x71,0xbc,0xd0,0xc7,0xef,0x8c,0x0b,0x49,0xe3,0xf1,0xf5,
+		0x1b,0xa4,0x81,0xa3,0x7c,0x6e,0x9f,0x20,0xe5,0xfa,0x0e,0xbf,0x4b,0x43,0x20,0xf1,0x76,0x74,0xe1,0x74,
+		0x1d,0xc9,0xd4,0x52,0x0a,0x12,0xcd,0x88,0x5a,0xe8,0xde,0x71,0xaa,0x01,0xf1,0x35,0x4d,0xee,0xd0,0x6b,
+		0xc0,0xe4,0x50,0x20,0x24,0xf0,0x82,0x70,0x8e,0x04,0xaa,0xad,0x16,0xf9,0x63,0xf0,0x44,0x87,0x1c,0x3b,
+		0xe3,0xc9,0xe8,0xb3,0x11,0xc0,0x41,0xb3,0x75,0x0c,0x45,0x83,0x1a,0x02,0x79,0x34,0xf3,0xa2,0x4a,0xb1,
+		0x30,0x56,0x09,0xcc,0x0b,0x6c,0x61,0xb6,0x14,0x1a,0x0a,0x0c,0x21,0x52,0xf5,0x06,0xe8,0x97,0xcf,0x48,
+		0x3d,0xe7,0x19,0x82,0xd5,0x03,0x91,0x18,0x69,0x7b,0xe4,0xb1,0x96,0x35,0x1d,0x1d,0xf5,0xb6,0x59,0x4f,
+		0x74,0x77,0x70,0xe6,0x7f,0xb0,0x69,0x12,0x79,0x0f,0x0c,0x00,0x61,0x75,0x08,0x0b,0x12,0x5c,0x38,0x0c,
+		0x36,0xbf,0x00,0xcd,0x69,0xe5,0x4a,0x83,0xe6,0x84,0xa9,0x09,0x0f,0x19,0xb8,0x69,0x3d,0x97,0x05,0xe5,
+		0xb0,0x02,0xc1,0x90,0xc7,0xe4,0x87,0x76,0xbb,0x8d,0x48,0xf0,0x27,0xe7,0xc9,0xd0,0x40,0x7b,0x1f,0x64,
+		0x90,0x09,0x9e,0x72,0xe1,0x47,0xa9,0xfb,0xdb,0xed,0xcd,0x5b,0x68,0xff,0x95,0xfd,0xb9,0x64,0x89,0x82,
+		0xc6,0x56,0x0b,0x1c,0xdc,0x67,0x64,0x16,0x49,0x72,0x7d,0xf9,0xe3,0xd1,0x31,0xb9,0x02,0xd7,0x9f,0x45,
+		0xeb,0x63,0x72,0xb1,0x90,0x51,0xc8,0x8e,0xc9,0xfb,0x98,0x49,0xb0,0xc5,0x31,0x9d,0x51,0xc9,0x6b,0x10,
+		0x20,0x71,0x04,0x50,0x92,0x60,0x29,0xa9,0xe2,0xe9,0x59,0xd5,0xcc,0xac,0xaa,0xc0,0xaf,0x8f,0xe1,0xe7,
+		0xd5,0x56,0xe7,0x11,0x08,0xbc,0x62,0xbf,0xbd,0x9f,0xfe,0x01,0xb1,0xa6,0xee,0xdc,0x72,0x4f,0x46,0x49,
+		0x34,0x53,0x5a,0xca,0xc9,0xe4,0xce,0xd1,0x70,0xb6,0x0f,0x44,0x0d,0x09,0x41,0x77,0x93,0x28,0xaa,0x98,
+		0xb7,0xc0,0x78,0x02,0x30,0x15,0xcd,0xd4,0x94,0xdc,0xd8,0xe9,0x66,0x9d,0x74,0x97,0x31,0x76,0x21,0x83,
+		0x01,0x39,0x25,0x2f,0x5f,0x92,0xac,0x09,0x81,0x96,0x09,0x92,0x4f,0xda,0xed,0x4c,0x4d,0x10,0x8e,0x21,
+		0x8e,0x32,0x54,0xb3,0x7d,0x75,0x83,0x68,0x5e,0x82,0x4b,0x62,0x20,0xb3,0x09,0xf8,0x4f,0x23,0xb3,0x9b,
+		0x70,0x03,0x33,0x00,0x59,0xfe,0x3e,0x7e,0xff,0xce,0x8d,0xa9,0x4c,0xd8,0x7e,0x7e,0x63,0x16,0x2f,0x34,
+		0xbb,0x8b,0x6e,0xd3,0xc8,0xac,0x47,0x37,0x14,0x74,0xf2,0x62,0x90,0xf9,0x53,0xc1,0x52,0xf2,0x3a,0xcd,
+		0x09,0xb1,0xad,0xe2,0xae,0x0e,0x39,0xca,0x3d,0xd3,0xbd,0xbe,0x83,0x2f,0xb0,0xef,0x32,0xcd,0xf8,0x4e,
+		0x75,0x96,0xe5,0x39,0x6a,0x38,0x14,0x72,0xc7,0x4e,0xe1,0x8f,0x47,0x95,0xb7,0x20,0x75,0xb6,0xa3,0xa7,
+		0x32,0x02,0x73,0x43,0x96,0x24,0x74,0xce,0x6c,0xa7,0x7c,0xe5,0x62,0x26,0xea,0xce,0x2f,0x97,0x13,0x70,
+		0x61,0x63,0x95,0xf0,0x94,0x4b,0x64,0xcb,0x17,0x83,0x09,0xdf,0x8c,0x95,0xaf,0xe8,0x96,0x1c,0x4f,0x2f,
+		0x90,0x53,0xe1,0x76,0xf4,0xda,0x94,0xfc,0xb9,0x03,0x0e,0x9d,0x66,0xad,0xd6,0xfa,0x80,0x7b,0x6c,0xb0,
+		0xb3,0x99,0xe7,0x1c,0xee,0x14,0x32,0x8f,0xdc,0x4c,0x70,0x2d,0x40,0xbf,0x54,0x4a,0xba,0x99,0x2e,0x67,
+		0x33,0x26,0x9d,0x32,0x57,0x24,0x70,0x66,0x15,0x2b,0x64,0x2b,0x74,0xaa,0x5a,0x24,0xde,0xe3,0x9c,0xf1,
+		0xab,0xf6,0x58,0xed,0xe2,0x05,0x51,0xc2,0xf6,0xf7,0xb9,0xc0,0xa6,0xbd,0x9d,0xac,0x5e,0xf7,0x77,0xbb,
+		0x35,0x8d,0x7b,0x3b,0x32,0x29,0xc1,0xff,0xf6,0x76,0xbb,0xc4,0xa6,0xbc,0x53,0x49,0xf1,0x25,0xe1,0x31,
+		0xc9,0xe5,0x68,0x7a,0x8d,0xb4,0x91,0x27,0x90,0xe8,0xc5,0x9c,0xcf,0x36,0xf5,0x27,0x12,0x40,0xb2,0x9c,
+		0x62,0x76,0x99,0xea,0x18,0xae,0xa2,0x98,0x7b,0x09,0x90,0x3f,0xdd,0x93,0xc7,0x86,0x75,0x85,0x62,0x2d,
+		0x6b,0x95,0xb5,0x2c,0x56,0x0a,0xf5,0x6b,0xa2,0x00,0x44,0xc3,0xb7,0xd6,0x92,0xeb,0x26,0xb4,0x37,0xb6,
+		0x84,0x2e,0xb4,0xb7,0x63,0x2a,0x87,0xe0,0xf5,0x5a,0x38,0xdb,0x01,0xb4,0xac,0x9a,0x6f,0x86,0xd2,0x8a,
+		0xde,0x03,0x55,0x5e,0x1c,0x0b,0x06,0xaf,0xae,0x4f,0xa1,0x16,0xe4,0x02,0x62,0x90,0xf0,0x18,0xa4,0xba,
+		0x11,0x9a,0xd8,0xcf,0xda,0xc4,0xcc,0xea,0x4c,0x58,0xc0,0xa0,0x60,0x94,0x9b,0x9c,0x1d,0xb0,0xb3,0x58,
+		0xf0,0x58,0xf3,0xd9,0x74,0x39,0x77,0xb9,0x80,0x05,0x7e,0x3b,0xb9,0xbd,0x81,0x15,0xce,0xd8,0x90,0x2b,
+		0xa6,0x5c,0xa8,0x0f,0xd7,0x5b,0x0e,0x55,0xa2,0xe7,0xb1,0xf2,0x40,0xfc,0xda,0x82,0xdf,0x17,0xba,0xbe,
+		0x94,0xa4,0x79,0x22,0x7c,0xed,0x67,0x03,0x13,0xc1,0xc0,0x5b,0x14,0x09,0xcf,0x29,0xda,0x04,0x6b,0xa3,
+		0xdf,0xdd,0x48,0x88,0xe9,0xdd,0x5d,0xd1,0x60,0x89,0xb4,0x3c,0xe0,0x21,0x15,0x04,0x8f,0x47,0xbe,0x2f,
+		0x77,0x5b,0xaf,0xef,0xa0,0x20,0x4c,0xfd,0xdd,0x06,0x20,0x62,0x6c,0xc5,0x60,0xb9,0xdb,0x68,0xe8,0x58,
+		0x57,0x1e,0x68,0xe7,0xa6,0x3d,0xa4,0xde,0x6e,0x23,0xd4,0x37,0x90,0x31,0x98,0x4c,0x60,0x35,0x76,0x5b,
+		0x6d,0x03,0xcc,0xc6,0x16,0x2c,0x7b,0x66,0x64,0x5b,0x0c,0xcf,0x5e,0xe9,0x6d,0xc3,0x7e,0x75,0xab,0xcc,
+		0xa8,0xb4,0xbe,0xf1,0x0b,0x6b,0x71,0xab,0x46,0x17,0xc7,0xd6,0xb4,0x80,0x87,0x5c,0xe5,0xe4,0x70,0xf4,
+		0x59,0x13,0x7a,0x35,0x6f,0xf1,0x80,0x66,0xe9,0x7a,0x0b,0x06,0x36,0x0f,0x90,0xc4,0x42,0xfc,0x1f,0x39,
+		0x22,0xb7,0xce,0xb2,0x83,0x9b,0x22,0x0e,0x71,0xf2,0x79,0x19,0x12,0x0c,0x69,0x5e,0x4c,0xe6,0xe5,0xc9,
+		0x47,0x0a,0x9b,0x1e,0x14,0x04,0xd2,0x89,0x31,0x52,0x9e,0xbc,0xa3,0xef,0xea,0xe5,0xf5,0x6b,0xe8,0x30,
+		0x56,0x5d,0x50,0x07,0x02,0x79,0xd1,0x7b,0x46,0xa1,0x64,0x29,0x9b,0x96,0x5d,0xe7,0x41,0xb9,0x57,0x05,
+		0x9e,0x6f,0xc3,0xf3,0xff,0x0d,0x9e,0x1b,0x78,0x5e,0x86,0xc7,0x19,0x69,0xab,0x6e,0xfd,0xbb,0x5e,0x3f,
+		0x79,0xf5,0xa9,0xdd,0x7c,0x75,0xff,0xb5,0x7e,0x02,0xcf,0xd3,0xfb,0xaf,0x1d,0x78,0x9c,0xdf,0x7f,0xfd,
+		0xd4,0xc1,0xdf,0x86,0xfe,0x68,0xd4,0xff,0xe5,0xd6,0x7f,0x7a,0xf1,0x5d,0xe3,0xeb,0x77,0x8d,0xc6,0x97,
+		0xd3,0xc7,0xef,0x5a,0xf3,0xd0,0x3a,0x2a,0x0c,0xa1,0xb0,0x1e,0x2b,0x1b,0x3f,0xc8,0xb9,0x23,0xd2,0x13,
+		0x19,0xd5,0xf2,0x62,0x9d,0xa9,0xd9,0x0a,0x8b,0x74,0x03,0x26,0xe6,0x6a,0x01,0x75,0xed,0x69,0x65,0x89,
+		0x90,0x03,0xa0,0x0b,0xc6,0xcc,0x08,0x73,0x43,0x2d,0x7a,0xfe,0x48,0xbe,0x7e,0x25,0x39,0x7d,0x30,0x30,
+		0x95,0x78,0x05,0x0e,0x5a,0x01,0x2d,0xe7,0xc9,0xc0,0xaa,0xde,0x71,0x50,0x16,0xcb,0x85,0xf2,0x54,0x3a,
+		0x94,0x61,0x0e,0xc9,0xb5,0xe5,0x5c,0xb0,0x9c,0xbb,0xd2,0x59,0x1e,0x8b,0x5f,0x91,0x72,0xd7,0x66,0x33,
+		0xbd,0xff,0x64,0xad,0xb7,0x6b,0x32,0xd8,0x8e,0xfe,0xeb,0xd5,0x98,0x57,0x78,0x84,0xd3,0x28,0x55,0x9b,
+		0x18,0xa7,0xb3,0x70,0x5d,0x64,0xe2,0x6c,0x54,0xf0,0xab,0xdd,0xe4,0x60,0x3a,0xf5,0xb6,0x93,0xb9,0x21,
+		0x6b,0x4f,0x44,0xe8,0xc9,0xe5,0xcd,0xe5,0xe7,0xf1,0xe8,0xf6,0xee,0xe6,0x72,0x0c,0x9d,0x5e,0xb5,0xdb,
+		0x3d,0x42,0x5a,0xad,0x57,0xe0,0x9b,0x1e,0xec,0x8e,0xa0,0x8a,0x0a,0xc7,0x9a,0x11,0xdd,0xde,0xec,0xfe,
+		0xf4,0x56,0x4b,0x1b,0x13,0x24,0x79,0x1d,0x26,0xe0,0x1b,0xf7,0x61,0xe1,0x48,0x27,0x7b,0x78,0xfb,0x98,
+		0xbd,0xcc,0x02,0x3a,0x4f,0xb2,0x8f,0x84,0xfd,0x09,0xaf,0xcd,0x0e,0x76,0x8b,0x92,0xac,0x97,0x2f,0x69,
+		0x7a,0x07,0x92,0xc1,0x9c,0x32,0x5c,0x9c,0x77,0x39,0x48,0x14,0x89,0xb1,0x61,0xf3,0x97,0x8e,0x6e,0x4f,
+		0x6d,0x45,0x8b,0xb0,0x77,0x6c,0x25,0xde,0x8e,0x64,0x8f,0xbd,0x67,0xea,0x1c,0x40,0xc2,0xaa,0x05,0x91,
+		0x2e,0x40,0xd3,0xc0,0x84,0xdb,0x6a,0xd7,0x1e,0x9d,0xc0,0xf0,0xdb,0x88,0x3f,0x11,0x67,0x1a,0x00,0x9e,
+		0x43,0xba,0xd6,0x7c,0xb6,0xca,0x95,0x62,0x1e,0x50,0x59,0x66,0x53,0xf1,0x6d,0x6d,0xfa,0x06,0x12,0xf9,
+		0x47,0xce,0x52,0xdd,0x66,0xcc,0xc4,0x77,0xe7,0x4c,0x7d,0x80,0xfc,0x7d,0x56,0x87,0xdd,0x0a,0xa4,0xd8,
+		0xb3,0xd3,0x62,0x73,0xa0,0xd5,0x10,0x2d,0x05,0x46,0xed,0x12,0x63,0xa7,0x61,0x9a,0x40,0xd9,0xe5,0x86,
+		0xce,0xeb,0xfa,0x49,0x5e,0x81,0x23,0xb6,0x0e,0xe3,0xc8,0x34,0x84,0xad,0x2f,0xee,0x91,0xf0,0x1d,0x86,
+		0xa8,0x17,0x2d,0x47,0xa4,0xd3,0x20,0x2f,0x49,0x7b,0x7d,0x05,0xff,0x81,0x35,0x9a,0x44,0x01,0x2b,0x87,
+		0xdb,0xdd,0x9c,0x6b,0x80,0x3d,0xf1,0x2c,0x44,0x92,0xba,0x0e,0xd0,0x7a,0x2f,0x0d,0x8f,0xbe,0x11,0x0f,
+		0x5e,0x8f,0x8e,0xb2,0xc9,0x46,0xd0,0x78,0x06,0xc0,0x9c,0xfc,0x8d,0x9c,0x59,0x90,0x70,0xe4,0xc6,0xcb,
+		0x64,0x51,0x2f,0xcb,0x1a,0x01,0x4f,0x26,0xaf,0x5d,0x03,0xf7,0xe3,0x7e,0xb6,0x53,0xcb,0x46,0x5a,0x78,
+		0x28,0x95,0x31,0x6b,0xc3,0xdb,0xea,0x70,0xa6,0xf9,0x5f,0x37,0x72,0xe3,0x87,0x1d,0x9a,0xa4,0x59,0x4a,
+		0x03,0x31,0x6c,0x48,0x68,0x56,0xbc,0xc2,0xa8,0xcb,0xb0,0x0e,0x49,0x3b,0xcf,0xa2,0xc0,0x0f,0x86,0xc0,
+		0x3d,0x56,0x07,0x2b,0xd6,0xcd,0x85,0xa0,0x07,0x1a,0x8c,0x50,0xbb,0x8d,0x26,0x3c,0xbd,0xd0,0x3c,0x25,
+		0x77,0xc8,0x87,0x2a,0xd1,0xf2,0xbc,0x67,0x37,0xf7,0xd2,0xec,0xc2,0x47,0x82,0x87,0x14,0xad,0xec,0x4a,
+		0xd2,0x10,0x6a,0x39,0xe8,0x90,0x1b,0xdb,0x76,0xd6,0xad,0x34,0xd6,0x0f,0x0c,0x62,0x93,0x85,0x36,0x32,
+		0xb5,0xb6,0x3a,0x32,0x6e,0x00,0xda,0xbc,0xc0,0x13,0xcc,0x35,0xec,0xdf,0x4f,0x7c,0xc7,0xda,0x5b,0x5a,
+		0xe1,0xb1,0x87,0x99,0x8b,0x0a,0xd1,0x9c,0x1d,0x42,0x4d,0xa1,0xd6,0xae,0x17,0x30,0x2a,0x7f,0xc5,0x33,
+		0x00,0xd0,0x03,0xfc,0x9f,0x02,0xb3,0x45,0x12,0x3b,0x2b,0x62,0x96,0x40,0x60,0x58,0x6e,0x57,0x1d,0x00,
+		0xf6,0x18,0x19,0xb7,0x2d,0x58,0xf6,0xd9,0xa1,0xb0,0x36,0x98,0xdb,0x7d,0x38,0xfa,0xc4,0xef,0x61,0x35,
+		0xa1,0x7b,0xa3,0x8c,0xa1,0xe9,0xb0,0x58,0x86,0x02,0xbf,0x7f,0x23,0x1d,0xb7,0x83,0x8e,0x60,0x86,0xf3,
+		0x51,0x13,0x29,0x58,0x5a,0xd5,0x40,0x9e,0x1a,0xf3,0x4b,0xe1,0x6d,0x7a,0xf9,0x71,0xe0,0x97,0xe8,0x58,
+		0x5f,0x50,0xb1,0xee,0x8c,0x07,0xc1,0x18,0xe3,0x0a,0x56,0x10,0x7f,0x99,0x79,0x9e,0xd3,0xcb,0xe9,0x5a,
+		0x3d,0xe8,0x29,0xfe,0x5a,0xeb,0x08,0x46,0x07,0x49,0xb4,0xa2,0x88,0x3d,0x72,0xd9,0x87,0x7d,0xb6,0x1f,
+		0xdb,0x9b,0x7d,0x3b,0xb6,0x71,0x8f,0x4d,0x80,0x55,0x26,0xb8,0x43,0xa9,0x42,0x6c,0x59,0xb5,0x2c,0xcc,
+		0x32,0x42,0xb4,0x8c,0x1e,0x58,0x3e,0x88,0x64,0xbe,0x63,0x1b,0x98,0xba,0xe1,0x82,0xbd,0xa1,0xe0,0x80,
+		0x9f,0xc0,0x45,0x4f,0xef,0x1b,0xa6,0x61,0xca,0xe6,0x5c,0xdc,0x51,0xb5,0xc0,0xe3,0x2c,0x24,0x84,0xd1,
+		0x8a,0x4d,0x22,0x34,0x83,0x4d,0x60,0x49,0x01,0xf4,0x04,0x52,0x5a,0x22,0x99,0x81,0xea,0x8d,0x3d,0xe8,
+		0x19,0xf2,0x96,0x2c,0x53,0x48,0xcd,0xce,0xee,0x98,0xcf,0x2c,0x96,0x9e,0x77,0x79,0xda,0xc6,0x54,0x4a,
+		0xd3,0xd6,0x15,0xa1,0x35,0xc5,0x2d,0xf9,0x41,0x56,0xbd,0x2a,0xa5,0x39,0x64,0x2a,0x36,0x5e,0x58,0x9d,
+		0x09,0xe2,0xe3,0x29,0x51,0x25,0x6d,0x67,0x83,0x0a,0x10,0xa0,0x73,0x8f,0x47,0x3a,0xe1,0x88,0xe0,0xa1,
+		0x8e,0x09,0x2d,0x96,0xee,0xaa,0xe8,0x8a,0xaf,0x99,0x0f,0xe1,0x1e,0x59,0x3e,0x12,0xb3,0x3a,0x39,0x9f,
+		0xf9,0xd4,0x9d,0x91,0x56,0xcf,0x43,0x37,0x26,0x29,0xa2,0x5f,0x0a,0x5e,0xfc,0xc2,0xc3,0xd6,0x86,0x3d,
+		0x3d,0xd6,0xe7,0xc3,0x43,0x78,0xb3,0x37,0x1e,0xd3,0xc8,0xdf,0x40,0xf6,0x0a,0x22,0xea,0x0f,0x1c,0x73,
+		0x12,0x89,0x97,0x12,0x3e,0x5f,0xc1,0x6e,0x9a,0x26,0xc9,0xc0,0xd1,0xf7,0x0a,0x48,0x8b,0x87,0xfd,0x69,
+		0x7e,0x37,0x52,0x5c,0x87,0x4c,0x87,0xfd,0x56,0x8c,0x77,0x27,0xfa,0xd8,0xda,0x1c,0xb3,0x0f,0x9c,0xb6,
+		0x43,0x74,0x4a,0xb5,0x17,0x21,0x5d,0xbc,0x53,0x40,0x10,0x25,0x87,0xa4,0xaf,0x7c,0x62,0xae,0x47,0x9c,
+		0x53,0xa4,0x62,0x35,0xd7,0x6f,0x29,0x7f,0x58,0x6a,0x78,0x8d,0x0d,0x7d,0x7d,0x4c,0x5f,0x3a,0xe3,0x76,
+		0x08,0x07,0x31,0xf5,0xe9,0x2f,0x09,0xe9,0xda,0x44,0x90,0x81,0xd3,0x39,0x73,0x48,0x6b,0xa8,0x21,0x08,
+		0xfc,0xca,0x62,0x9c,0x61,0x0c,0x73,0x48,0x41,0xa6,0x0c,0xff,0x10,0x26,0x9e,0x1f,0x7f,0x23,0xe4,0xf5,
+		0x1d,0xa1,0x50,0x85,0xc3,0xb6,0xe7,0x39,0x50,0x53,0xae,0x1f,0x04,0x82,0xfd,0xe3,0x73,0x08,0xb0,0xef,
+		0x74,0x08,0x1e,0x7a,0xc2,0x12,0x6d,0x0e,0xe1,0xd8,0x9d,0xe6,0x73,0x58,0x96,0xed,0x79,0xbc,0xfc,0xdc,
+		0x8d,0xe0,0x9d,0xd6,0x73,0xb0,0xf6,0x0c,0xff,0x20,0x18,0x9f,0x2c,0x64,0xa4,0x14,0xd8,0xc6,0x37,0xa1,
+		0xf1,0x27,0xd1,0xf0,0xe8,0x17,0xf3,0x5c,0xd9,0x64,0x0e,0x9a,0x49,0x76,0x51,0xf0,0x8d,0xeb,0x9a,0x61,
+		0x7f,0xab,0xc9,0x64,0xd7,0x0e,0xcf,0xc3,0xd7,0xd0,0xb0,0xb1,0x0b,0x18,0xcd,0x32,0x50,0x8e,0x61,0xd0,
+		0x54,0xeb,0x24,0xd9,0x95,0x1e,0x44,0xa2,0x6e,0x67,0x95,0xf6,0xd0,0x55,0xca,0xa3,0x9a,0x4b,0x2a,0x33,
+		0xee,0x54,0x89,0x31,0x03,0x19,0xcc,0x56,0xcb,0x19,0x5f,0x4e,0x1c,0x82,0xe7,0x90,0xdc,0x7b,0x18,0x94,
+		0x37,0x19,0xf5,0xef,0x53,0xc9,0x15,0xfb,0xbe,0x81,0x22,0xd5,0xec,0x90,0xb9,0x4c,0x38,0xb8,0x17,0x05,
+		0x49,0x4c,0xc5,0xc0,0x39,0xc9,0xbd,0xb5,0xb8,0x74,0xd2,0x77,0x4e,0x56,0xd4,0xea,0x54,0x86,0x37,0x7c,
+		0x05,0x81,0x70,0x29,0x25,0x13,0x2a,0x9f,0x4a,0x55,0x4d,0xba,0x6e,0x9e,0x46,0x6b,0x23,0xb2,0xad,0xa6,
+		0xab,0x72,0x96,0xea,0x14,0x94,0x90,0xf4,0x51,0x16,0xcd,0x9e,0x05,0x4f,0x1c,0x1d,0x89,0xc3,0x67,0x84,
+		0x1f,0xf6,0x3d,0x2a,0x56,0x34,0xc9,0x3b,0xeb,0x9a,0xc4,0xc9,0x62,0x09,0x6c,0x7c,0x1c,0x62,0x0a,0x14,
+		0x58,0xa1,0x57,0x45,0x68,0xca,0x6e,0x4a,0xf5,0xf5,0xa7,0xe1,0xee,0x9e,0xe3,0xed,0x9f,0x0d,0x63,0xdd,
+		0x4e,0xbc,0x36,0xf7,0xb0,0x64,0x2e,0xe9,0xa6,0x87,0xf2,0x98,0x91,0x2a,0x6a,0x69,0xe9,0xd0,0x37,0xac,
+		0x5d,0xd0,0xa5,0xbd,0x62,0xc5,0xeb,0x0c,0xac,0xb5,0x28,0xee,0x70,0x14,0xbe,0xa5,0x90,0x97,0x09,0x16,
+		0x74,0x5c,0x32,0x20,0x4b,0xd6,0xc4,0x60,0x4b,0xa8,0xf0,0xc9,0x26,0x5a,0x9a,0x66,0xc1,0x60,0xa3,0xa1,
+		0x22,0x22,0xe8,0x8a,0xcf,0xf1,0x8a,0x43,0x2d,0x98,0xde,0x3e,0xa0,0x15,0xb7,0xae,0xef,0xdc,0xda,0xf5,
+		0x4c,0x73,0xdb,0xeb,0x12,0x6c,0x2e,0x7c,0x15,0x52,0xdf,0x96,0xaf,0x1d,0x6b,0x66,0x28,0xf6,0xa2,0x1c,
+		0x7a,0x19,0xfb,0x16,0x18,0x52,0x19,0xd8,0x3a,0x30,0x48,0x12,0x2f,0x60,0xfe,0x84,0xc6,0x71,0xe2,0x42,
+		0x42,0x90,0xb0,0x16,0x7a,0xab,0x1d,0x2e,0x21,0x77,0x4c,0x19,0x39,0x3d,0xc2,0x01,0x25,0x6c,0x75,0x21,
+		0x80,0x1c,0xe7,0xee,0x91,0xb7,0x9f,0x95,0xdb,0x33,0x84,0xec,0x51,0x76,0x58,0xd8,0x37,0x9b,0x01,0x17,
+		0x51,0x08,0x92,0xf3,0x2b,0x0e,0x72,0x29,0xc0,0x7a,0x70,0x09,0x01,0x93,0x26,0xd3,0x80,0x8a,0x07,0xac,
+		0x7b,0xb4,0x4a,0x28,0x6c,0x7f,0x44,0x84,0x87,0x18,0xc2,0xdc,0x5d,0xbb,0x16,0xf3,0x43,0x62,0xe6,0x0e,
+		0xf1,0x13,0xe7,0x04,0x2a,0x06,0x8d,0xce,0x30,0x65,0x92,0x22,0x36,0xe7,0xb3,0xd3,0x83,0x49,0x9d,0xc5,
+		0xdc,0xda,0xef,0x00,0x1c,0xc2,0x06,0xaf,0xa2,0x14,0xd4,0x55,0x13,0x4a,0x07,0x70,0x1a,0x3f,0x53,0x2a,
+		0xb1,0x5a,0xc5,0x05,0xda,0x52,0xeb,0xce,0x1c,0xfb,0x94,0x2c,0x24,0x9b,0x41,0xbc,0x17,0x3e,0x5b,0xbb,
+		0x0b,0x15,0x3a,0x43,0x1c,0xb5,0xdf,0xa2,0x43,0xc3,0x92,0x31,0xc6,0xda,0x42,0xf5,0x7e,0x3e,0x37,0xc2,
+		0xd2,0x6d,0xb8,0xbd,0x0c,0x27,0x85,0x13,0x9e,0x18,0x27,0x24,0x26,0xc5,0xb6,0x20,0x2d,0xe3,0x03,0x93,
+		0xb6,0xce,0xe1,0xf8,0x2f,0x1c,0x86,0xb5,0xff,0x02,0xe6,0x08,0x24,0x65,0xea,0x20,0x00,0x00,
+	};
+
+	//index.htm 11463 bytes, minified 5606, gzip 2109
+	static const uint8_t asset_index_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x58,0x6d,0x73,0xdb,0x36,0x12,0xfe,0xce,0x5f,
+		0x81,0x60,0xe6,0x32,0xf2,0x58,0x22,0x25,0x25,0x97,0x36,0x7a,0x71,0xc6,0xe7,0xd8,0x8d,0x6e,0x62,0x4b,
+		0x53,0x39,0xba,0xf4,0x72,0x99,0x0e,0x44,0x42,0x12,0x1a,0x92,0x60,0x01,0x48,0xb2,0x9b,0xf1,0x7f,0xef,
+		0x2e,0x08,0x52,0xa4,0x24,0xdb,0xbd,0x8e,0xc7,0x92,0xb0,0xd8,0x5d,0x2c,0xf6,0xe5,0x59,0x00,0x83,0x95,
+		0x49,0x62,0x72,0x97,0xc4,0xa9,0x1e,0xd2,0x95,0x31,0x59,0x2f,0x08,0xb6,0xdb,0xad,0xbf,0x7d,0xe5,0x4b,
+		0xb5,0x0c,0x3a,0x6f,0xdf,0xbe,0x0d,0xee,0x90,0x87,0x9e,0x79,0x83,0x15,0x67,0x11,0x7c,0x25,0xdc,0x30,
+		0x92,0xb2,0x84,0x0f,0xe9,0x46,0xf0,0x6d,0x26,0x95,0xa1,0x24,0x94,0xa9,0xe1,0xa9,0x19,0xd2,0xad,0x88,
+		0xcc,0x6a,0x18,0xf1,0x8d,0x08,0x79,0xcb,0x0e,0x9a,0x44,0xa4,0xc2,0x08,0x16,0xb7,0x74,0xc8,0x62,0x3e,
+		0xec,0xf8,0x6d,0xd4,0x66,0x84,0x89,0xf9,0xd9,0xfb,0x8b,0x0b,0x72,0x39,0x9d,0x58,0x79,0x25,0xe3,0x98,
+		0x2b,0xd2,0x22,0x2b,0x99,0xf0,0x41,0x90,0x33,0x78,0x03,0x6d,0xee,0xf1,0xdb,0x97,0x6b,0x03,0xb3,0xdf,
+		0xbd,0xb9,0x54,0x11,0x57,0x3d,0xa2,0x65,0x2c,0xa2,0xbe,0x1b,0xe6,0x4b,0xf5,0x48,0x27,0xbb,0xeb,0x7b,
+		0x19,0x8b,0x22,0x91,0x2e,0x5b,0x31,0x5f,0x98,0x1e,0xe9,0x6e,0xb6,0x7d,0xef,0xc1,0xc9,0x7f,0x06,0x05,
+		0x91,0xd0,0x59,0xcc,0xee,0x7b,0x64,0x11,0x73,0xe0,0xc6,0xcf,0x56,0x24,0x14,0x0f,0x8d,0x90,0x69,0x0f,
+		0x4c,0x89,0xd7,0x49,0x0a,0x8a,0x59,0xf8,0x6d,0xa9,0xe4,0x3a,0x8d,0x7a,0x24,0x95,0x29,0xef,0x7b,0x2b,
+		0x2e,0x96,0x2b,0xd0,0xd8,0x69,0xb7,0xff,0x61,0x55,0x1a,0x25,0x32,0xb4,0xa8,0xe4,0x6c,0x81,0xb0,0x04,
+		0xdb,0xa4,0x62,0xe9,0x92,0x2b,0x1e,0xe5,0x2b,0xa7,0x47,0x99,0x62,0xd4,0xb6,0x54,0x9c,0xa7,0x96,0x2b,
+		0x95,0x89,0x48,0x59,0x0c,0xac,0x1b,0xa1,0xc5,0x5c,0xc4,0xc2,0x80,0x8d,0x2b,0x11,0x45,0x39,0x83,0x48,
+		0xb3,0xb5,0xf9,0x62,0xee,0x33,0x3e,0x34,0xfc,0xce,0x7c,0x05,0xc6,0x05,0x78,0xad,0xa5,0xc5,0x1f,0xbc,
+		0x47,0x5e,0x6f,0x40,0xba,0xef,0x39,0x37,0xbc,0x6e,0xe3,0xa6,0x9d,0x1f,0x7a,0xa4,0x9d,0xdd,0xe1,0x7f,
+		0xdf,0x4b,0x98,0x5a,0x8a,0xd4,0x11,0xd0,0x77,0x77,0x28,0x6e,0x79,0x9c,0x1f,0x81,0xb4,0xb7,0xd8,0x7c,
+		0x6d,0x8c,0x4c,0x71,0xb9,0x9a,0xf2,0xc3,0xb5,0x1f,0xbc,0x7f,0x8d,0xdf,0xff,0x02,0x7c,0x57,0xe3,0x9b,
+		0xdb,0xd6,0x74,0xf4,0xdf,0xcb,0x72,0xca,0x52,0xae,0xce,0xaf,0x47,0x1f,0x7f,0xe9,0x91,0x19,0x57,0x11,
+		0x4b,0x59,0x93,0x9c,0x2b,0xc8,0x8a,0x26,0xf9,0xc0,0xe3,0x0d,0x37,0x22,0x04,0x8a,0x66,0xa9,0x6e,0x69,
+		0xae,0xc4,0x02,0xb4,0x65,0x47,0x77,0xf8,0xe0,0x19,0x36,0x8f,0xf9,0x23,0x73,0x83,0xc0,0xa5,0xcb,0x40,
+		0x87,0x10,0x1c,0x43,0xec,0x16,0x28,0x3a,0x2c,0xf8,0x8d,0x6d,0x58,0x4e,0x85,0xfc,0xdb,0x30,0x45,0xb6,
+		0xfa,0x93,0x12,0x64,0x48,0x68,0xe7,0x6d,0xd7,0xef,0xbc,0xf9,0xd1,0x7f,0xe3,0x77,0x7a,0x9d,0x6e,0xfb,
+		0xc7,0x76,0x40,0xfb,0x96,0x23,0x93,0x5b,0xc8,0xb9,0x21,0xf9,0x4e,0x28,0x2a,0xa2,0x3d,0x42,0xa3,0x30,
+		0xfc,0x34,0xa2,0x4d,0x42,0xc3,0x24,0xc2,0xb1,0x65,0xc1,0x71,0x72,0xfe,0x6b,0x2c,0x12,0x61,0x90,0x88,
+		0xe3,0x59,0x7d,0x98,0x9c,0xc3,0xaf,0xee,0x2b,0x9c,0xc0,0x1f,0x7e,0x17,0x7e,0x61,0xfe,0xc0,0xc0,0xa8,
+		0x35,0xb7,0x23,0x48,0x11,0x64,0x5f,0xa7,0xdf,0x52,0xb9,0x4d,0xe9,0x43,0x6e,0xc4,0x8a,0xa9,0x68,0xcb,
+		0x14,0x7f,0xda,0x8e,0x82,0x0b,0x49,0xd3,0xe9,0xe8,0x3d,0xd2,0xa0,0xba,0x7e,0x6d,0x77,0x91,0x32,0x9a,
+		0xe0,0xb8,0xd8,0xe7,0x0f,0x7e,0x07,0x89,0xd7,0xe7,0x17,0x85,0x75,0xd9,0x36,0x2a,0x7e,0x6e,0xf5,0x04,
+		0x4b,0x1a,0xd2,0x1c,0x3d,0x81,0x04,0xb1,0x23,0xbc,0x45,0xc2,0x86,0x2b,0x0d,0xa5,0x02,0x14,0x1c,0x31,
+		0x5b,0x37,0xb9,0x2b,0xe2,0x98,0x12,0x67,0x35,0x33,0x86,0x27,0x99,0xd1,0x60,0x35,0x64,0xda,0x62,0x9d,
+		0x5a,0x36,0x48,0x33,0x69,0x1a,0x27,0x10,0x3d,0xb1,0x20,0x8d,0x92,0xe7,0x0c,0x6a,0x0a,0x88,0x44,0x71,
+		0xb3,0x56,0x69,0x9f,0x3c,0x78,0xc5,0xd4,0xe9,0x69,0x7f,0x9f,0xb5,0x6b,0xc5,0x01,0x53,0xfe,0xc3,0xe7,
+		0x5a,0x86,0xdf,0x38,0x28,0x84,0xd8,0x13,0x1e,0x6b,0x4c,0x0b,0x84,0xb1,0x9f,0x80,0x46,0x83,0xc2,0x25,
+		0xef,0x16,0x82,0xc7,0x91,0x1e,0x8e,0x26,0x4d,0xb7,0x39,0xe0,0xd7,0xdc,0xdc,0x8a,0x84,0x03,0x2a,0x34,
+		0x4a,0xe3,0xd0,0x30,0x67,0x21,0xd8,0xd0,0x24,0xaf,0xda,0xed,0x36,0xaa,0x86,0xbf,0x92,0xa7,0x50,0x6f,
+		0x56,0xfc,0x93,0x8a,0x8b,0x9d,0x6c,0x45,0x1a,0xc9,0xad,0xff,0xf9,0xfa,0xe3,0x07,0x98,0xff,0x99,0xff,
+		0xbe,0xe6,0xda,0xc0,0x64,0x10,0x00,0x9e,0x44,0x9c,0x2c,0xa4,0x22,0xa3,0xcb,0x1f,0x4e,0x9b,0xe4,0x0a,
+		0x90,0x66,0x21,0xef,0x9a,0xe4,0x62,0xa5,0x00,0xe7,0x9a,0x64,0x9c,0x71,0x05,0xa9,0x3f,0x65,0x0b,0xa6,
+		0x84,0x07,0x58,0x8c,0x2b,0x80,0xd7,0x52,0xbe,0x25,0x75,0x7d,0x76,0x9b,0x5e,0xbe,0xcd,0xba,0xe2,0x37,
+		0x4d,0xf8,0xf8,0xe7,0x9e,0xf0,0x39,0x18,0xbc,0xe1,0x9f,0xc7,0xf3,0xdf,0x00,0xda,0x1a,0xf4,0x5a,0x84,
+		0x4a,0x6a,0xb9,0x30,0xd6,0xca,0xdb,0xdb,0x09,0xb5,0xea,0x9c,0x0c,0x80,0x94,0x02,0x7c,0xbf,0xd7,0x86,
+		0x19,0x1e,0xae,0x10,0xbe,0x40,0x4d,0xcd,0x33,0x9e,0x51,0xf7,0x6e,0xbb,0x85,0x90,0x15,0x99,0xa2,0x08,
+		0x19,0x0e,0xc9,0x6b,0xf2,0xf2,0x25,0x29,0xa6,0x50,0xd1,0x5a,0x23,0xb9,0xdb,0x6e,0x17,0x6e,0x02,0x98,
+		0x07,0xd8,0xe6,0xe8,0x66,0xf7,0xd3,0x8f,0xe5,0xb2,0xa2,0x4e,0x67,0x40,0xe6,0xb7,0x50,0xae,0x27,0x45,
+		0x22,0x25,0xf7,0xb0,0x03,0xb0,0xe5,0xdf,0xd3,0xf1,0x8d,0x9f,0x31,0xa5,0xf9,0x71,0xfe,0x3c,0x4f,0x5e,
+		0x58,0x76,0x1f,0xab,0xe4,0xa4,0x48,0x27,0x3b,0xb1,0xa3,0x93,0x17,0xc3,0xa2,0x7c,0x76,0x2c,0x95,0x22,
+		0xb3,0x9c,0x00,0xa5,0x05,0x3a,0x6c,0x35,0x74,0x45,0x4a,0x4e,0xcb,0x42,0xf4,0x47,0x13,0x18,0xd1,0x5e,
+		0x8d,0x96,0x67,0x56,0x7d,0x97,0xd5,0x3d,0x5a,0x75,0x68,0xe4,0x41,0xe2,0xc2,0x5f,0xc8,0x4c,0xb8,0x22,
+		0x0d,0x7e,0xe0,0xa7,0xaa,0x06,0xee,0x27,0x5c,0x6b,0xb6,0xe4,0x4e,0xa8,0x8c,0x5c,0xc6,0xd3,0x06,0xfd,
+		0xe9,0xf2,0x16,0xaa,0x37,0xcf,0xca,0xa6,0x85,0x14,0x60,0x2b,0x83,0xc1,0xd3,0x28,0x5f,0xab,0x8c,0xe8,
+		0x9e,0x1d,0x4f,0x07,0x88,0xd6,0xb8,0xa9,0x8d,0x4d,0xa5,0xc0,0x3b,0x50,0xe1,0xdb,0x62,0xd6,0x65,0x1f,
+		0x70,0x4f,0x73,0xdd,0xc5,0xce,0x4b,0x0e,0xc8,0x35,0xb4,0xb9,0x96,0x5f,0x7c,0x83,0xe5,0xe2,0xc9,0x74,
+		0x8c,0xbb,0xc1,0x91,0xf7,0x50,0x17,0x09,0x63,0xa9,0xf9,0x71,0x99,0x0b,0x9c,0x3a,0x2a,0xe4,0x3c,0x76,
+		0x5c,0xec,0x3a,0x9f,0x3c,0x2a,0xc8,0x95,0x92,0xea,0xb8,0xd8,0x25,0x4e,0x95,0x42,0x15,0x97,0x56,0x8c,
+		0xc7,0x6e,0x59,0x6a,0xb3,0xde,0xb7,0xe9,0xab,0x01,0xf1,0xd3,0xa5,0x58,0xdc,0x37,0x9e,0x40,0x72,0xbd,
+		0x9e,0x63,0x9b,0x9a,0x5b,0x28,0x37,0x32,0x13,0xa1,0x06,0xf2,0x17,0xd7,0x69,0xbe,0x92,0x87,0x13,0x97,
+		0xeb,0xbb,0x60,0x79,0xb5,0x60,0xed,0x42,0x81,0x6e,0xa6,0xfb,0x08,0x56,0xf5,0xd7,0x41,0xd8,0x1f,0xd3,
+		0x64,0xbd,0x7f,0x44,0xd5,0xce,0x19,0x7f,0x59,0x95,0x75,0xed,0x11,0x55,0xd5,0x70,0xe0,0x31,0x8d,0xcf,
+		0xd7,0x4b,0x5f,0xa4,0x10,0x8a,0x0f,0xb7,0xd7,0x1f,0x21,0x16,0x30,0xe1,0x47,0xcc,0xb0,0xbe,0xa7,0x78,
+		0xc6,0x44,0x6a,0x3e,0x8d,0xf6,0x92,0x1a,0x41,0x1d,0xbb,0xa8,0xcd,0x67,0xeb,0x2f,0xbf,0x68,0xcb,0x58,
+		0xc9,0xd0,0xd5,0x73,0xe2,0xac,0x46,0x43,0xb3,0xe7,0x26,0x9d,0x6c,0x95,0xbf,0x61,0xf1,0xda,0x62,0x19,
+		0xbd,0xfd,0x79,0x34,0x99,0x5c,0xbe,0xa7,0x3b,0x4d,0xb6,0x3f,0x83,0x08,0xd6,0x56,0xbf,0xa4,0x09,0x84,
+		0xdb,0x05,0x03,0x50,0xae,0xf4,0xa0,0xba,0xc0,0x81,0xee,0xf1,0x0d,0x25,0xef,0x72,0x21,0xd2,0x73,0xfa,
+		0x6a,0xbe,0x6b,0xd4,0x5c,0x97,0x9f,0x42,0xe0,0x48,0x40,0x10,0x71,0x2a,0xba,0x4f,0x20,0x03,0x1d,0x46,
+		0x62,0x7a,0x15,0x20,0xb9,0xcb,0x32,0xcb,0x0b,0x2e,0x3a,0xf4,0x65,0x2e,0xd1,0xdf,0xcf,0xd2,0x9c,0x7c,
+		0xe0,0xd4,0x09,0xea,0xb1,0x4e,0x85,0x41,0x72,0x5e,0x6c,0x85,0x54,0x46,0x00,0xc6,0x70,0xaa,0x0e,0x79,
+		0x23,0xf8,0x72,0xda,0xfa,0xdf,0x5d,0xf7,0xf2,0x6b,0xb0,0x14,0x90,0xc0,0xae,0xd7,0xce,0xaa,0x32,0xb3,
+		0xe7,0x45,0x70,0x57,0x42,0xcf,0x18,0x9c,0xf1,0x4b,0x97,0xa3,0x8b,0x84,0xbe,0x61,0x37,0x8d,0xca,0xba,
+		0x27,0x87,0x56,0xd9,0x98,0x96,0xb2,0x45,0x6c,0xea,0xe2,0xb3,0xba,0xf4,0xec,0x19,0xe1,0x22,0xb0,0xa8,
+		0xa3,0xc2,0x3e,0x20,0x1d,0x84,0xca,0x7d,0x7e,0xf2,0xe0,0x96,0x7b,0xe1,0x66,0x76,0x7d,0xe6,0x20,0x29,
+		0x2b,0xa6,0x1f,0x66,0xe7,0x6e,0xa9,0xfd,0x8a,0xdf,0x4b,0x91,0x22,0x46,0xf4,0xa4,0xd2,0x37,0x9f,0xce,
+		0x09,0x80,0x06,0xbc,0x1d,0x5c,0x46,0x76,0x25,0xb7,0xd1,0xbf,0x93,0x28,0xf6,0xa0,0x7c,0x4c,0x59,0x99,
+		0x41,0x95,0x72,0x2d,0x8f,0x11,0x8f,0xb4,0xf6,0x3d,0x03,0x8e,0x75,0xf5,0xef,0x5e,0xe1,0xcc,0x87,0xa7,
+		0x3a,0xfb,0x71,0x36,0xc0,0x58,0x5b,0x82,0x39,0x98,0x3e,0x07,0x5a,0x8e,0x0b,0x55,0x14,0x57,0x01,0x77,
+		0x3a,0x70,0x97,0x48,0x08,0x5d,0xd5,0x59,0x45,0x74,0xcb,0xf9,0x59,0x6d,0xba,0xe1,0xe2,0x7b,0xe2,0x1b,
+		0x79,0x25,0xee,0x78,0xd4,0xe8,0xb8,0x0d,0xd6,0xfc,0xe7,0x1c,0x78,0x98,0xd8,0xf5,0xe4,0xd9,0xab,0xab,
+		0x5a,0xee,0x14,0x9b,0xde,0xa1,0x14,0x6a,0x73,0x40,0x14,0xc6,0x4c,0x43,0x1d,0x24,0x36,0xdd,0xed,0x1d,
+		0xa4,0xef,0xd5,0x31,0x6a,0x07,0x7f,0xbb,0xd4,0x3f,0x22,0x5c,0x85,0xb9,0x77,0x84,0xc2,0x2d,0x00,0xe0,
+		0x8c,0xca,0xc5,0xe2,0x50,0xe1,0x1e,0x2b,0x22,0x20,0xb0,0x8e,0xaf,0xae,0xa8,0x6d,0x03,0x4f,0x1c,0x81,
+		0xea,0x21,0xd9,0x3f,0x04,0xd9,0x2b,0x9f,0xbd,0xd4,0xc1,0x9d,0x2f,0x70,0x4f,0x14,0x73,0x19,0xdd,0x43,
+		0x43,0x89,0x25,0x8b,0x86,0x34,0x3f,0xcf,0xe3,0x93,0x43,0x24,0x36,0xc4,0x9a,0x3f,0xa4,0xf6,0x31,0x00,
+		0x69,0xd9,0xd9,0x60,0x5e,0xbe,0x42,0xe4,0x31,0x06,0xaf,0x1a,0x88,0x85,0x26,0x2d,0xf2,0x61,0x7c,0x7d,
+		0x39,0x08,0xe6,0x67,0x83,0x20,0xc3,0x27,0x0b,0x7b,0xf1,0xcc,0x2f,0xca,0x43,0xda,0xa6,0xc4,0xde,0x35,
+		0xdd,0x9b,0x47,0x0f,0x5f,0x05,0xec,0xc3,0x86,0xc2,0x8f,0xa8,0x3e,0xf9,0x1a,0xe7,0xc8,0xd4,0x9e,0x89,
+		0x07,0x81,0x89,0x2c,0xcb,0x19,0x79,0x99,0xce,0x75,0xd6,0x77,0x84,0x20,0x97,0x54,0x6e,0x2e,0x39,0x2f,
+		0x19,0x89,0x80,0x7d,0x94,0x19,0x07,0x8a,0x8e,0x4b,0xcc,0x64,0x6c,0xf4,0x51,0xa1,0xd9,0x11,0x19,0x62,
+		0x65,0x6c,0xbb,0x74,0x1b,0x17,0xb9,0x70,0x3e,0x31,0xb0,0x4f,0x00,0xee,0xfe,0x9c,0xbf,0x01,0x50,0xab,
+		0x32,0x0f,0x2c,0x25,0x36,0xb2,0x43,0x1b,0x49,0x3c,0x9c,0x89,0xf0,0xdb,0x90,0xee,0xfa,0x2f,0x25,0x6c,
+		0x6d,0xe4,0x42,0x86,0x70,0x07,0x08,0xdc,0xe2,0xa4,0xbe,0x78,0xe1,0xa1,0xe2,0xb9,0x06,0x8e,0x3a,0x3d,
+		0x7c,0xac,0x41,0x47,0xc1,0x31,0xc1,0xb6,0x56,0xb3,0x82,0x33,0xfe,0x4a,0xc6,0xd1,0xbe,0x82,0x03,0x1f,
+		0x95,0x16,0xa3,0x8d,0xb6,0x6c,0x68,0xe5,0xf2,0x8f,0x36,0x5a,0x63,0x60,0xb9,0x1a,0x54,0xd9,0xce,0x42,
+		0x83,0xbf,0xe6,0xd2,0xfd,0x35,0x66,0xff,0xc7,0x12,0xe4,0xb1,0x35,0x6a,0x39,0xf0,0x9c,0xe7,0xc1,0x31,
+		0xa5,0xe7,0xa7,0x70,0xe2,0xaf,0xb9,0xde,0x75,0xe9,0xbf,0x61,0x08,0x46,0x23,0x94,0xb1,0xce,0x58,0x3a,
+		0xa4,0x5d,0x4c,0x16,0xfc,0x99,0x67,0x10,0x02,0x72,0x99,0xea,0x95,0xa7,0x29,0xf7,0x32,0x45,0x76,0xcf,
+		0x30,0x5d,0x7c,0x85,0xb1,0x99,0x86,0xd2,0x67,0x76,0x11,0xb7,0x46,0x60,0x6b,0x07,0x4b,0x53,0xc1,0xfa,
+		0xe5,0x17,0x23,0x10,0xdf,0x05,0xf8,0x0f,0xee,0xc2,0xc6,0x40,0x89,0xaf,0x4c,0x42,0xcf,0x8a,0xd1,0x20,
+		0x60,0x67,0x39,0xe7,0x3e,0x3f,0x5c,0x64,0xa1,0x7e,0x73,0xee,0x58,0x86,0x32,0x91,0x78,0xd5,0x25,0x39,
+		0xf9,0x71,0x31,0x6c,0x07,0x50,0xf9,0x6e,0x95,0x7c,0xf0,0xac,0x50,0x26,0x93,0x5c,0x20,0x53,0x72,0xa9,
+		0x58,0x02,0xc8,0x07,0x2d,0x2d,0x81,0x86,0x46,0x1a,0x93,0xf1,0xf5,0xc9,0xe3,0x92,0x9a,0x2b,0x7c,0x06,
+		0xcd,0xa5,0xdd,0x80,0x24,0x78,0x6b,0x6f,0xa0,0x2e,0x92,0x9f,0xe1,0x1e,0x97,0x2f,0xef,0x96,0x56,0x41,
+		0x79,0x43,0x2d,0xf0,0xe9,0x50,0x30,0x00,0x84,0xc3,0x2f,0xc4,0x3f,0x0b,0x87,0xf8,0xba,0x7b,0xe6,0xfd,
+		0x09,0x8a,0x01,0x69,0x19,0xe6,0x15,0x00,0x00,
+	};
+
+	//pom.htm 13808 bytes, minified 7108, gzip 2471
+	static const uint8_t asset_pom_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x19,0x6b,0x6f,0xdb,0x38,0xf2,0xbb,0x7e,0x05,
+		0x97,0x87,0x2b,0x6c,0xd4,0x91,0x6c,0x27,0x6d,0x37,0x7e,0x2d,0xd2,0x34,0xd9,0xfa,0x90,0x34,0x46,0xed,
+		0x66,0xdb,0xeb,0x15,0x0b,0x59,0xa2,0x6d,0x6e,0x25,0x51,0x47,0xd1,0x76,0x72,0xdd,0xfc,0xf7,0x9b,0x21,
+		0xf5,0xb4,0x94,0xb4,0xd8,0x2f,0x77,0x28,0x1a,0x9b,0xf3,0xe2,0x70,0x5e,0x1c,0x8e,0x47,0x1b,0x15,0x06,
+		0xe4,0x2e,0x0c,0xa2,0x64,0x4c,0x37,0x4a,0xc5,0x03,0xc7,0xd9,0xef,0xf7,0xf6,0xfe,0xd8,0x16,0x72,0xed,
+		0xf4,0x4e,0x4f,0x4f,0x9d,0x3b,0xa4,0xa1,0x13,0x6b,0xb4,0x61,0xae,0x0f,0x1f,0x21,0x53,0x2e,0x89,0xdc,
+		0x90,0x8d,0xe9,0x8e,0xb3,0x7d,0x2c,0xa4,0xa2,0xc4,0x13,0x91,0x62,0x91,0x1a,0xd3,0x3d,0xf7,0xd5,0x66,
+		0xec,0xb3,0x1d,0xf7,0xd8,0x91,0x5e,0x74,0x08,0x8f,0xb8,0xe2,0x6e,0x70,0x94,0x78,0x6e,0xc0,0xc6,0x3d,
+		0xbb,0x8b,0xd2,0x14,0x57,0x01,0x9b,0xbc,0x39,0x3f,0x27,0x17,0xf3,0x99,0xe6,0x97,0x22,0x08,0x98,0x24,
+		0x47,0x64,0x76,0x73,0x3d,0x72,0x0c,0xde,0x1a,0x25,0xea,0x1e,0x3f,0x6d,0xb1,0x55,0x80,0xfc,0x66,0x2d,
+		0x85,0xf4,0x99,0x1c,0x90,0x44,0x04,0xdc,0x1f,0xa6,0x4b,0xb3,0xd3,0x80,0xf4,0xe2,0xbb,0xa1,0x15,0xbb,
+		0xbe,0xcf,0xa3,0xf5,0x51,0xc0,0x56,0x6a,0x40,0xfa,0xbb,0xfd,0xd0,0x7a,0x48,0xf9,0x3f,0x82,0x00,0x9f,
+		0x27,0x71,0xe0,0xde,0x0f,0xc8,0x2a,0x60,0x40,0x8d,0x7f,0x8f,0x7c,0x2e,0x99,0xa7,0xb8,0x88,0x06,0xa0,
+		0x49,0xb0,0x0d,0x23,0x10,0xec,0x7a,0x5f,0xd7,0x52,0x6c,0x23,0x7f,0x40,0x22,0x11,0xb1,0xa1,0xb5,0x61,
+		0x7c,0xbd,0x01,0x89,0xbd,0x6e,0xf7,0xef,0x5a,0xa4,0x92,0x3c,0x46,0x8d,0x72,0xca,0x23,0x60,0x16,0xa0,
+		0x9b,0x90,0x6e,0xb4,0x66,0x92,0xf9,0x66,0xe7,0xa8,0x91,0x28,0x40,0x69,0x6b,0xc9,0x58,0xa4,0xa9,0x22,
+		0x11,0xf2,0xc8,0x0d,0x80,0x74,0xc7,0x13,0xbe,0xe4,0x01,0x57,0xa0,0xe3,0x86,0xfb,0xbe,0x21,0xe0,0x51,
+		0xbc,0x55,0x9f,0xd5,0x7d,0xcc,0xc6,0x8a,0xdd,0xa9,0x2f,0x40,0xb8,0x02,0xa3,0x1d,0x25,0xfc,0x3f,0x6c,
+		0x40,0x4e,0x76,0xc0,0x3d,0xb4,0x52,0x33,0x9c,0x74,0xf1,0xd0,0xa9,0x1d,0x06,0xa4,0x1b,0xdf,0xe1,0xff,
+		0xa1,0x15,0xba,0x72,0xcd,0xa3,0x14,0x80,0xb6,0xbb,0x43,0x76,0x4d,0x93,0xda,0x11,0x40,0x07,0x9b,0x2d,
+		0xb7,0x4a,0x89,0x08,0xb7,0xab,0x08,0xaf,0xef,0xfd,0x60,0x25,0x2c,0x00,0x2b,0x76,0x88,0x88,0xd1,0x94,
+		0x1d,0xf2,0x37,0x50,0x40,0x16,0x8c,0xfd,0x47,0x19,0x4b,0xdb,0x79,0x1b,0xe6,0x7d,0x05,0x2d,0x70,0x43,
+		0x05,0x66,0x4c,0x56,0x42,0x86,0xe0,0x6d,0x0c,0x9d,0x56,0xbf,0x8d,0xd4,0xaf,0x6f,0xde,0x7c,0x02,0xec,
+		0xe5,0xcd,0xbb,0xc5,0xd1,0x7c,0xfa,0xcf,0x8b,0x5c,0x90,0x86,0x5c,0x9e,0x5d,0x4f,0xaf,0x3e,0x0d,0xc8,
+		0x2d,0x93,0xbe,0x1b,0xb9,0x1d,0x72,0x26,0x21,0xf6,0x3a,0xe4,0x2d,0x0b,0x76,0x4c,0x71,0x0f,0x20,0x09,
+		0x88,0x3d,0x4a,0x98,0xe4,0x2b,0x90,0x16,0x37,0x1a,0xf2,0xc1,0x52,0xee,0x32,0x60,0x8f,0xe0,0x46,0x4e,
+		0x1a,0x95,0xa3,0xc4,0x83,0x18,0x50,0x44,0xab,0x4e,0xd1,0x2f,0xce,0x1f,0xee,0xce,0x35,0x50,0x88,0xf2,
+		0x9d,0x2b,0xc9,0x3e,0xf9,0x20,0x39,0x19,0x13,0xba,0x4f,0x20,0xbb,0x7a,0xa7,0x7d,0xbb,0xf7,0xf2,0x67,
+		0xfb,0xa5,0xdd,0x1b,0xf4,0xfa,0xdd,0x9f,0xbb,0x0e,0x1d,0x6a,0xb2,0x58,0xec,0x21,0xbe,0xc7,0xe4,0x1b,
+		0xa1,0x28,0x8d,0x0e,0x08,0xf5,0x3d,0xef,0xc3,0x94,0x76,0x08,0xf5,0x42,0x1f,0xd7,0x9a,0x04,0xd7,0xe1,
+		0xd9,0xef,0x01,0x0f,0xb9,0x42,0x20,0xae,0x6f,0xab,0xcb,0xf0,0x0c,0xbe,0xf5,0x8f,0x11,0x81,0x5f,0xec,
+		0x3e,0x7c,0xc3,0x58,0x85,0x85,0x92,0x5b,0xa6,0x57,0x10,0x8e,0xb0,0x5c,0xb9,0x41,0xc2,0xc8,0x83,0xd1,
+		0x60,0xe3,0x4a,0x7f,0xef,0x4a,0xf6,0xb4,0x12,0x19,0x15,0x82,0xe6,0xf3,0xe9,0x1b,0x84,0x41,0x16,0xff,
+		0xde,0xed,0x23,0x64,0x3a,0xc3,0x75,0x76,0xc8,0x57,0x76,0x0f,0x81,0xd7,0x67,0xe7,0x99,0x6a,0xf1,0xde,
+		0xcf,0xbe,0xee,0x93,0x19,0x96,0x0e,0xc8,0x27,0x34,0x03,0x02,0x78,0x01,0x38,0x45,0xc0,0x8e,0xc9,0x04,
+		0x02,0x09,0x20,0xb8,0x72,0x75,0x82,0x1a,0x3b,0x04,0x01,0xcd,0xb4,0x8e,0x45,0xf8,0x3d,0xab,0x85,0xb4,
+		0xc2,0xbe,0xbc,0x57,0x5a,0x7b,0x8c,0x4e,0x3a,0xa0,0xf3,0x63,0x4d,0xbc,0x7b,0xcf,0xd6,0xe9,0x4e,0xde,
+		0xee,0xd6,0x0d,0x90,0xf2,0x75,0xef,0x38,0xdf,0xc7,0x55,0x8a,0x85,0xb1,0x4a,0x60,0x33,0x48,0x9d,0xd5,
+		0x36,0xd2,0xf2,0x20,0x6f,0x84,0x6a,0xb5,0x21,0x4e,0xf8,0x8a,0xb4,0x72,0x9a,0x09,0x14,0x09,0x00,0x12,
+		0xc9,0xd4,0x56,0x46,0x43,0xf2,0x60,0x65,0xa8,0xe7,0xcf,0x87,0x87,0xa4,0x7d,0xcd,0x0e,0x35,0xf2,0x37,
+		0xb6,0x4c,0x84,0xf7,0x95,0x81,0x40,0x88,0x32,0xc2,0xd0,0x37,0xdf,0x2c,0x2c,0xcb,0xbf,0x02,0x8c,0x3a,
+		0x99,0xe9,0x7f,0x59,0x71,0x16,0xf8,0xc9,0x78,0x3a,0xeb,0xa4,0x46,0x04,0xfa,0x84,0xa9,0x05,0x0f,0x19,
+		0x94,0xb9,0x56,0xae,0x1c,0x2a,0x96,0x6a,0x08,0x3a,0x74,0xc8,0x71,0xb7,0xdb,0xd5,0x29,0xf4,0x50,0x1c,
+		0x20,0x13,0xaf,0x36,0xec,0x83,0x0c,0xb2,0x93,0xec,0x79,0xe4,0x8b,0xbd,0xfd,0xf1,0xfa,0xea,0x2d,0xe0,
+		0xdf,0xb3,0x7f,0x6f,0x59,0xa2,0x00,0xe9,0x38,0x50,0x20,0x7d,0x46,0x20,0x2b,0xc9,0xf4,0xe2,0xd5,0xf3,
+		0x0e,0xb9,0x84,0xd2,0xb9,0x12,0x77,0x1d,0x72,0xbe,0x91,0x22,0x84,0xe0,0xba,0x89,0x99,0x84,0x24,0x9b,
+		0xbb,0x2b,0x57,0x72,0x0b,0xee,0x16,0xdc,0x01,0xac,0x16,0xb1,0x3d,0xa9,0xca,0xd3,0xc7,0xb4,0xcc,0x31,
+		0xab,0x82,0x5f,0x76,0xe0,0xcf,0x8b,0x03,0xe6,0x33,0x50,0x78,0xc7,0x3e,0xde,0x2c,0xff,0x80,0x2a,0xd3,
+		0xa2,0xd7,0xdc,0x93,0x22,0x11,0x2b,0xa5,0xb5,0x5c,0x2c,0x66,0x54,0x8b,0x4b,0x79,0xa0,0xea,0x4a,0xb8,
+		0xaf,0xee,0x13,0xe5,0x2a,0xe6,0x6d,0xb0,0x1e,0x83,0x98,0x8a,0x65,0xa0,0xbe,0xdc,0xa7,0xc7,0xcd,0x98,
+		0x34,0xcb,0x1c,0x59,0xc8,0x78,0x4c,0x4e,0xc8,0xb3,0x67,0x24,0x43,0xa1,0xa0,0x6d,0x82,0xe0,0x7e,0xb7,
+		0x9b,0x99,0x09,0xae,0x2d,0xb8,0x87,0x18,0x9a,0x39,0xfd,0x6a,0x07,0x62,0x5d,0x12,0x97,0xc4,0x00,0x66,
+		0x0b,0x28,0x0c,0xed,0x2c,0x90,0xc2,0x7b,0x38,0x01,0xe8,0xf2,0x8f,0xf9,0xcd,0x3b,0x3b,0x76,0x65,0xc2,
+		0x9a,0xe9,0x4d,0x9c,0xfc,0xa4,0xc9,0x6d,0x0c,0xee,0x76,0x16,0x4e,0x1a,0x51,0xc0,0xc9,0x4f,0xe3,0x2c,
+		0xea,0x0b,0x92,0x52,0x32,0x6b,0x4a,0xb8,0x1b,0x2a,0x75,0x88,0x92,0xe7,0x79,0xc2,0xdb,0xd3,0x19,0xac,
+		0x20,0x15,0xca,0x30,0x13,0x59,0xd5,0x53,0x96,0xcf,0xa8,0xc5,0xa1,0x92,0xb5,0xc0,0x85,0x7f,0x9e,0xab,
+		0xbc,0x0d,0x69,0xb1,0x9a,0x9d,0xca,0x12,0x98,0x1d,0xb2,0x24,0x71,0xd7,0x2c,0x65,0xca,0x3d,0x17,0xb3,
+		0xa8,0x45,0x7f,0xbd,0x58,0x40,0x5e,0x9a,0xa8,0xec,0xe8,0xba,0x05,0x64,0xb9,0x33,0x58,0xe4,0x9b,0xbd,
+		0x72,0x8f,0x1e,0xe8,0xf1,0xb4,0x83,0x68,0x85,0x9a,0x6a,0xdf,0x94,0x12,0xbc,0x07,0x19,0xbe,0xcf,0xb0,
+		0x69,0xf4,0x01,0xf5,0xdc,0xc8,0xce,0x4e,0x9e,0x53,0x40,0xac,0xa1,0xce,0x95,0xf8,0x62,0x3b,0x4c,0x17,
+		0x4b,0x44,0x37,0x78,0x1a,0x5c,0x59,0x0f,0x55,0x16,0x2f,0x10,0x09,0x6b,0xe6,0x39,0x47,0x54,0x23,0x53,
+		0x6a,0xb1,0x66,0xb6,0x6b,0x83,0x6c,0x64,0x64,0x52,0x0a,0xd9,0xcc,0x76,0x81,0xa8,0x9c,0xa9,0x64,0xd2,
+		0x92,0xf2,0x78,0x8b,0xe7,0xd2,0xb4,0xf5,0x75,0xf8,0x26,0x70,0xad,0x44,0x6b,0xbe,0xba,0x6f,0x3d,0x51,
+		0x80,0x93,0xed,0x12,0x2f,0xc4,0xa5,0x2e,0xba,0x4a,0xc4,0xdc,0x4b,0x00,0xfc,0xb9,0xb8,0xce,0xe0,0x2a,
+		0xc6,0x76,0x91,0x7e,0x21,0x0f,0xed,0x34,0xec,0x0b,0xbf,0x59,0x15,0xbf,0x15,0x5e,0x41,0x8b,0xd3,0xc3,
+		0x62,0x56,0x36,0x5d,0x2d,0x02,0x1e,0x93,0xa4,0x1d,0xd1,0x20,0xaa,0xb0,0xcb,0x0f,0x8b,0xd2,0x56,0x6e,
+		0x10,0x55,0xf6,0x0c,0xb6,0xa0,0x6c,0xb9,0x5d,0xdb,0x3c,0x02,0xaf,0xbc,0x5d,0x5c,0x5f,0x81,0x5b,0x00,
+		0x61,0xfb,0xae,0x72,0x87,0x96,0x64,0xb1,0xcb,0x23,0xf5,0x61,0x7a,0x10,0xdf,0x58,0xdf,0xf1,0xd6,0xd6,
+		0xa1,0xad,0x4d,0x67,0x67,0x6d,0x00,0x26,0x35,0x74,0x11,0x06,0x78,0x5b,0x81,0xa1,0xda,0x4b,0x15,0xcd,
+		0xf6,0xd2,0xde,0xb9,0xc1,0x56,0x97,0x35,0xba,0x78,0x3f,0x9d,0xcd,0x2e,0xde,0xd0,0x42,0x92,0xee,0x07,
+		0x80,0x05,0xd3,0x6c,0x98,0xc3,0x38,0x56,0x5e,0xdd,0x22,0x64,0xb0,0xf9,0x75,0x4e,0x94,0xdf,0x4f,0x55,
+		0x09,0xb5,0xcd,0x6e,0xde,0x51,0xf2,0x4b,0xda,0x68,0x0c,0x52,0xde,0x8a,0x31,0x5b,0x15,0x5b,0x9a,0x36,
+		0x28,0x12,0x7b,0x82,0xd5,0xa8,0x24,0xbb,0x0d,0xd1,0x99,0xd6,0x4f,0x0c,0xbd,0xac,0x80,0x16,0x11,0xa8,
+		0x69,0xc1,0x66,0x75,0xe3,0x1a,0x8e,0xe1,0x61,0x04,0x1b,0x70,0xd5,0xca,0x25,0xeb,0xe7,0x17,0xc4,0x23,
+		0x45,0xfb,0x60,0x9f,0xa6,0x7a,0xfd,0xcd,0xca,0xca,0xf1,0xc3,0x53,0x35,0xfb,0x90,0xac,0xb1,0x5a,0xd2,
+		0x5c,0x35,0xda,0x2e,0xdf,0x00,0x90,0x64,0xda,0xce,0x26,0x9b,0x9e,0x2c,0xb8,0x19,0x4d,0xea,0xcd,0xe2,
+		0x6a,0x48,0x9f,0x44,0xe1,0x59,0xc5,0x6c,0x59,0x90,0xe5,0xf8,0xdb,0x0a,0xba,0x95,0xc6,0x5b,0xdb,0x56,
+		0xe2,0x92,0xdf,0x31,0xbf,0xd5,0x4b,0x15,0x2b,0xe2,0x07,0xd5,0x49,0x23,0xc2,0x0b,0xdc,0x24,0x79,0x07,
+		0xcf,0x46,0x8c,0x4c,0xdd,0x8d,0x0e,0xad,0x6a,0xb0,0x14,0x81,0x59,0x04,0x57,0x03,0x73,0x39,0xde,0x7e,
+		0x21,0x14,0x7a,0x3a,0x88,0x2b,0x2a,0x56,0xab,0xba,0xc0,0x03,0x52,0x0c,0x45,0x20,0xbd,0xb9,0xbc,0xa4,
+		0x3a,0x41,0x9b,0x8c,0x18,0xa6,0x59,0x11,0x16,0xd6,0x31,0x47,0x0a,0x6d,0xd3,0x41,0x6a,0x3a,0xf1,0x55,
+		0x93,0x85,0x49,0x35,0xd0,0xe8,0x5e,0x72,0xb8,0x45,0x22,0x8a,0x2f,0x31,0xdd,0x40,0x3d,0xda,0x95,0xd5,
+		0x58,0x9f,0x45,0xcb,0x24,0x1e,0x52,0xdd,0xa7,0xf5,0x8b,0x3e,0xed,0x2f,0xde,0xa5,0xf9,0x66,0xa8,0x11,
+		0x7b,0x0d,0x1d,0x6f,0xab,0x51,0xe1,0x6c,0x57,0x13,0xbb,0xbe,0x80,0xc6,0x97,0x43,0x1d,0x02,0xea,0xa2,
+		0x95,0xd0,0xdd,0x2f,0x10,0xc3,0xf3,0x6e,0x7e,0x55,0xca,0xec,0x64,0xa3,0x9f,0xfe,0x60,0xd8,0xb9,0xb6,
+		0xeb,0x15,0x88,0x41,0x3a,0x17,0x12,0x17,0x7b,0x6b,0x43,0x8a,0xc1,0x06,0xb6,0xc3,0x97,0x20,0xa0,0xcc,
+		0x4a,0x37,0xdb,0xb0,0xd4,0x9f,0x19,0x19,0x6a,0xc0,0xc1,0xc9,0xef,0x5a,0xba,0xff,0x36,0xe0,0x76,0xb5,
+		0xe9,0x29,0x61,0xb0,0x71,0x7e,0xf1,0x42,0xd7,0xe2,0x12,0xd0,0x54,0xbd,0x22,0x9d,0xcc,0x6e,0x80,0x47,
+		0xcc,0x6b,0x2c,0x29,0x25,0xea,0x54,0xb5,0xd4,0xad,0xe9,0xc3,0x60,0xf8,0x9d,0x22,0x13,0xfe,0xa5,0x12,
+		0x53,0x33,0x3c,0xa2,0x41,0x26,0x3e,0x5f,0x6c,0xdb,0xa6,0x75,0x97,0x71,0xf5,0x7f,0xef,0xb1,0x8a,0x71,
+		0x69,0xcd,0x9a,0xf0,0x20,0x35,0xaa,0x2c,0x8d,0x2a,0x70,0xa4,0xb2,0x2e,0xac,0xac,0xc9,0x39,0x26,0x2f,
+		0x5e,0x1f,0xda,0x43,0x39,0x65,0x75,0x8f,0xe5,0xff,0xde,0x37,0x65,0x7b,0xeb,0xd0,0xcb,0xcd,0x51,0x35,
+		0x0e,0xb4,0xf2,0x50,0x31,0x3d,0xd6,0x72,0x3e,0x3f,0x3f,0xfa,0xd7,0x5d,0xff,0xe2,0x8b,0xb3,0xe6,0xd0,
+		0xea,0x60,0xf1,0x2d,0x2c,0x8d,0xf6,0xcd,0x17,0x4f,0xb1,0x54,0x43,0xbc,0xb4,0x7a,0x8a,0xa9,0x48,0xa8,
+		0x62,0x93,0x36,0x6a,0x5d,0x51,0xa0,0xc8,0x97,0xec,0xaa,0x37,0x85,0xb1,0x4c,0x04,0x4f,0xde,0x1f,0xe6,
+		0x6b,0x8e,0xb9,0xfc,0x85,0x5c,0x88,0x80,0x37,0x72,0xff,0xd5,0x0f,0x89,0xcd,0x6f,0x83,0xba,0x84,0x6e,
+		0xff,0xf8,0xf4,0xc7,0x64,0x54,0xea,0x4b,0xee,0xa7,0x76,0xdd,0x8b,0x8f,0x1d,0xac,0x44,0x35,0x1e,0x77,
+		0xc9,0x9f,0x7f,0x96,0xfd,0x6d,0x74,0x39,0xf9,0x71,0x69,0x4d,0x95,0xae,0xa9,0x94,0x3d,0x64,0xdc,0x69,
+		0xd7,0x85,0xb3,0x27,0x3d,0x5d,0x9a,0xc0,0xb7,0x74,0x22,0xbb,0x14,0xfe,0x3d,0x34,0x99,0x81,0x70,0xfd,
+		0x31,0x35,0xcf,0x7d,0x9c,0xb0,0xfa,0x7c,0x47,0xf4,0xc5,0x39,0xa6,0x7a,0xf8,0x49,0x09,0x00,0xe3,0xc9,
+		0x68,0x99,0x4f,0x5d,0x67,0x37,0xd7,0xe4,0x1a,0x5e,0xdd,0x23,0x67,0x39,0x19,0x39,0x31,0x4e,0x65,0xf5,
+		0xd4,0xcb,0x0c,0x03,0xc7,0xb4,0x4b,0x89,0x1e,0x74,0xa5,0x63,0xdd,0x01,0x4e,0x3e,0xf5,0xec,0x56,0xe2,
+		0x1f,0xbf,0x8a,0x3c,0x41,0x1c,0x99,0xeb,0x67,0xf2,0xc8,0x51,0xbe,0x21,0xe1,0xa0,0x12,0x24,0x18,0x60,
+		0x4c,0xe1,0x4a,0x31,0x8e,0x11,0x61,0xe4,0x4c,0x48,0x78,0x56,0xe5,0xc8,0x1b,0x12,0xe0,0x6b,0xe6,0xb8,
+		0x15,0x81,0x4a,0x1a,0x99,0x6e,0x1b,0x78,0x88,0xe6,0xd1,0xfd,0x73,0x3a,0x68,0xe3,0x86,0xd9,0x20,0x46,
+		0x7a,0x00,0x99,0x4e,0xf1,0xcc,0xc0,0x93,0x6a,0x91,0xa6,0x9f,0xa0,0xc4,0x78,0x5d,0x37,0x10,0xf8,0x70,
+		0xe3,0xde,0xd7,0x31,0x2d,0x1a,0x72,0x4a,0xdc,0xad,0x12,0x2b,0xe1,0x6d,0x13,0xe2,0xa4,0x9b,0x93,0xea,
+		0xe6,0x99,0xa9,0xb2,0xd9,0x34,0x3c,0x83,0x06,0x38,0x99,0x46,0x8b,0xc1,0xbb,0xe1,0xfc,0x96,0xb4,0xc0,
+		0x19,0xed,0x43,0x56,0x7d,0xd6,0x2b,0xe1,0x09,0x5d,0x27,0xf2,0xe3,0x4e,0x52,0x85,0x51,0x45,0x3d,0xc5,
+		0x2a,0x0d,0x20,0x29,0xa8,0x30,0x32,0x93,0x58,0x8d,0xd7,0xf9,0x48,0x27,0x23,0x33,0x94,0x9d,0xe8,0x74,
+		0x1c,0x39,0xe9,0x2a,0x83,0x06,0x22,0x5a,0x17,0x40,0xc7,0xb0,0x4f,0x9a,0x2d,0x0f,0xba,0x4a,0xb6,0xe6,
+		0x09,0x44,0x54,0xa1,0x10,0x29,0x69,0x64,0x46,0x69,0x65,0x95,0x1e,0x73,0x22,0xf6,0x25,0xe6,0xba,0x2b,
+		0x49,0x82,0xe2,0x6f,0x60,0xcd,0x4c,0x95,0x8d,0x70,0x4e,0x57,0xd9,0xa8,0x64,0xa2,0x92,0x0d,0xf4,0x8d,
+		0x82,0x81,0x9b,0x9e,0xb0,0x9b,0x9f,0x35,0x07,0xf5,0xea,0xa0,0x7e,0x1d,0x74,0x5c,0x07,0x9d,0xd4,0x41,
+		0x2f,0xea,0xa0,0x97,0x75,0xd0,0xab,0x12,0x28,0xb3,0xb8,0x75,0xe0,0x39,0xad,0x76,0xee,0x3a,0x56,0x77,
+		0x9c,0x17,0x30,0x57,0xd6,0x3d,0x67,0x3d,0x65,0xba,0xc6,0x30,0x47,0x57,0xe4,0x71,0xfe,0xfa,0xd3,0xe2,
+		0x82,0xfc,0xf6,0x7e,0xba,0xb8,0x28,0xc5,0x7b,0xa9,0x93,0x2c,0xdb,0xf9,0xc9,0xe4,0x41,0xfd,0x73,0xa1,
+		0xd3,0xc5,0x23,0x32,0xb9,0x2e,0x58,0x35,0x77,0x63,0xda,0x78,0x22,0x48,0x62,0x37,0x1a,0xd3,0x3e,0x12,
+		0xe0,0x57,0x93,0xea,0x78,0xc9,0xe7,0xc5,0xa9,0xf4,0x83,0x49,0xfa,0x7b,0x09,0x29,0xa6,0xf6,0x7d,0x1c,
+		0xda,0x6b,0xe9,0xc8,0x6d,0x14,0x4f,0xf7,0x70,0x74,0xb5,0xc3,0x02,0x2a,0x21,0x69,0xf2,0x0f,0x97,0x6c,
+		0x24,0x5b,0x8d,0xa9,0x14,0x18,0xe3,0xf6,0x46,0x85,0x50,0x39,0x03,0x48,0xc2,0x50,0xe0,0x00,0x92,0x18,
+		0xf8,0xc8,0x71,0x27,0x86,0xe3,0x90,0x0f,0xcb,0x35,0x14,0xdc,0x94,0x31,0x5d,0x7d,0x97,0x0b,0xde,0x0b,
+		0xec,0x2e,0xe5,0xd9,0x88,0x90,0xd5,0x29,0x1d,0x28,0xe8,0xf8,0x81,0xe5,0x5e,0x57,0x7f,0xfc,0xed,0x6e,
+		0x62,0xfd,0x17,0xb7,0xca,0x15,0xe1,0xc4,0x1b,0x00,0x00,
+	};
+
+	//roster.htm 18725 bytes, minified 9713, gzip 2884
+	static const uint8_t asset_roster_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x1a,0x6b,0x6f,0xdb,0x38,0xf2,0xbb,0x7f,0x05,
+		0x2b,0x60,0x5b,0x1b,0x71,0xe4,0x47,0x5e,0xad,0x5f,0x8b,0x36,0x4d,0xb7,0x39,0x24,0x4d,0xd1,0xa4,0xdb,
+		0xf6,0x82,0x60,0x41,0x4b,0xb4,0xcd,0x8d,0x2c,0xb9,0x24,0xfd,0xba,0x6e,0xfe,0xfb,0xcd,0x90,0x94,0x2c,
+		0xc9,0xef,0xe0,0x6e,0x8b,0xb5,0xa4,0xd1,0xcc,0x70,0xde,0x33,0xa4,0xd2,0x1a,0xa8,0x61,0x40,0x66,0xc3,
+		0x20,0x94,0x6d,0x67,0xa0,0xd4,0xa8,0x51,0xa9,0x4c,0xa7,0x53,0x77,0x7a,0xe4,0x46,0xa2,0x5f,0xa9,0xbd,
+		0x79,0xf3,0xa6,0x32,0x43,0x1c,0xa7,0x53,0x68,0x0d,0x18,0xf5,0xe1,0x32,0x64,0x8a,0x92,0x90,0x0e,0x59,
+		0xdb,0x99,0x70,0x36,0x1d,0x45,0x42,0x39,0xc4,0x8b,0x42,0xc5,0x42,0xd5,0x76,0xa6,0xdc,0x57,0x83,0xb6,
+		0xcf,0x26,0xdc,0x63,0x87,0xfa,0xa1,0x4c,0x78,0xc8,0x15,0xa7,0xc1,0xa1,0xf4,0x68,0xc0,0xda,0x35,0xb7,
+		0x8a,0xdc,0x14,0x57,0x01,0xeb,0xbc,0x3f,0x3f,0x27,0x17,0xb7,0x9f,0x35,0xbd,0x88,0x82,0x80,0x09,0x72,
+		0x48,0x82,0xc8,0x8b,0x88,0x88,0xa4,0x62,0xa2,0x55,0x31,0x78,0x85,0x96,0x54,0x73,0xbc,0xba,0xd1,0x18,
+		0xc0,0xe4,0x57,0xa1,0x1b,0x09,0x9f,0x89,0x06,0x91,0x51,0xc0,0xfd,0xa6,0x7d,0x34,0x2b,0x36,0x48,0x6d,
+		0x34,0x6b,0x16,0x46,0xd4,0xf7,0x79,0xd8,0x3f,0x0c,0x58,0x4f,0x35,0x48,0x7d,0x32,0x6d,0x16,0x9e,0x2c,
+		0xfd,0x77,0x60,0xe0,0x73,0x39,0x0a,0xe8,0xbc,0x41,0x7a,0x01,0x03,0x6c,0xfc,0x3d,0xf4,0xb9,0x60,0x9e,
+		0xe2,0x51,0xd8,0x00,0x89,0x82,0xf1,0x30,0x04,0xc6,0xd4,0x7b,0xec,0x8b,0x68,0x1c,0xfa,0x0d,0x12,0x46,
+		0x21,0x6b,0x16,0x06,0x8c,0xf7,0x07,0xc0,0xb1,0x56,0xad,0xfe,0xa6,0x59,0x2a,0xc1,0x47,0x28,0x51,0x82,
+		0x79,0x08,0xc4,0x11,0xc8,0x16,0x09,0x1a,0xf6,0x99,0x60,0xbe,0x59,0x39,0x5c,0x89,0x14,0x20,0xb7,0xbe,
+		0x60,0x2c,0xd4,0x58,0x3c,0xfc,0x2a,0xd9,0x26,0x44,0x3a,0xd7,0x78,0x61,0x34,0xe4,0x21,0x0d,0x00,0x73,
+		0xc2,0x25,0xef,0xf2,0x80,0x2b,0xd0,0x65,0xc0,0x7d,0xdf,0x30,0xe2,0xe1,0x68,0xac,0xee,0xd5,0x7c,0xc4,
+		0xda,0x8a,0xcd,0xd4,0x03,0x29,0xbb,0x60,0x0f,0xc1,0xa4,0xfc,0x55,0xe8,0x81,0xb5,0x0f,0x25,0xff,0x0f,
+		0x6b,0x90,0xe3,0x09,0xb0,0x69,0x16,0xac,0xdd,0xea,0x55,0xb4,0x92,0x35,0x5c,0x83,0x54,0x47,0x33,0xfc,
+		0xbf,0x59,0x18,0x52,0xd1,0xe7,0xa1,0x05,0xa0,0xb1,0x67,0x48,0xae,0x71,0xac,0xe1,0x01,0x94,0x5b,0xb5,
+		0x3b,0x56,0x2a,0x0a,0x1f,0x40,0x40,0xcb,0xfc,0x58,0x33,0x5f,0x5e,0x3b,0x43,0xe5,0x0d,0x98,0xf7,0x08,
+		0xcc,0x90,0x4e,0x81,0xf9,0x64,0x2f,0x12,0x43,0xf0,0x32,0x86,0x4e,0xb1,0x5e,0x42,0xec,0x77,0x37,0xef,
+		0x7f,0xc0,0xdb,0x0f,0x37,0x9f,0xee,0x0e,0x6f,0x2f,0xff,0x7d,0x91,0x30,0xd2,0x90,0x0f,0x6f,0xaf,0x2f,
+		0xaf,0x7e,0x34,0xc8,0x9f,0x4c,0xf8,0x34,0xa4,0x65,0xf2,0x56,0x40,0xec,0x95,0xc9,0x47,0x16,0x4c,0x98,
+		0xe2,0x1e,0x40,0x24,0xb0,0x3d,0x94,0x4c,0xf0,0x1e,0x70,0x43,0xcf,0xad,0x92,0x49,0xd1,0x6e,0xc0,0xd6,
+		0xbc,0x6b,0x55,0x6c,0x34,0xb6,0xa4,0x07,0xbe,0x57,0x44,0x8b,0xee,0xa0,0x9d,0x2b,0x7f,0xd3,0x09,0x35,
+		0x50,0x88,0x72,0x08,0x6b,0xa9,0xc8,0xf5,0xdb,0xef,0x7f,0x7d,0xb9,0xf9,0x76,0x4b,0xda,0xe4,0x75,0xb3,
+		0x30,0xa1,0x82,0x4c,0xe5,0x57,0xc1,0xe1,0xd1,0x99,0x4a,0x09,0x29,0xc7,0xbc,0x41,0xe4,0x4e,0x59,0x57,
+		0x46,0xde,0x23,0x53,0x3a,0xf5,0x1c,0x83,0x38,0xa0,0xc2,0x9f,0x52,0xc1,0x00,0xf7,0x17,0x71,0x70,0x19,
+		0xa7,0x41,0x1c,0xdf,0xf3,0xbe,0x5e,0x3a,0x65,0xe2,0x78,0x43,0x1f,0x9f,0x63,0x2c,0x04,0xdd,0xde,0x5e,
+		0xbe,0x47,0x18,0x64,0xd6,0x5f,0xd5,0x3a,0x42,0x2e,0x3f,0xe3,0x73,0xed,0x4d,0xdd,0xad,0x9d,0xbe,0x76,
+		0xcf,0xdc,0x1a,0x02,0xaf,0xdf,0x9e,0x3b,0x0d,0x47,0x30,0x35,0x16,0x21,0x89,0x7a,0x44,0x0d,0x34,0xf5,
+		0x68,0xaa,0x19,0xe2,0xed,0x54,0x7e,0xc6,0xd4,0x86,0x38,0xaf,0x57,0x5f,0x57,0x11,0xc0,0x17,0x80,0x37,
+		0x08,0xa0,0x3a,0x55,0x10,0x7f,0x04,0xa9,0xeb,0x90,0x27,0x23,0xb3,0xc9,0x5c,0x94,0x78,0xad,0xc0,0x06,
+		0x05,0x01,0x98,0xeb,0x12,0x40,0xf7,0x0f,0x59,0xf2,0x5b,0xf6,0x13,0x38,0x1c,0xd6,0x0c,0x8c,0x2a,0xc5,
+		0x86,0x23,0x25,0x01,0x04,0xe1,0xd7,0x1b,0x87,0x7a,0x65,0x88,0xbd,0x48,0x15,0x4b,0xe0,0x24,0xde,0x23,
+		0xc5,0x04,0xa7,0x03,0x99,0x09,0x40,0x62,0x94,0x6b,0x92,0xa7,0x42,0xfc,0xea,0xe0,0xa0,0x99,0x47,0xad,
+		0x6b,0x72,0x28,0x50,0xdf,0x62,0xf3,0x17,0x31,0xc8,0x08,0x0b,0x74,0x16,0x62,0x4d,0xfc,0x03,0x60,0x4e,
+		0x25,0xb6,0xf1,0xef,0x3d,0xce,0x02,0x5f,0xb6,0x2f,0x3f,0x97,0xad,0x85,0x00,0x5f,0x32,0x75,0xc7,0x87,
+		0x0c,0x6a,0x4b,0x31,0x11,0x0e,0x05,0xb3,0x12,0x82,0x0c,0x65,0x72,0x54,0xad,0x56,0x75,0xfc,0x3e,0x2d,
+		0x14,0x88,0xd9,0x83,0xf5,0xbf,0x8a,0x20,0xd6,0x64,0xca,0x43,0x3f,0x9a,0xba,0xdf,0xaf,0xaf,0x3e,0xc2,
+		0xfb,0x2f,0xec,0xe7,0x98,0x49,0x05,0x2f,0x2b,0x15,0xa8,0x4a,0x3e,0x23,0x90,0x12,0xe4,0xf2,0xe2,0xec,
+		0xa0,0x4c,0x3e,0x40,0xbd,0xea,0x45,0xb3,0x32,0x39,0x1f,0x88,0x68,0xc8,0xca,0xe4,0x66,0xc4,0x04,0x44,
+		0xf8,0x2d,0xed,0x51,0xc1,0x0b,0x50,0xd8,0x71,0x05,0xb0,0x5a,0xc8,0xa6,0x24,0xcb,0x4f,0xab,0x59,0x30,
+		0x6a,0x66,0x19,0x9f,0x96,0xe1,0xe7,0x24,0x47,0xfc,0x16,0x04,0x9e,0xb0,0xef,0x37,0xdd,0xbf,0xa1,0x40,
+		0x16,0x9d,0x6b,0xee,0x81,0x9f,0xa2,0x9e,0xd2,0x52,0xde,0xdd,0x7d,0x76,0x34,0x3b,0x4b,0x03,0xa5,0x4e,
+		0x40,0xb3,0x98,0x4b,0x45,0x15,0xc4,0x36,0x16,0x41,0x60,0x93,0xb1,0x0c,0x24,0xf7,0xdc,0xaa,0x1b,0x13,
+		0x69,0x92,0x5b,0x24,0x21,0xed,0x36,0x39,0x26,0x2f,0x5f,0x92,0xf8,0x15,0x32,0x1a,0x4b,0x04,0xd7,0xab,
+		0xd5,0xd8,0x4c,0x98,0x5c,0x51,0xc0,0xd0,0xcc,0xf6,0xd6,0x0d,0xa2,0x7e,0x8a,0x9d,0x1c,0x01,0x98,0xdd,
+		0x41,0x56,0x96,0xe2,0xe0,0x1a,0xce,0x41,0x03,0x90,0xe5,0x5f,0xb7,0x37,0x9f,0xdc,0x11,0x15,0x92,0xad,
+		0xc6,0x37,0x71,0xf2,0x42,0xa3,0xbb,0x18,0xc5,0xa5,0x38,0x9c,0xf4,0x8b,0x05,0x9c,0xbc,0x68,0xc7,0xe1,
+		0xbd,0x40,0x49,0x65,0xad,0xc6,0x84,0xfa,0xba,0x48,0x78,0xc8,0x77,0x87,0x1c,0x24,0x99,0xed,0x5e,0x7e,
+		0x86,0x27,0xc8,0xc5,0x34,0xcc,0x44,0x56,0x56,0xcb,0xb4,0x8e,0x9a,0x1d,0x0a,0xb9,0x14,0xb8,0xf0,0xcf,
+		0xa3,0xca,0x1b,0x90,0x22,0x5b,0xb2,0x53,0x9a,0x03,0x73,0x87,0xd0,0x0a,0x68,0x9f,0x59,0xa2,0xc4,0x73,
+		0x23,0x16,0x16,0x9d,0x3f,0x2e,0xee,0x20,0x39,0x4d,0x54,0xc2,0x55,0x8c,0x11,0x2d,0x71,0x06,0x0b,0x7d,
+		0xb3,0x56,0xe2,0xd1,0x9c,0x1c,0x9b,0x1d,0xe4,0x64,0xb0,0x1d,0xed,0x9b,0x54,0x82,0xd7,0x20,0xc3,0x93,
+		0x5a,0x68,0xa3,0x0f,0xb0,0x6f,0x0d,0xef,0x58,0xf3,0x54,0xb5,0x0c,0x51,0xe6,0x4c,0x7c,0xb1,0x09,0xa6,
+		0x4b,0x21,0x0a,0x6f,0x50,0x1b,0x7c,0x2a,0x3c,0x65,0x49,0xbc,0x20,0x92,0x6c,0x35,0xcd,0x39,0xbe,0x5a,
+		0x49,0x64,0x2d,0xb6,0x9a,0xec,0xda,0xbc,0x5c,0x49,0xc8,0x84,0x88,0xc4,0x6a,0xb2,0x0b,0x7c,0x95,0x10,
+		0xa5,0x4c,0x9a,0x12,0x1e,0x5b,0x68,0xc2,0x4d,0x5b,0x5f,0x87,0xaf,0x84,0xb9,0x23,0xec,0xf3,0xde,0xbc,
+		0xb8,0xa1,0x35,0xc8,0x71,0x17,0xbb,0x51,0x57,0x57,0x77,0x15,0x8d,0xb8,0xa7,0xab,0x6d,0x5c,0x81,0xa1,
+		0xea,0x96,0x6c,0xb0,0x2f,0xbc,0x55,0xc8,0x78,0x6b,0xe1,0x0b,0xb4,0xb3,0xc9,0x73,0xac,0xf7,0x5f,0x34,
+		0x07,0x0c,0x84,0x3e,0x53,0x57,0x58,0xc6,0x73,0x41,0x91,0x36,0xe5,0x52,0x44,0xac,0x5b,0x43,0x3b,0xc6,
+		0xc9,0xd7,0xc9,0xb4,0x9d,0x76,0x66,0xa5,0xad,0xbe,0x82,0x55,0xda,0x53,0x38,0x07,0xb2,0xee,0xb8,0x0f,
+		0x63,0x17,0x78,0xe9,0xe3,0xdd,0xf5,0x15,0xb8,0x09,0x5e,0xb8,0x3e,0x55,0xb4,0x59,0x10,0x6c,0x44,0x79,
+		0xa8,0xbe,0x5e,0xe6,0x54,0x4b,0xeb,0x8f,0x13,0x98,0xae,0x2c,0xe8,0x94,0xb8,0xb4,0x2c,0x7c,0x63,0x0c,
+		0x0d,0xe4,0xcb,0xeb,0x18,0x92,0x66,0xde,0xb9,0x06,0x9c,0x5d,0x50,0x98,0xa2,0x9d,0x5a,0x33,0xdf,0x26,
+		0x9f,0x1d,0x21,0x36,0x12,0x4c,0x20,0xa4,0x96,0x5c,0x78,0xd5,0x6a,0x38,0x5b,0xdb,0x47,0x66,0xbb,0x14,
+		0x7c,0x5d,0xea,0xd3,0x45,0xfe,0x05,0x16,0xf9,0x7f,0xfe,0x21,0xb3,0xb8,0xbc,0xbf,0xb0,0xe5,0x3d,0x2e,
+		0xa3,0xa6,0x45,0x74,0xa1,0x1b,0x1a,0x41,0xd2,0x45,0x3b,0x5b,0xae,0xb5,0xe4,0xcf,0xab,0x7b,0x99,0x8a,
+		0xe7,0x54,0xf4,0x3c,0x12,0xf7,0x78,0x3b,0x30,0x97,0xc7,0x92,0x5d,0x45,0x61,0x1f,0xaf,0xb5,0xfa,0xeb,
+		0x32,0x6e,0x7e,0xca,0x32,0x88,0x94,0xb3,0xa8,0x8d,0xab,0xaa,0xe2,0x42,0x72,0xdd,0x05,0x62,0x3b,0xaa,
+		0x6e,0xe4,0xcf,0xbf,0xb0,0x1e,0x58,0xc8,0x8f,0xbc,0xf1,0x10,0xf6,0x4d,0x2e,0x18,0xfb,0x22,0x60,0x78,
+		0xfb,0x6e,0x7e,0xe9,0x17,0x5f,0x69,0x31,0x5e,0x95,0x52,0x70,0xf9,0x6e,0x7e,0x47,0xfb,0x9f,0x60,0xe9,
+		0xe2,0x2b,0xcd,0xe1,0x55,0xe9,0xbe,0xfa,0x00,0x46,0xb2,0xdc,0x32,0x91,0xe5,0x38,0x38,0x68,0x0b,0x52,
+		0xc4,0xf5,0xb8,0x9e,0x9a,0xe0,0xd2,0x32,0xdd,0xc8,0xd5,0xcc,0xdd,0x80,0x85,0x7d,0x35,0x68,0x92,0x83,
+		0x03,0x1e,0x4b,0x16,0xc4,0x0d,0xcb,0xa0,0xdc,0xf3,0x07,0x3b,0x92,0x01,0x3c,0xb5,0x0e,0x8c,0xce,0x10,
+		0x89,0x53,0xd4,0x56,0xb8,0x5e,0x40,0xa5,0x44,0xb1,0x00,0x27,0x70,0xd1,0x2a,0xa4,0x03,0xeb,0x91,0xdf,
+		0x89,0xa3,0xb7,0x32,0x0e,0x69,0x68,0x71,0x84,0x25,0x3c,0x67,0x41,0x50,0x2c,0xb9,0x38,0x2b,0x9f,0x9b,
+		0x4d,0xa3,0x26,0xb4,0xa6,0xde,0x8a,0x67,0x5d,0x81,0xec,0xaf,0x76,0x64,0x6d,0xbc,0x86,0x14,0x70,0xd9,
+		0x91,0x06,0x5d,0x8c,0x48,0xd8,0x29,0xb8,0xf7,0x08,0x30,0xa8,0x9c,0x8f,0xe8,0x4c,0x17,0xbd,0x5a,0x0c,
+		0xc7,0x01,0x34,0xc6,0x20,0x5f,0x5c,0x62,0xa4,0xa2,0x9e,0xe5,0xd6,0x7b,0x97,0x82,0x6b,0x27,0x34,0x18,
+		0xb3,0xac,0xee,0xeb,0x09,0xbc,0xc7,0x2a,0x90,0xe8,0xcd,0x11,0xf3,0xd3,0x86,0xd8,0x4c,0x54,0x5b,0x26,
+		0x02,0x1b,0x6c,0xa2,0x09,0x33,0x92,0x19,0x33,0xa4,0x14,0xc4,0x28,0xd7,0x0a,0xfa,0x2c,0x88,0xa3,0x86,
+		0x6e,0x0c,0xe4,0x44,0x55,0xd3,0x65,0x38,0xc4,0xca,0xa7,0x22,0x2d,0x61,0xe2,0x53,0xf2,0x1b,0xa9,0x61,
+		0xd6,0x57,0xcd,0x53,0x0b,0x9e,0xf4,0x0d,0x4e,0xf0,0xf5,0xa3,0x37,0x8b,0x4a,0xa0,0x0b,0xec,0xe6,0x3d,
+		0x10,0x46,0x2c,0x3e,0x5a,0x63,0x02,0xe8,0xd3,0x78,0xd8,0x85,0x62,0x49,0x4b,0x00,0xb5,0xd6,0x02,0xe8,
+		0xae,0x36,0x8e,0x05,0xa9,0x9f,0xe1,0x7c,0x82,0xa2,0x5b,0x95,0x87,0xf7,0x0e,0xdc,0x31,0xc5,0xa0,0x79,
+		0xb6,0x75,0xfe,0xa7,0xf6,0x0b,0xc3,0x38,0xda,0xda,0x64,0x47,0xbf,0xc0,0xe6,0x5a,0x9b,0x79,0x23,0x45,
+		0xb8,0x30,0xe2,0xd3,0x96,0x4a,0x3f,0x2c,0x2d,0x17,0x21,0x4c,0x56,0xbe,0x31,0x22,0xe9,0x2b,0x18,0x3f,
+		0xf9,0xc2,0xf5,0xa6,0x29,0x24,0x65,0x60,0x87,0x10,0x05,0xeb,0xfd,0x65,0x99,0x2c,0x22,0x2e,0xcf,0x66,
+		0x7b,0xd0,0x82,0x6d,0x76,0x62,0xb3,0x39,0x8c,0xc3,0x2d,0xea,0x98,0xb8,0x8e,0x4b,0xdb,0x5a,0x36,0xc2,
+		0xb0,0xc9,0x97,0xb9,0x3c,0x37,0x73,0x64,0x93,0x2f,0x78,0x99,0xee,0x9d,0x8c,0x11,0xc9,0xce,0x67,0xcd,
+		0x6e,0x24,0x37,0x25,0xac,0xda,0x88,0x40,0xef,0xb7,0x69,0xf1,0xb4,0x69,0x33,0xb2,0x1a,0x0d,0xb2,0x05,
+		0xb7,0x51,0x71,0xd7,0xdf,0x36,0x4d,0xc5,0x68,0xc8,0x24,0xd9,0xd7,0xdb,0x3d,0x4d,0x7a,0x02,0x31,0xcc,
+		0x25,0xfb,0xd9,0xdc,0xb9,0xc5,0xc1,0x8d,0xe0,0x6c,0xb7,0x26,0xb7,0x68,0x63,0xa6,0xad,0xa5,0x5a,0x5a,
+		0xda,0x19,0xf9,0x9e,0xb6,0x88,0x7d,0xed,0x8e,0x98,0x92,0x1b,0xca,0xf8,0x58,0x26,0xd3,0x02,0x77,0x8d,
+		0x07,0x7d,0x00,0x84,0x9d,0x36,0x75,0xfa,0xe6,0xc1,0x54,0x48,0x47,0x10,0x01,0xa6,0x2b,0x2c,0x1b,0x5d,
+		0xd7,0xa8,0xcd,0x9d,0x61,0x28,0xfb,0x60,0x91,0xec,0x94,0x88,0x2c,0x20,0xfb,0xc6,0x81,0xc2,0x20,0xd3,
+		0xf1,0x15,0x42,0x9b,0x95,0x74,0xc2,0x7c,0x27,0x3f,0x7e,0xaf,0x5e,0xf5,0x3d,0x0b,0x14,0x4d,0xbc,0xbd,
+		0xf0,0x5c,0x8b,0x54,0x57,0xed,0x6c,0xc1,0x91,0x18,0x4b,0xc5,0x14,0xe6,0x01,0xa9,0x95,0xc8,0x4b,0x52,
+		0x9d,0x7d,0x80,0xff,0x74,0xf9,0xb6,0xa8,0xb6,0xe3,0xaf,0xf0,0xc3,0xb6,0x7d,0xa0,0x0d,0x28,0x50,0x6d,
+		0x1e,0x7a,0x0e,0x9e,0x92,0x14,0x72,0x73,0x6e,0x33,0x15,0xc3,0x1b,0xc2,0x4d,0xe6,0x93,0x72,0x21,0x1a,
+		0x04,0xcf,0x7d,0xd2,0x13,0x52,0x8d,0xc0,0xdc,0xe2,0x40,0x00,0x77,0x58,0x0e,0xf0,0x6a,0xf2,0xf7,0xc1,
+		0x85,0x48,0xb9,0xa0,0xde,0x20,0x75,0x96,0xf3,0x18,0xeb,0xf2,0x08,0x7b,0x5d,0x62,0xc7,0x39,0x79,0xff,
+		0xf8,0x10,0x0b,0x03,0xb7,0x20,0x24,0x08,0x1c,0xc7,0xdc,0x42,0x84,0x6d,0xdb,0xf2,0x6c,0xca,0xe5,0x07,
+		0xd4,0x5c,0xf3,0x4d,0xed,0x00,0xf6,0xc9,0x84,0x85,0xd7,0x73,0x65,0x4b,0x4f,0xc7,0x8a,0x87,0xd8,0x5a,
+		0x36,0x36,0xf2,0x4c,0x87,0xc8,0xb4,0xf2,0x34,0x0b,0x7d,0xba,0x96,0xb4,0xf5,0xd4,0x1b,0x42,0x2a,0x15,
+		0x28,0x81,0xac,0x0f,0x0e,0x8f,0xc2,0x60,0x6e,0x31,0x5b,0x19,0x24,0x0b,0x4c,0xda,0x3f,0xd5,0xc7,0x01,
+		0x70,0x1b,0x17,0x9b,0xa5,0x86,0x04,0x08,0x34,0x45,0x56,0x3f,0x2b,0x91,0xfd,0x3a,0x94,0xe9,0xdf,0x6b,
+		0xfa,0xd4,0x26,0x7b,0x2c,0x73,0x5b,0xc9,0x66,0xcb,0x2c,0xb0,0xdc,0xee,0x96,0xb9,0xe8,0x6f,0x2d,0x64,
+		0xb7,0x5e,0x17,0x57,0x80,0x54,0xca,0x15,0x33,0x39,0xb7,0x88,0x21,0xa7,0x94,0x3a,0x15,0xfb,0x3f,0xec,
+		0x5d,0x5b,0x15,0x73,0x0c,0xde,0x81,0x3b,0xfb,0xe9,0x08,0x2b,0x3a,0x7a,0x3f,0xa2,0x7e,0xdb,0x31,0x47,
+		0xa3,0xf8,0x29,0xc8,0xe7,0x13,0xa2,0xfb,0x6b,0xdb,0xd1,0x5f,0x67,0x10,0x36,0xea,0xb4,0xba,0xc9,0xd7,
+		0xa1,0xcc,0x07,0xa1,0x6e,0xa7,0x55,0x19,0xe1,0x07,0x24,0x7d,0x40,0xcf,0x81,0x93,0xed,0x24,0x8e,0xfd,
+		0x16,0xd1,0x76,0xaa,0x0e,0xd1,0xf5,0xd9,0x7e,0x8e,0x6a,0xe0,0x97,0x1a,0xfd,0xcd,0x49,0xcb,0x41,0x5a,
+		0x4a,0x74,0x5a,0xca,0xef,0x60,0x72,0xb6,0x2a,0x70,0x83,0x0f,0x36,0xa0,0x92,0x67,0xf4,0x7f,0xf2,0x00,
+		0x5e,0x4c,0xee,0xd1,0x1d,0xe6,0xa1,0x02,0x7c,0x08,0xfc,0x5a,0xed,0x74,0xc3,0xc2,0xab,0xd0,0x52,0x89,
+		0xaa,0xa3,0xf1,0xab,0x09,0x65,0x4b,0x7f,0xe7,0x48,0x7d,0x2c,0x70,0x34,0x22,0x05,0x71,0x2b,0x9d,0xd5,
+		0x58,0xf1,0xe7,0x10,0x83,0x89,0x31,0xb7,0x07,0x72,0x6d,0x13,0xb2,0x59,0x7f,0x48,0x67,0xa6,0x52,0xb4,
+		0x9d,0xd7,0x86,0x2c,0x4c,0xd1,0xa0,0x82,0x0b,0x7d,0x6a,0x46,0x9f,0xda,0x56,0x7d,0x6a,0xfb,0xe8,0x53,
+		0xdb,0x47,0x9f,0xda,0x33,0xf4,0xa9,0xad,0xd3,0xa7,0x6e,0xf4,0xa9,0x6f,0xd5,0xa7,0xbe,0x8f,0x3e,0xf5,
+		0x7d,0xf4,0xa9,0x3f,0x43,0x9f,0xfa,0x3a,0x7d,0x8e,0x8c,0x3e,0x47,0x5b,0xf5,0x39,0xda,0x47,0x9f,0xa3,
+		0x7d,0xf4,0x39,0x7a,0x86,0x3e,0x47,0xeb,0xf4,0x39,0x36,0xfa,0x1c,0x6f,0xd5,0xe7,0x78,0x1f,0x7d,0x8e,
+		0xf7,0xd1,0xe7,0xf8,0x19,0xfa,0x1c,0xaf,0xd3,0xe7,0xc4,0xe8,0x73,0xb2,0x55,0x9f,0x93,0x7d,0xf4,0x39,
+		0xd9,0x47,0x9f,0x93,0x67,0xe8,0x73,0xb2,0x4e,0x9f,0x53,0xa3,0xcf,0xe9,0x56,0x7d,0x4e,0xf7,0xd1,0xe7,
+		0x74,0x1f,0x7d,0x4e,0x9f,0xa1,0xcf,0xe9,0x3a,0x7d,0xce,0x8c,0x3e,0x67,0x5b,0xf5,0x39,0xdb,0x47,0x9f,
+		0xb3,0x7d,0xf4,0x39,0x7b,0x86,0x3e,0x67,0x79,0x7d,0x2a,0x71,0x23,0xaa,0xe8,0x16,0x89,0x7d,0x57,0x00,
+		0x4a,0x21,0xc3,0xce,0x7c,0x9d,0x77,0x88,0x9e,0x1a,0xda,0xce,0xed,0xdb,0x3f,0x2f,0x1c,0x62,0x4f,0xbb,
+		0xda,0x4e,0x7a,0xd2,0x6c,0x3a,0x9a,0x58,0xf3,0x20,0x96,0xd5,0x65,0x0f,0x66,0x33,0xdd,0x95,0xb9,0x84,
+		0x81,0xf8,0x10,0x06,0x1d,0xd2,0x9d,0x03,0xec,0x1b,0xbf,0x1b,0x88,0x48,0xa9,0x80,0x95,0xc9,0x3c,0x1a,
+		0x13,0x8f,0x86,0xb8,0x55,0xb1,0x47,0xc2,0x6a,0x40,0x61,0xdb,0x02,0x5d,0xd7,0x25,0x3f,0xe0,0xe5,0x70,
+		0x2c,0x15,0xe9,0x71,0x01,0xbf,0x52,0x45,0x23,0x42,0x43,0x1f,0x36,0x03,0x01,0xa3,0x12,0x51,0x99,0x5e,
+		0xc0,0xb5,0x2b,0xde,0x45,0xc4,0x9c,0xba,0xd8,0x85,0xcb,0x30,0x0d,0x2b,0xc2,0x95,0x24,0xf1,0x24,0xa8,
+		0x22,0x52,0x75,0xad,0x9c,0xb1,0xc6,0x7a,0x8a,0xa0,0x41,0xa0,0x49,0xe4,0xaa,0xd9,0xc1,0x7c,0x7f,0xde,
+		0x77,0x72,0xf8,0x5f,0x0d,0x0b,0xeb,0x7d,0x65,0x24,0xdc,0x2a,0x96,0xd8,0x14,0xa8,0x01,0xdd,0x35,0xf6,
+		0xf0,0xec,0x6b,0x0f,0xdc,0x67,0xb4,0xe1,0x20,0x5c,0x0e,0xd3,0xbd,0xa2,0x93,0x5c,0xdd,0x9c,0xdf,0xe4,
+		0x42,0x54,0x9f,0x44,0xf6,0x68,0x00,0xdb,0x18,0x1b,0xa5,0x1b,0x98,0xbc,0xbf,0xb8,0xba,0xb8,0x5b,0xcf,
+		0xc6,0x1c,0xe4,0x1b,0x2e,0x72,0x44,0x43,0x23,0x35,0x6c,0xc7,0xa1,0x2a,0x54,0x10,0xb0,0x90,0xd4,0x5e,
+		0x28,0x19,0x08,0xd6,0x03,0x95,0x61,0x83,0x0a,0x73,0xab,0x3b,0x50,0x43,0xa7,0x63,0x1f,0x92,0x69,0x95,
+		0x76,0xb2,0x11,0x19,0x13,0xc1,0x2e,0x91,0xcd,0x0c,0xc9,0x20,0xc2,0x18,0xc9,0x23,0x8e,0xb4,0x00,0x7a,
+		0xf0,0x4e,0x9c,0x9f,0x3a,0x6b,0xb0,0x7f,0xe8,0x43,0x16,0x7f,0x9e,0x52,0xc7,0xbf,0x4e,0x71,0x30,0xc6,
+		0x30,0xc2,0x2b,0x30,0x54,0xe3,0x25,0x0e,0x2f,0xfd,0x87,0x5e,0x9d,0xc2,0x7f,0x01,0x44,0x78,0xdb,0x52,
+		0xf1,0x25,0x00,0x00,
+	};
+
+	//service.htm 13313 bytes, minified 6711, gzip 2347
+	static const uint8_t asset_service_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x59,0x6d,0x6f,0xdb,0x38,0x12,0xfe,0xae,0x5f,
+		0xc1,0x25,0x70,0x5d,0x1b,0x8d,0xe5,0x97,0x76,0xbb,0x5b,0xbf,0x05,0xde,0xc4,0x69,0x7d,0x68,0x5e,0x10,
+		0xa7,0xd9,0xf6,0x7a,0xc5,0x82,0x96,0x68,0x9b,0x5b,0x49,0xd4,0x51,0xb4,0xe5,0x5c,0x37,0xff,0xfd,0x66,
+		0x28,0x4a,0x96,0x6c,0xc7,0x2d,0xee,0x70,0x8b,0xa0,0xb6,0x39,0x7c,0x66,0x38,0x7c,0x38,0x1c,0x0e,0xd9,
+		0xfe,0x52,0x87,0x01,0xd9,0x84,0x41,0x94,0x0c,0xe8,0x52,0xeb,0xb8,0xdb,0x6c,0xa6,0x69,0xea,0xa6,0x2f,
+		0x5c,0xa9,0x16,0xcd,0xf6,0xeb,0xd7,0xaf,0x9b,0x1b,0xc4,0xd0,0xa1,0xd3,0x5f,0x72,0xe6,0xc3,0x57,0xc8,
+		0x35,0x23,0x11,0x0b,0xf9,0x80,0xae,0x05,0x4f,0x63,0xa9,0x34,0x25,0x9e,0x8c,0x34,0x8f,0xf4,0x80,0xa6,
+		0xc2,0xd7,0xcb,0x81,0xcf,0xd7,0xc2,0xe3,0x0d,0xd3,0x38,0x21,0x22,0x12,0x5a,0xb0,0xa0,0x91,0x78,0x2c,
+		0xe0,0x83,0xb6,0xdb,0x42,0x6b,0x5a,0xe8,0x80,0x0f,0xcf,0xcf,0xce,0xc8,0x78,0x7a,0x63,0xf4,0x95,0x0c,
+		0x02,0xae,0x48,0x83,0x4c,0xb9,0x42,0x75,0x72,0x29,0x7d,0xde,0x6f,0x66,0x40,0xa7,0x9f,0xe8,0x07,0xfc,
+		0x76,0xe5,0x4a,0x03,0xea,0xab,0x33,0x93,0xca,0xe7,0xaa,0x4b,0x12,0x19,0x08,0xbf,0x67,0x9b,0xd9,0x90,
+		0x5d,0xd2,0x8e,0x37,0x3d,0x27,0x66,0xbe,0x2f,0xa2,0x45,0x23,0xe0,0x73,0xdd,0x25,0x9d,0x75,0xda,0x73,
+		0x1e,0xad,0xfe,0x07,0x30,0xe0,0x8b,0x24,0x0e,0xd8,0x43,0x97,0xcc,0x03,0x0e,0x68,0xfc,0x6c,0xf8,0x42,
+		0x71,0x4f,0x0b,0x19,0x75,0xc1,0xa5,0x60,0x15,0x46,0x60,0x98,0x79,0x5f,0x16,0x4a,0xae,0x22,0xbf,0x4b,
+		0x22,0x19,0xf1,0x9e,0xb3,0xe4,0x62,0xb1,0x04,0x8b,0xed,0x56,0xeb,0x6f,0xc6,0xa4,0x56,0x22,0x46,0x8f,
+		0x0a,0x64,0x03,0x94,0x25,0xf8,0x26,0x15,0x8b,0x16,0x5c,0x71,0x3f,0x1b,0x39,0x3a,0x08,0x0a,0xd0,0xda,
+		0x42,0x71,0x1e,0x19,0x54,0x24,0x43,0x11,0xb1,0x00,0xa0,0x6b,0x91,0x88,0x99,0x08,0x84,0x06,0x1f,0x97,
+		0xc2,0xf7,0x33,0x80,0x88,0xe2,0x95,0xfe,0xa4,0x1f,0x62,0x3e,0xd0,0x7c,0xa3,0x3f,0x03,0x70,0x0e,0xec,
+		0x35,0x12,0xf1,0x6f,0xde,0x25,0x2f,0xd7,0xa0,0xdd,0x73,0x2c,0x0d,0x2f,0x5b,0x38,0x69,0xcb,0x43,0x97,
+		0xb4,0xe2,0x0d,0xfe,0xeb,0x39,0x21,0x53,0x0b,0x11,0x59,0x01,0x72,0xb7,0x41,0x75,0x83,0xb1,0x3c,0x82,
+		0x68,0x67,0xb0,0xd9,0x4a,0x6b,0x19,0xe1,0x70,0x15,0xe3,0xfb,0x63,0x3f,0x3a,0xbf,0x5e,0x9f,0x7f,0x04,
+		0xdc,0xc5,0xf5,0xd5,0x5d,0x63,0x3a,0xf9,0xc7,0xb8,0xe8,0x32,0x92,0x8b,0xd1,0xe5,0xe4,0xdd,0xc7,0x2e,
+		0xb9,0xe7,0xca,0x67,0x11,0x3b,0x21,0x23,0x05,0xd1,0x71,0x42,0xde,0xf2,0x60,0xcd,0xb5,0xf0,0x40,0x92,
+		0xb0,0x28,0x69,0x24,0x5c,0x89,0x39,0x58,0x8b,0x0f,0xce,0xf0,0xd1,0xd1,0x6c,0x16,0xf0,0x27,0xfa,0xfa,
+		0x4d,0x1b,0x2e,0xfd,0xc4,0x83,0xc5,0xd1,0xc4,0x4c,0x81,0x22,0x61,0xcd,0x3f,0xd8,0x9a,0x65,0x52,0x88,
+		0xc3,0x35,0x53,0x24,0x4d,0xde,0x2b,0x41,0x06,0x84,0xa6,0x09,0xc4,0x7f,0xfb,0x75,0xc7,0x6d,0xbf,0xfa,
+		0xc5,0x7d,0xe5,0xb6,0xbb,0xed,0x4e,0xeb,0x97,0x56,0x93,0xf6,0x0c,0x2c,0x96,0x29,0x04,0xde,0x80,0x7c,
+		0x25,0x14,0xad,0xd1,0x2e,0xa1,0xbe,0xe7,0xbd,0x9f,0xd0,0x13,0x42,0xbd,0xd0,0xc7,0xb6,0x81,0x60,0x3b,
+		0x1c,0xfd,0x1e,0x88,0x50,0x68,0x14,0x62,0xfb,0xbe,0xda,0x0c,0x47,0xf0,0xab,0xf3,0x02,0x3b,0xf0,0x87,
+		0xdb,0x81,0x5f,0x18,0x44,0xd0,0xd0,0x6a,0xc5,0x4d,0x0b,0xe2,0x04,0x9a,0x73,0x16,0x24,0x9c,0x3c,0x66,
+		0x1e,0x2c,0x99,0xf2,0x53,0xa6,0xf8,0x71,0x27,0x72,0x14,0x8a,0xa6,0xd3,0xc9,0x39,0xca,0x60,0x9f,0xfd,
+		0xde,0xea,0xa0,0x64,0x72,0x83,0xed,0x7c,0x92,0x3f,0xbb,0x6d,0x14,0x5e,0x8e,0xce,0x72,0xd7,0xe2,0xd4,
+		0xcf,0x7f,0xa6,0xc9,0x0d,0x6e,0x6e,0x08,0x74,0xa4,0x01,0x05,0x62,0x2b,0x78,0x8d,0x82,0x35,0x57,0x09,
+		0x6c,0x16,0x90,0x60,0x8b,0x99,0x9d,0x93,0xf1,0x10,0x04,0x34,0xf7,0x3a,0xb1,0xdb,0xf9,0xa8,0xd3,0x16,
+		0x44,0x2b,0x66,0x14,0x64,0x9c,0xc2,0x0c,0xd3,0x9a,0x87,0xb1,0x4e,0xc0,0x0e,0x84,0xec,0x7c,0x15,0x19,
+		0x18,0xc4,0xab,0xd4,0xb5,0x3a,0x84,0x81,0x98,0x93,0x5a,0x81,0x19,0xc2,0xe6,0x04,0x21,0x51,0x5c,0xaf,
+		0x54,0xd4,0x23,0x8f,0x4e,0xde,0xf5,0xfc,0x79,0x6f,0x17,0xda,0x31,0xea,0x90,0xa4,0x7e,0xe3,0xb3,0x44,
+		0x7a,0x5f,0x38,0x18,0x84,0x20,0x22,0x1c,0xa9,0xff,0xea,0x60,0x5e,0x7c,0x03,0x32,0xda,0xcc,0x99,0x3d,
+		0x9d,0x0b,0x1e,0xf8,0xc9,0x60,0x72,0x73,0x62,0x39,0x02,0x7c,0xc2,0xf5,0x9d,0x08,0x39,0xa4,0x97,0x5a,
+		0xe1,0x1c,0x3a,0x66,0x3d,0x04,0x1f,0x4e,0xc8,0x8b,0x56,0xab,0x85,0xa6,0xe1,0xaf,0xc0,0xe4,0xe6,0xf5,
+		0x92,0xbf,0x57,0x41,0x3e,0x93,0x54,0x44,0xbe,0x4c,0xdd,0x0f,0x97,0xef,0xde,0x42,0xff,0x2d,0xff,0xd7,
+		0x8a,0x27,0x1a,0x3a,0x9b,0x4d,0x48,0x4c,0x3e,0x27,0x73,0xa9,0xc8,0x64,0xfc,0xf3,0xf3,0x13,0x72,0x01,
+		0x29,0x6b,0x2e,0x37,0x27,0xe4,0x6c,0xa9,0x64,0x08,0xb1,0x73,0x1d,0x73,0x05,0x7b,0x68,0xca,0xe6,0x4c,
+		0x09,0x07,0x92,0x3b,0x8e,0x00,0xac,0x45,0x3c,0x25,0x55,0x7b,0x66,0x9a,0x4e,0x36,0xcd,0xaa,0xe1,0x57,
+		0x27,0xf0,0xf1,0xd3,0x8e,0xf2,0x08,0x1c,0x5e,0xf3,0x0f,0xd7,0xb3,0x3f,0x20,0x47,0xd6,0xe8,0xa5,0xf0,
+		0x94,0x4c,0xe4,0x5c,0x1b,0x2f,0xef,0xee,0x6e,0xa8,0x31,0x67,0x75,0x20,0xdb,0xe1,0xf2,0x3d,0x24,0x9a,
+		0x69,0xee,0x2d,0x31,0x0f,0x82,0x99,0x0a,0x33,0x8e,0x56,0x0f,0x76,0xba,0xb9,0x92,0x51,0x99,0xa2,0x0a,
+		0x19,0x0c,0xc8,0x4b,0xf2,0xec,0x19,0xc9,0xbb,0xd0,0xd0,0x2a,0x41,0x71,0xa7,0xd5,0xca,0x69,0x82,0x73,
+		0x03,0xf2,0x3f,0x47,0x9a,0xed,0x4f,0x37,0x90,0x8b,0x92,0xb9,0x24,0x06,0x31,0xbf,0x83,0x7d,0x5f,0xcf,
+		0x03,0x29,0x7c,0x80,0x19,0x80,0x2f,0x7f,0x9f,0x5e,0x5f,0xb9,0x31,0x53,0x09,0x3f,0x8c,0xcf,0xe2,0xe4,
+		0x07,0x03,0x77,0x31,0x6e,0xeb,0x79,0x38,0x99,0x8e,0xad,0x9c,0xfc,0x30,0xc8,0x03,0x7a,0x0b,0x29,0xed,
+		0x55,0x83,0x84,0x9c,0x5c,0x49,0x33,0x94,0x3c,0x2f,0xf6,0xb3,0x3b,0xb9,0x81,0x16,0xed,0x56,0x64,0x59,
+		0x64,0x55,0x67,0x59,0x9e,0xa3,0x31,0x87,0x4e,0xee,0x05,0x2e,0xfc,0x79,0x4c,0x7b,0x4b,0x52,0xe3,0x7b,
+		0x3c,0x95,0x2d,0x70,0x37,0xe4,0x49,0xc2,0x16,0xdc,0x2a,0x15,0x2b,0x17,0xf3,0xa8,0x46,0xdf,0x8c,0xef,
+		0x60,0x37,0x66,0x51,0x79,0x62,0xd2,0x12,0xc0,0x8a,0xc5,0xe0,0x91,0x9f,0x8d,0x55,0xac,0xe8,0x8e,0x1f,
+		0xc7,0x17,0x88,0x56,0xd0,0xd4,0xac,0x4d,0x69,0x83,0xb7,0x61,0x87,0xa7,0x79,0xaf,0x8d,0x3e,0x40,0x4f,
+		0x33,0xdb,0xf9,0xcc,0x0b,0x04,0xc4,0x1a,0xfa,0x5c,0x89,0x2f,0xbe,0xc6,0xed,0xe2,0xc8,0xe8,0x1a,0x67,
+		0x83,0x2d,0xe7,0xb1,0xaa,0xe2,0x05,0x32,0xe1,0x87,0x75,0xce,0xb0,0xeb,0xa0,0x92,0x65,0xec,0xb0,0xda,
+		0x65,0xd6,0x79,0x50,0x91,0x2b,0x25,0xd5,0x61,0xb5,0x31,0x76,0x15,0x4a,0x25,0x4a,0x4b,0xce,0xe3,0xb1,
+		0x5b,0x58,0x33,0xec,0x9b,0xf0,0x4d,0xe0,0xd4,0x88,0x16,0x62,0xfe,0x50,0x3b,0x96,0x5b,0x57,0x33,0x3c,
+		0xef,0x66,0x26,0xbb,0x6a,0x19,0x0b,0x2f,0x01,0xf1,0xa7,0xed,0x69,0x95,0x27,0xdf,0xcf,0xe4,0xb1,0x6e,
+		0xc3,0x7e,0xbb,0x6e,0x4e,0x65,0xdd,0xb6,0xab,0x82,0x8c,0x67,0x3b,0x1e,0x0a,0x3f,0xae,0x6c,0xd1,0xb6,
+		0x13,0x14,0x65,0x2a,0xf7,0x22,0xe2,0x29,0xcb,0x66,0x61,0xe8,0x6e,0x9e,0x2c,0xf3,0xf4,0xdd,0xa6,0x0c,
+		0xeb,0x07,0x4c,0x95,0x57,0x0a,0x4b,0x41,0x3e,0x5b,0x2d,0x5c,0x11,0xc1,0x2a,0xbd,0xbd,0xbb,0x7c,0x07,
+		0xcb,0x04,0x1d,0xae,0xcf,0x34,0xeb,0x39,0x8a,0xc7,0x4c,0x44,0xfa,0xfd,0x64,0x67,0x6a,0x98,0xef,0xf1,
+		0x90,0x36,0xa1,0x6e,0xa8,0x74,0xf3,0x53,0x1f,0x37,0x39,0x14,0x0d,0x99,0xf0,0xbe,0x22,0x43,0xb7,0x67,
+		0x3a,0xba,0x49,0x95,0xbb,0x66,0xc1,0xca,0xa4,0x39,0x7a,0x77,0x3b,0xb9,0xb9,0x19,0x9f,0xd3,0xad,0x25,
+		0x73,0xfc,0x83,0x0a,0x6e,0xbb,0x5e,0x21,0x13,0x98,0x89,0x4d,0x45,0x90,0xcb,0xa6,0x97,0x05,0xa8,0x38,
+		0xaf,0xaa,0x16,0xf6,0x06,0xbb,0xbe,0xa2,0xe4,0xd4,0xd6,0x15,0x5d,0xab,0x5b,0x21,0xb3,0x56,0xe1,0x32,
+		0xab,0x7a,0x22,0x99,0x12,0xcc,0x4e,0x25,0xdb,0x75,0x88,0x56,0x9b,0x4f,0x31,0x14,0xf3,0x84,0xba,0x8d,
+		0x48,0x83,0x05,0xce,0xf6,0xc9,0xcd,0x34,0x7a,0xbb,0x11,0x9d,0x89,0xab,0x2c,0x97,0xd8,0x2f,0x0e,0x8c,
+		0x27,0x92,0xf8,0xce,0x38,0x87,0xf2,0xf7,0x57,0x27,0x4f,0xcf,0x8f,0xc7,0x72,0xf8,0x2e,0xec,0x60,0xf6,
+		0xa4,0x85,0x6b,0xb4,0x5e,0x3e,0x11,0x60,0xd3,0x19,0x9e,0xb3,0xdd,0x75,0x34,0x01,0xe7,0x18,0xbb,0x9a,
+		0xdb,0xa3,0xc2,0x5e,0x4d,0xc2,0x51,0x85,0xb6,0x3c,0xc8,0x8a,0xfe,0xfb,0x4a,0x77,0xcd,0xc6,0x5b,0xdd,
+		0xd5,0xf2,0x42,0x6c,0xb8,0x5f,0x6b,0x5b,0xc7,0xb6,0xf1,0x83,0xee,0xd8,0x88,0xf0,0x02,0x96,0x24,0x57,
+		0x70,0x8f,0xc3,0xc8,0x34,0xc5,0x67,0xcf,0xa9,0x06,0xcb,0x36,0x30,0xb7,0xc1,0x75,0x40,0xb9,0x1c,0x6f,
+		0xa7,0x84,0x42,0xe9,0x06,0x71,0x45,0xe5,0x7c,0xbe,0x6f,0x70,0x07,0x8a,0xa1,0x08,0xd0,0xeb,0x8b,0x0b,
+		0x6a,0x36,0xe8,0x3e,0x89,0x79,0x66,0x3a,0x4e,0x63,0x81,0xc2,0x2a,0x2c,0x2f,0x36,0x2d,0x95,0x49,0x2a,
+		0xcc,0x51,0x68,0x3b,0xdc,0xac,0xba,0x34,0x29,0x83,0xc1,0x8c,0x60,0x15,0x93,0x55,0x00,0x35,0xad,0xe3,
+		0xad,0xef,0x59,0x50,0x78,0x9a,0xc3,0x8d,0x14,0x83,0xa3,0xd1,0x06,0x8f,0x2b,0xd2,0x2e,0x3d,0x3d,0x3d,
+		0xc5,0x39,0x42,0xd1,0xf2,0xa5,0x67,0xcd,0xcd,0x99,0x08,0xf6,0x8c,0x1d,0x02,0x6a,0xa8,0xbf,0x8e,0x8f,
+		0x0a,0xc8,0xf5,0x2d,0x5f,0x1c,0xe8,0x04,0x69,0x96,0xd1,0x8e,0x1c,0xf4,0xd5,0x94,0xb8,0x7b,0xd4,0x97,
+		0x76,0x58,0xaa,0x84,0xe6,0x67,0xf7,0x66,0x7f,0x55,0x07,0x2c,0xb5,0xa0,0x32,0x82,0x80,0x83,0xf4,0xde,
+		0xfc,0xf4,0xbc,0xf1,0xcf,0x4d,0x67,0xfc,0xb9,0xb9,0x10,0x70,0x72,0x20,0xe5,0xd5,0x29,0x94,0x5a,0xc7,
+		0x94,0x2a,0x93,0xa9,0x8e,0x55,0xee,0x44,0xf2,0x2b,0x36,0xb3,0x80,0x16,0x10,0x7b,0x57,0xb5,0x92,0x4e,
+		0xbd,0x4e,0xf6,0xdc,0xc7,0x74,0x5b,0xdd,0xc7,0xb9,0x5a,0x61,0xad,0x9e,0x4d,0xba,0xb2,0x56,0x15,0xad,
+		0x6a,0xd4,0x60,0x77,0xf6,0x42,0x40,0x7b,0x47,0x53,0x9f,0x55,0xfb,0xdf,0x93,0x1f,0xf3,0xed,0xca,0x1c,
+		0x4b,0x43,0x08,0x2a,0x73,0xba,0x75,0xd6,0x5c,0xa0,0x7a,0xff,0xdd,0xb2,0xe2,0x88,0x65,0x8a,0x49,0x9f,
+		0x40,0xd9,0xfd,0xe7,0x9f,0xa4,0x22,0xc4,0x8b,0x56,0xe7,0x65,0xbd,0xfe,0x0d,0xf6,0x8f,0x2e,0xf7,0xce,
+		0x02,0x34,0x1a,0x8d,0xbf,0x86,0xde,0x6a,0xdd,0xb2,0x5f,0xb0,0x56,0x0f,0xc2,0x32,0x9a,0x98,0x71,0x69,
+		0xdd,0xd4,0xad,0xdf,0xad,0x65,0xf1,0xfb,0xcb,0x64,0x40,0x7f,0xd1,0x9c,0x37,0x42,0x7f,0xff,0x94,0xb7,
+		0xe0,0xa7,0x7d,0x07,0xcc,0xff,0xd5,0xf5,0x7e,0x33,0x7b,0xac,0x19,0xc2,0x2f,0xfb,0x04,0x39,0x93,0xfe,
+		0x03,0x14,0x71,0x81,0x64,0xfe,0x80,0x66,0xd7,0x6b,0x7c,0x52,0xf4,0xc5,0x9a,0x98,0x83,0x69,0x40,0xcd,
+		0x23,0x1f,0x25,0x20,0x8c,0x87,0xfd,0x59,0xf1,0xcc,0x58,0x7d,0x59,0x9c,0x0d,0xfb,0xcd,0x78,0xe8,0x7c,
+		0x94,0x2b,0x82,0x17,0x35,0xac,0x71,0x44,0x54,0xc1,0xb8,0xc4,0x94,0x78,0xf6,0xe9,0x47,0x24,0xc4,0x94,
+		0x72,0xdc,0x27,0x5a,0x92,0xce,0x4f,0xad,0x70,0x44,0xd2,0xa5,0x08,0x12,0x0d,0xd7,0x24,0xe8,0x8c,0xf1,
+		0x62,0x00,0xdf,0xcc,0xdc,0x93,0xdd,0xfe,0x4c,0x91,0xe6,0xd0,0xb9,0x62,0x6b,0xb1,0xc0,0x0b,0x2d,0xe8,
+		0xb0,0x08,0xfc,0x86,0x2b,0x95,0xca,0xb0,0x20,0x41,0xfa,0x2a,0x43,0x02,0xc6,0x87,0x8d,0x9f,0x68,0x09,
+		0x2e,0xcd,0x57,0x41,0x40,0xf4,0xd6,0x85,0xdc,0x66,0xfe,0x95,0x3d,0x81,0x65,0x4f,0x76,0x03,0xda,0xa2,
+		0xc4,0xbc,0x7a,0xd9,0x57,0xd8,0x2e,0xbe,0x4f,0x9a,0xa7,0x56,0x85,0x1f,0x7e,0xb5,0xf3,0x25,0xf6,0x91,
+		0xa9,0xb9,0x54,0xf7,0x9b,0xda,0x37,0x90,0x21,0x79,0x16,0xcd,0x92,0xb8,0x67,0x05,0xcd,0x4c,0x53,0xd9,
+		0xbe,0x70,0x54,0x00,0x89,0x00,0xe6,0x8b,0x2a,0x05,0x0c,0x1d,0xd6,0xb8,0x97,0x81,0x4e,0x0e,0x2a,0xdd,
+		0x1f,0xd0,0x21,0x46,0xa7,0xca,0xb8,0xc1,0x64,0x1d,0x7d,0xf3,0x18,0x69,0x5f,0xf2,0xb2,0xd7,0x48,0x6a,
+		0x4c,0x66,0x45,0x06,0x25,0x26,0x83,0x0c,0x4c,0x55,0x81,0xb7,0x3b,0xe1,0x7d,0x19,0xd0,0x6d,0x95,0x4e,
+		0x09,0x5b,0x69,0x39,0x97,0xde,0x2a,0x01,0xee,0x88,0x35,0x5c,0x19,0x3c,0x67,0x28,0x7f,0x38,0x86,0xbb,
+		0x52,0x17,0x9f,0x8d,0x91,0x28,0xb8,0x4c,0x9c,0xdd,0x43,0x29,0xa5,0xe4,0x42,0xb1,0x30,0x84,0xee,0x6c,
+		0x61,0xea,0xbb,0x86,0xb2,0x99,0x03,0x56,0xf1,0x85,0x48,0x20,0x0c,0x4b,0xec,0xda,0x29,0xa0,0xd3,0x26,
+		0x03,0xd2,0xd2,0xbb,0x24,0x44,0xeb,0x53,0x2c,0xe2,0xbc,0x9e,0xb2,0x02,0x9d,0xdf,0x65,0xe5,0x18,0x7b,
+		0xb7,0xe6,0x9d,0xcd,0xd2,0x77,0x3b,0x1e,0x9d,0xa3,0xfb,0xb7,0xe3,0x37,0x25,0x1e,0xf1,0x24,0x19,0x95,
+		0x5f,0xe0,0xf6,0x32,0xc1,0x8f,0x08,0xf9,0xb1,0x57,0x1c,0x5a,0xc0,0xda,0xbe,0xcf,0x07,0x87,0x3f,0xcf,
+		0x8e,0xd4,0xdc,0x81,0xf3,0xc9,0xed,0xf8,0xec,0x8e,0xfc,0x76,0x3b,0xb9,0x1b,0x97,0x3c,0x28,0xea,0x94,
+		0x03,0x91,0x83,0x6b,0xe7,0xc9,0x20,0x89,0x59,0x34,0xa0,0x1d,0x04,0xe0,0xcf,0x2c,0xde,0x4c,0xa6,0xce,
+		0x57,0xb6,0xf4,0xa4,0x6e,0x5f,0xd4,0xc9,0xf6,0xf9,0xb8,0x83,0xaf,0xc7,0xc6,0x3a,0x6a,0x67,0xde,0xdb,
+		0x31,0x9a,0x66,0xa7,0x6d,0x37,0x9e,0xfd,0x62,0x64,0xa9,0xf8,0x1c,0xd8,0x91,0xb8,0xd0,0xee,0x52,0x87,
+		0x25,0x87,0x2b,0xa9,0x16,0xd8,0x08,0xa4,0x27,0x43,0x89,0xa9,0x81,0x64,0xf8,0x7e,0x93,0x0d,0x33,0x4b,
+		0xbb,0xf6,0xf0,0xd8,0x84,0x14,0xf6,0x0d,0x83,0x16,0xf5,0x4d,0x6b,0x22,0xf2,0xf9,0xe6,0x1b,0xb6,0x96,
+		0x32,0xe4,0xfb,0x16,0x9a,0x90,0x52,0xf1,0x0b,0x13,0xae,0xc9,0xbf,0xf8,0xdf,0x45,0x43,0xe7,0x3f,0xcc,
+		0x3b,0x28,0xb5,0x37,0x1a,0x00,0x00,
+	};
+
+	//throttle.htm 13842 bytes, minified 7904, gzip 2843
+	static const uint8_t asset_throttle_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x19,0x6b,0x53,0x1b,0x39,0xf2,0xbb,0x7f,0x85,
+		0xa2,0xaa,0x0d,0x76,0x01,0x63,0x9b,0x64,0xb3,0xc1,0xaf,0x14,0x1b,0x4c,0xe2,0x2b,0x12,0x38,0x4c,0x76,
+		0x6f,0x8f,0xe2,0xae,0xe4,0x19,0xd9,0x1e,0x32,0x2f,0x34,0xb2,0x0d,0xc7,0xf2,0xdf,0xaf,0xbb,0xa5,0x19,
+		0xcf,0xd8,0x03,0x61,0xaf,0xea,0x2a,0xb5,0x8b,0xd5,0xea,0xb7,0xfa,0x25,0x4d,0x6f,0xae,0xc3,0x80,0xdd,
+		0x85,0x41,0x94,0xf6,0xf9,0x5c,0xeb,0xa4,0xd3,0x6c,0xae,0x56,0x2b,0x67,0xf5,0xc6,0x89,0xd5,0xac,0xd9,
+		0x3e,0x3c,0x3c,0x6c,0xde,0x21,0x0e,0x1f,0xd4,0x7a,0x73,0x29,0x3c,0xf8,0x13,0x4a,0x2d,0x58,0x24,0x42,
+		0xd9,0xe7,0x4b,0x5f,0xae,0x92,0x58,0x69,0xce,0xdc,0x38,0xd2,0x32,0xd2,0x7d,0xbe,0xf2,0x3d,0x3d,0xef,
+		0x7b,0x72,0xe9,0xbb,0x72,0x9f,0x16,0x7b,0xcc,0x8f,0x7c,0xed,0x8b,0x60,0x3f,0x75,0x45,0x20,0xfb,0x6d,
+		0xa7,0x85,0xdc,0xb4,0xaf,0x03,0x39,0x38,0xfe,0xf8,0x91,0x0d,0xc7,0xe7,0x44,0xaf,0xe2,0x20,0x90,0x8a,
+		0xed,0xb3,0xcb,0xb9,0x8a,0x35,0xec,0xf6,0x9a,0x06,0xa9,0xd6,0x4b,0xf5,0x3d,0xfe,0x75,0xe2,0x85,0x06,
+		0x8c,0x87,0xda,0x24,0x56,0x9e,0x54,0x1d,0x96,0xc6,0x81,0xef,0x75,0xed,0xd2,0x88,0xeb,0xb0,0x76,0x72,
+		0xd7,0xad,0x25,0xc2,0xf3,0xfc,0x68,0xb6,0x1f,0xc8,0xa9,0xee,0xb0,0x83,0xe5,0xaa,0x5b,0x7b,0xac,0x39,
+		0x5a,0xf9,0x09,0x92,0x0b,0xf7,0xfb,0x4c,0xc5,0x8b,0xc8,0xdb,0x77,0xe3,0x20,0x06,0x46,0xb1,0x12,0xd1,
+		0x4c,0x2a,0xe9,0x11,0x5a,0x1c,0x55,0x22,0x05,0xfe,0x6c,0xae,0x67,0x4a,0xca,0x88,0xb0,0xa6,0xd1,0xd9,
+		0x4b,0xf0,0xfc,0x28,0x59,0xe8,0x2b,0x7d,0x9f,0xc8,0xbe,0x96,0x77,0xfa,0x1a,0x48,0xa6,0x60,0xed,0x7e,
+		0xea,0xff,0x47,0x76,0xd8,0xdb,0x65,0xe8,0x03,0x9a,0x55,0xfd,0xa0,0x85,0x8a,0x5a,0xdd,0x3b,0xac,0x95,
+		0xdc,0xe1,0x7f,0xdd,0x5a,0x28,0xd4,0xcc,0x8f,0x2c,0x00,0xed,0xbd,0x43,0x72,0xc2,0xb1,0xb6,0x03,0x68,
+		0x43,0xd8,0x64,0xa1,0x75,0x1c,0xa1,0x38,0xcb,0xfc,0x2d,0x31,0xdf,0x96,0x5d,0xa2,0x22,0x3f,0x14,0x88,
+		0xde,0xb7,0xac,0xeb,0xa6,0xd1,0x1a,0xd8,0x7e,0xbb,0x5c,0xb1,0x57,0x7e,0x88,0x67,0x2f,0x22,0x5d,0x62,
+		0xfa,0xc6,0xf9,0x19,0xd9,0x96,0xb6,0x1f,0x6b,0xa9,0x0c,0xa4,0xab,0xf7,0x58,0x9c,0x68,0x3f,0x8e,0x5e,
+		0xa2,0xd3,0xaf,0x67,0xc7,0x7f,0x00,0xde,0xc9,0xd9,0xd7,0xcb,0xfd,0xf1,0xe8,0x9f,0xc3,0x7c,0x8b,0x20,
+		0x27,0x47,0x5f,0x46,0xa7,0x7f,0x74,0xd8,0x6f,0x52,0x79,0x22,0x12,0x7b,0xec,0x48,0x41,0x84,0xed,0xb1,
+		0xcf,0x32,0x58,0x4a,0xed,0xbb,0x00,0x49,0x45,0x94,0xee,0xa7,0x52,0xf9,0x53,0xe0,0x96,0x54,0x7a,0xfd,
+		0xb1,0xa6,0xc5,0x24,0x90,0x4f,0xec,0xf5,0x9a,0x36,0xec,0x7a,0xa9,0x0b,0x71,0xa3,0x19,0x39,0x88,0xe3,
+		0x21,0x36,0x6f,0xc4,0x52,0x18,0x28,0xc4,0xf2,0x52,0x28,0xb6,0x4a,0xbf,0x29,0x9f,0xf5,0x19,0x5f,0xa5,
+		0x90,0x43,0xed,0xc3,0x03,0xa7,0xfd,0xee,0xbd,0xf3,0xce,0x69,0x77,0xda,0x07,0xad,0xf7,0xad,0x26,0xef,
+		0x12,0xda,0x5c,0x28,0x6f,0x25,0x94,0x04,0xcc,0x07,0xc6,0x91,0x21,0xef,0x30,0xee,0xb9,0xee,0xb7,0x11,
+		0xdf,0x63,0xdc,0x0d,0x3d,0x5c,0x67,0x58,0x08,0x1a,0x8f,0x47,0xc7,0x08,0x83,0x4c,0xf9,0x77,0xeb,0x00,
+		0x21,0xa3,0x73,0x5c,0x67,0x22,0x7e,0x71,0xda,0x08,0xfc,0x72,0xf4,0x11,0xa1,0xf8,0x33,0x59,0x79,0xd9,
+		0xcf,0x55,0x7a,0x8e,0xe9,0x09,0x27,0x86,0x4a,0x20,0xc0,0x5f,0x03,0x0e,0x11,0xb0,0x94,0x2a,0x85,0x13,
+		0x01,0x08,0xae,0x84,0xab,0xcd,0x82,0x27,0x90,0x8c,0x9c,0x3d,0x1a,0xad,0x83,0xd8,0x8d,0x8d,0xc6,0x22,
+		0xe3,0xbc,0xb4,0x14,0x0a,0x79,0xc1,0xdf,0xa9,0x5d,0xcf,0x65,0x80,0xd2,0xa7,0x22,0x48,0x65,0x46,0x9e,
+		0xc4,0x2b,0xc8,0x5a,0xa2,0xcf,0x25,0x61,0x26,0xe2,0xcf,0x0c,0xc7,0x8f,0x20,0x82,0x01,0xe7,0xea,0xda,
+		0xac,0xa7,0x0a,0x2a,0xcc,0xb9,0x8c,0x30,0x11,0x00,0x4c,0xfc,0xcc,0x4e,0x9a,0x48,0xe9,0xad,0x77,0xa2,
+		0x45,0x10,0x14,0x36,0x4e,0x90,0xae,0x4c,0xe0,0x29,0x31,0x9b,0x6d,0xb1,0x11,0x5a,0xcb,0x30,0xd1,0x29,
+		0x40,0x5b,0x06,0xb2,0x92,0x93,0x34,0x76,0xbf,0x4b,0x5d,0xe2,0x3a,0x9f,0x5c,0xfa,0x21,0xa9,0x6f,0x60,
+		0xd3,0x45,0x44,0x4e,0x82,0xc4,0x8b,0x75,0xbd,0x81,0x05,0x60,0xe1,0x07,0xde,0x89,0x05,0xa7,0xf5,0x46,
+		0xb7,0xe6,0x4f,0x59,0x3d,0xe7,0x3f,0x60,0xed,0x16,0xa0,0x31,0x25,0xf5,0x42,0x45,0x5d,0xf6,0x58,0xcb,
+		0xb6,0x76,0x77,0xb7,0x50,0x0f,0x90,0x21,0xd6,0xcb,0xdf,0x33,0x65,0x90,0xdf,0x23,0x93,0xe8,0xce,0x87,
+		0x1a,0x96,0xe8,0x4f,0x00,0xe3,0xcd,0x2c,0x44,0x3e,0x4c,0x7d,0xf0,0x78,0xda,0x1f,0x9d,0xef,0xd9,0xc3,
+		0x06,0xfc,0x54,0x6a,0x54,0x1a,0xaa,0x65,0x3d,0x57,0x17,0x55,0xb5,0x3a,0x83,0x0e,0x7b,0xec,0x4d,0xab,
+		0xd5,0x42,0xd6,0xf0,0x2f,0xc7,0xc9,0xd8,0xeb,0xb9,0xfc,0xa6,0x02,0x54,0x05,0x5a,0x03,0x02,0xd1,0x7a,
+		0xb9,0x62,0xff,0xf8,0x72,0xfa,0x19,0x56,0x17,0xf2,0x76,0x21,0x53,0xd2,0xcc,0xee,0x43,0xc5,0x54,0xd0,
+		0x1d,0xee,0x53,0x2d,0xb4,0x74,0xe7,0x58,0x43,0xd0,0xdb,0x45,0xd9,0x35,0xad,0xee,0xd1,0x36,0xb0,0x37,
+		0x23,0x22,0x92,0x31,0x92,0xb0,0x7e,0x9f,0xbd,0x65,0xaf,0x5f,0xb3,0x6c,0x0b,0x19,0x2d,0x52,0x04,0x1f,
+		0xb4,0xd0,0x7b,0x74,0x14,0xe1,0xfd,0xd9,0xe4,0x06,0xf8,0xfe,0x6d,0x7c,0xf6,0xd5,0x49,0x84,0x4a,0x65,
+		0x81,0x55,0x9a,0x80,0xf3,0xe5,0x25,0x24,0xa7,0x3d,0x80,0x57,0x84,0xee,0x60,0x8e,0x35,0x32,0xe7,0xd3,
+		0xc6,0x1a,0xce,0x5e,0xf5,0xb3,0xe4,0x5b,0xa3,0x14,0x52,0x94,0x30,0xa1,0x38,0x97,0x72,0x9b,0xb3,0xdd,
+		0x3c,0x8d,0x9d,0xd1,0x39,0xac,0x78,0xa7,0x04,0x33,0xe7,0x40,0xa2,0xa0,0xad,0x41,0x8b,0x02,0xf9,0xf6,
+		0x87,0x13,0xc4,0xb3,0x3a,0xb1,0x43,0x25,0xb7,0x8e,0x19,0xfe,0xb9,0x42,0xbb,0x73,0x56,0x97,0x0d,0xeb,
+		0xab,0x4a,0x0e,0xd2,0x09,0x65,0x9a,0x8a,0x99,0xb4,0x44,0xf9,0x29,0x24,0x32,0xaa,0xf3,0x4f,0xc3,0x4b,
+		0xc8,0x50,0x73,0x86,0xf0,0x57,0x2d,0x64,0xe1,0xa0,0x52,0x48,0x1c,0x23,0x2b,0x3f,0x9d,0x0d,0x3d,0x36,
+		0x05,0x3f,0x94,0x44,0xf3,0x12,0x36,0xb8,0x0d,0xf2,0xb7,0x90,0x4a,0x6d,0xc8,0xa5,0x52,0x1e,0x41,0xd4,
+		0x00,0xf6,0xd8,0xf0,0xce,0x2c,0xcf,0x31,0x20,0x6e,0x50,0xe7,0x52,0xac,0xc8,0xa5,0x46,0xa1,0x71,0x74,
+		0x86,0xd6,0xd0,0xea,0xb1,0x4c,0xe2,0x06,0x71,0x2a,0xab,0x69,0x3e,0xe2,0x56,0x25,0x91,0xf5,0x58,0x35,
+		0xd9,0x17,0xb3,0x59,0x49,0x28,0x95,0x8a,0x55,0x35,0xd9,0x10,0xb7,0x72,0xa2,0x82,0x4b,0x8b,0xca,0x3f,
+		0x14,0xb8,0x91,0xf7,0x29,0x7c,0x53,0x28,0x80,0xd1,0xcc,0x9f,0xde,0xd7,0x9f,0xe9,0x03,0xe9,0x62,0x82,
+		0x4d,0x66,0x42,0x8d,0x40,0xc7,0x89,0xef,0xa6,0x00,0xbe,0xba,0x66,0x8f,0x0d,0x1b,0xe4,0x95,0xe1,0xc1,
+		0xd7,0x27,0x80,0xde,0x35,0x15,0x01,0x04,0x83,0x24,0x97,0xda,0x8b,0x0c,0x82,0x18,0x8a,0xbb,0xe5,0x61,
+		0x2b,0x1c,0xf0,0x08,0xa4,0x50,0x23,0x18,0xe4,0xd4,0x52,0x04,0x39,0x18,0x32,0x22,0x2f,0x81,0x50,0x58,
+		0xf2,0xfd,0x72,0x65,0x29,0x0b,0x98,0x10,0x77,0x2c,0x33,0x07,0x59,0x99,0x29,0xf8,0xa6,0x70,0x48,0x0f,
+		0x2f,0xb2,0x82,0x0e,0x9c,0xff,0x75,0x75,0x4d,0xc5,0x0e,0xd3,0x99,0xe3,0x47,0x70,0x8e,0x9f,0x2f,0xbf,
+		0x9c,0x62,0x1a,0x7b,0x7e,0x0a,0x82,0x22,0x18,0x48,0xa4,0xc7,0x37,0x74,0x2b,0x1c,0xe9,0xcb,0x74,0xa3,
+		0xf0,0xe0,0x65,0x13,0xc9,0x19,0xf1,0xe4,0x26,0xe3,0xf1,0x6a,0x8d,0xfe,0xe7,0x9f,0xeb,0x3e,0x53,0x2c,
+		0x80,0x50,0x89,0xda,0xeb,0x1a,0x14,0x67,0x05,0x0a,0xb4,0xbd,0xd1,0xbc,0xfb,0x83,0x10,0x42,0x51,0x9b,
+		0x4e,0x2e,0x85,0x74,0x56,0x7d,0xa9,0x8a,0x96,0x2b,0x28,0xec,0x3b,0x9e,0xd0,0xc2,0x7a,0x37,0x5c,0x17,
+		0xc6,0x1b,0x5d,0xa8,0x8a,0xd4,0x9f,0x9d,0x64,0x91,0xce,0xeb,0x61,0x56,0x60,0x8b,0x3d,0x1a,0x65,0x6c,
+		0xf4,0x6c,0xac,0x3c,0x38,0xd9,0x46,0x5e,0xbc,0x02,0x53,0xa9,0x67,0x1c,0x45,0x7e,0x28,0x50,0x43,0xea,
+		0xd3,0x75,0x05,0xc8,0x74,0x66,0xff,0x73,0xe9,0xcb,0x2d,0x36,0xac,0xea,0x15,0x7a,0x14,0x9a,0xfe,0x2d,
+		0x2c,0xc9,0x12,0x6b,0x90,0x1d,0x38,0xa6,0x90,0xe0,0x75,0x9a,0x42,0x68,0x1a,0x80,0x3f,0x3d,0x76,0xeb,
+		0x04,0x32,0x9a,0xe9,0x39,0xac,0x76,0x77,0x1b,0x4c,0x24,0x49,0x70,0x5f,0xbf,0xbd,0xf2,0xaf,0x41,0xb0,
+		0x92,0x89,0xf0,0x23,0xfd,0x6d,0xb4,0x51,0x49,0x0d,0x52,0x88,0x3a,0xa4,0x2b,0x9f,0xac,0x09,0x1d,0x17,
+		0x97,0xae,0x80,0x8a,0xc5,0x55,0x9c,0x42,0xb4,0xf2,0x8e,0x19,0x2c,0xf0,0xea,0x05,0x3d,0xc6,0x89,0xd9,
+		0x07,0x88,0x98,0xe0,0x82,0x36,0x0b,0x91,0x8a,0x93,0x56,0xb5,0x6e,0xa1,0x13,0x94,0xb5,0xc3,0xc9,0x00,
+		0xb8,0xed,0xc2,0xa9,0xf5,0xec,0x88,0x0d,0x39,0xb1,0x90,0xfd,0x1d,0xec,0x4c,0x80,0x0e,0x7a,0x5f,0xb5,
+		0xae,0xb1,0x57,0xed,0x0c,0xb6,0x40,0xac,0x00,0x69,0x13,0xa4,0xd7,0x34,0x5c,0x06,0xdc,0x0e,0xef,0x5b,
+		0xca,0xf5,0x49,0x7f,0xb8,0x8a,0x40,0x0c,0x7f,0xef,0x5a,0xfb,0x84,0x7b,0x0b,0xc6,0xe1,0xb4,0xe8,0x08,
+		0x32,0x4d,0x74,0xcd,0x0a,0xa7,0xc2,0x3c,0x22,0xb6,0xf2,0x11,0xc8,0x16,0x3e,0xdc,0xbd,0xac,0x1e,0x62,
+		0x83,0xab,0x92,0x01,0x70,0x35,0xc1,0x29,0x30,0x32,0x8d,0x80,0x06,0xb3,0x58,0x9b,0xfc,0xd6,0x12,0x3f,
+		0x10,0xb1,0x04,0x2e,0x39,0x6f,0xf0,0x6a,0x09,0xbf,0xac,0xa0,0x0d,0x95,0x92,0x78,0x30,0x5c,0x64,0x0a,
+		0x40,0x24,0x4e,0x7d,0x15,0x92,0x22,0xe8,0x38,0x3f,0x85,0x70,0x62,0x0b,0x40,0xc3,0xd3,0x8f,0x62,0x68,
+		0xba,0x0a,0x3a,0xaf,0xb9,0xbe,0x3a,0x8c,0x8d,0x91,0x96,0xf9,0xfa,0x03,0x6f,0x50,0x50,0x14,0x8b,0x24,
+		0x3a,0x6b,0xcf,0x4c,0xd4,0xc0,0x6e,0x2f,0x17,0xc4,0xda,0x54,0x99,0xf3,0x99,0x6f,0xd3,0xbc,0x4c,0x36,
+		0x48,0x63,0x99,0xe7,0xe8,0x98,0x4a,0x5a,0x27,0x2b,0x50,0x99,0x06,0x6f,0xbc,0xcd,0x52,0x98,0x41,0x16,
+		0x1b,0x00,0xdd,0x82,0x11,0x84,0x3f,0x36,0xad,0x05,0xb2,0x3c,0xe4,0x6e,0x4c,0xc8,0xdd,0x6c,0x84,0xdc,
+		0x8d,0x09,0x39,0x9a,0xb9,0x89,0x4f,0x70,0x75,0x73,0x6d,0x6a,0x42,0x5a,0x3e,0x21,0xbc,0xd6,0xfb,0x11,
+		0x1e,0x3a,0x41,0x96,0xd8,0x42,0x9c,0xa5,0x5d,0x51,0x43,0x71,0x94,0x5d,0x4d,0x69,0x35,0x2d,0x18,0xb2,
+		0x91,0xde,0x79,0xca,0x81,0xe8,0x60,0x12,0x9c,0x22,0xd1,0x53,0xc7,0x6e,0x43,0x10,0xbc,0x1c,0x41,0x03,
+		0x07,0xef,0x4c,0x74,0x74,0xe4,0xde,0x3a,0x94,0x14,0x9b,0x21,0x72,0x31,0x3c,0x1d,0x1e,0x8d,0x87,0x1c,
+		0xd1,0x8f,0x3e,0xfe,0xfd,0xdb,0xe8,0x62,0xc8,0x6d,0x85,0xcb,0xae,0x0e,0x0d,0x96,0x06,0x63,0xbc,0x5e,
+		0x94,0x39,0xa0,0x25,0x13,0xbb,0xb1,0xa5,0xca,0x92,0xa4,0x1e,0xfb,0xaa,0x4c,0xa3,0x50,0xe4,0xc9,0xd9,
+		0xc5,0xef,0x47,0x17,0xc7,0x24,0xf2,0x62,0xf8,0xdb,0xf0,0x62,0x3c,0xac,0x4e,0x75,0x98,0x7f,0xdf,0xe7,
+		0x39,0x8e,0x5b,0x13,0xd8,0xf2,0x62,0x77,0x11,0xca,0x48,0x3b,0x33,0xa9,0x87,0x81,0xc4,0x9f,0xbf,0xde,
+		0x8f,0xbc,0x3a,0x3f,0xc1,0x20,0xc7,0x01,0x6b,0xe2,0xb8,0x81,0x48,0xd3,0xaf,0xe6,0x2e,0x54,0xb7,0x0e,
+		0x7e,0xcd,0xea,0x6d,0xd6,0xeb,0x01,0x46,0x03,0x95,0x80,0x1b,0x3d,0x3e,0x61,0x90,0x12,0xd3,0x88,0x42,
+		0x08,0x8d,0x5e,0xc7,0x08,0x5d,0x6e,0x74,0x74,0xbe,0x52,0x25,0x76,0xe6,0xee,0xd6,0xcd,0xb6,0x32,0xeb,
+		0xf8,0xe5,0xc5,0xe8,0xfc,0x7c,0x78,0xcc,0x0b,0xb1,0x5b,0x41,0x9d,0xc7,0xe4,0x07,0xba,0x0d,0xa2,0xf0,
+		0x78,0x3a,0xdd,0x66,0x57,0xc4,0x3b,0xfb,0x4a,0x78,0x67,0x27,0x27,0x7c,0x23,0x2c,0x36,0xef,0x5e,0xd6,
+		0x4b,0xb6,0xb6,0xf2,0x17,0x38,0x75,0x5d,0x38,0xe9,0x15,0xc4,0x5c,0xf2,0x77,0xcc,0xe3,0xc9,0x0e,0x23,
+		0xcd,0xfb,0x3b,0x53,0xf8,0xe9,0x7b,0xfd,0x1d,0xe3,0x60,0x2a,0xa3,0x59,0x81,0x2d,0x82,0x70,0x34,0xf5,
+		0xdd,0xef,0xfd,0x1d,0x98,0x93,0x32,0xa5,0xea,0xf9,0x7e,0x63,0x87,0x35,0x07,0x36,0xb2,0x7c,0xf6,0x13,
+		0x7b,0x87,0xd7,0x9b,0x9f,0x1b,0x6c,0xad,0xc1,0x44,0x19,0x0c,0x30,0x30,0xfa,0xa4,0x7c,0xaf,0xa2,0xde,
+		0x16,0xbb,0x8d,0xe7,0xc1,0xb5,0x27,0x3d,0x51,0x71,0x68,0xd3,0x82,0xee,0xb5,0x80,0x8a,0x3b,0xc6,0x91,
+		0xd0,0x77,0x93,0x40,0xb8,0xb2,0xde,0xbc,0xfa,0x57,0x6b,0xff,0xf0,0xba,0x39,0x83,0x42,0x93,0x4d,0x52,
+		0x94,0xaa,0xb0,0xb2,0xfd,0x56,0xa0,0x3e,0x2d,0x9c,0x50,0x04,0x5d,0x5a,0x0f,0xde,0x1c,0x66,0xfd,0x9f,
+		0x3c,0x69,0x7f,0xd6,0xeb,0xd0,0x0f,0xc6,0xa7,0xd9,0x41,0x01,0x87,0x74,0x4e,0x6f,0x80,0x70,0x7d,0x13,
+		0xe8,0xdc,0xf6,0xc1,0x2f,0x14,0x5f,0x63,0x3a,0xb4,0x53,0xe0,0xbf,0xcb,0x04,0x6a,0x6e,0x19,0xac,0xdb,
+		0x09,0xb1,0x28,0xdb,0x64,0x0a,0x5a,0x7e,0x0b,0xc9,0x13,0x75,0xab,0x7c,0x62,0x57,0xb0,0xe5,0xd3,0x66,
+		0xfb,0x63,0x23,0xd3,0x11,0x59,0x16,0x7d,0x51,0xf0,0x52,0x77,0x6d,0x2a,0x2f,0x8c,0x37,0x4f,0x55,0x66,
+		0xc3,0xb5,0x34,0xda,0x69,0xca,0xf7,0xfa,0x32,0x1f,0xee,0x0a,0x3a,0x66,0xec,0xf2,0x6a,0xf7,0x54,0x85,
+		0x00,0xf8,0xc6,0x3b,0xc6,0xd2,0x16,0xd0,0xfc,0x11,0xa3,0xa0,0x5c,0xf1,0x61,0xe3,0x05,0x53,0x55,0xf9,
+		0xde,0x5d,0xf5,0x2c,0x92,0x4b,0xca,0xe5,0xf7,0xcd,0xb4,0xfc,0x84,0x47,0x96,0x65,0x57,0xdb,0xf7,0x9f,
+		0x12,0x07,0xf4,0x53,0xe5,0xd3,0x4c,0x85,0x03,0xe1,0x2a,0x53,0x7f,0xce,0x7d,0x95,0x7c,0x5e,0xa0,0x50,
+		0xab,0xe2,0xb4,0x86,0xe9,0xff,0x4b,0xda,0x7e,0xbb,0x42,0x1c,0xd4,0x7b,0x69,0xf2,0xfe,0x59,0x91,0xa5,
+		0x48,0xde,0xe2,0xee,0x65,0x0b,0x6c,0x16,0x2d,0x96,0x8f,0x04,0x25,0x49,0x79,0x81,0x89,0x5e,0x2c,0x69,
+		0xba,0x25,0x09,0x9f,0xe3,0xa2,0x0a,0xe6,0x97,0x4a,0xb8,0xdf,0xeb,0x5b,0x49,0x07,0x53,0xc5,0x9e,0x7d,
+		0xc4,0x2b,0xf4,0x09,0x2c,0x19,0xaf,0xb2,0x7a,0x8d,0xa9,0xdf,0x66,0x55,0x67,0x01,0xe7,0x70,0x14,0x04,
+		0xeb,0x98,0x7c,0xd6,0xe5,0x88,0xcd,0x2d,0x8b,0x5e,0xd3,0x3c,0xb5,0x0e,0xe0,0x97,0xfd,0x08,0x31,0x89,
+		0xbd,0x7b,0x28,0xb7,0x41,0x2c,0xbc,0x3e,0x37,0xaf,0x5a,0xf8,0x51,0xc1,0xf3,0x97,0xb6,0x64,0x73,0xfa,
+		0x54,0x80,0xb0,0x64,0xd0,0x9b,0xe4,0xdf,0x19,0xd6,0x9f,0x16,0x26,0x83,0x5e,0x33,0xc1,0xef,0x10,0xf4,
+		0x02,0x6c,0x5e,0xd1,0xfb,0xbc,0xc5,0x19,0x3d,0xfa,0xda,0x0f,0x19,0x9d,0x76,0xab,0xf5,0x13,0x7d,0xad,
+		0x50,0xf8,0x3f,0xaf,0xbc,0xf9,0x16,0xf7,0xd8,0x98,0x9e,0xaa,0x7a,0x4d,0xed,0x19,0x14,0xe8,0x13,0x1c,
+		0x66,0x36,0xd8,0x79,0x1d,0x4d,0xd2,0xa4,0x6b,0x77,0x9a,0x86,0x85,0x1a,0x30,0x40,0x1a,0x30,0x72,0xb0,
+		0x7d,0x19,0xf5,0x0d,0xb5,0xd9,0x28,0xb6,0x21,0x6e,0xda,0x10,0x27,0x9e,0xa6,0x3f,0x72,0xdb,0x77,0xa8,
+		0x19,0xe6,0x0d,0x87,0xaf,0x8f,0x8c,0x43,0x0b,0x61,0x96,0x5f,0x2e,0xb3,0x46,0xac,0x4d,0xd5,0xcd,0x35,
+		0x1d,0xf4,0xcc,0xab,0x3c,0x71,0xcf,0x8b,0x32,0x07,0xbf,0x18,0xf8,0x60,0x53,0x73,0xc3,0x05,0xfa,0x29,
+		0xd6,0xd4,0x02,0x1b,0xa3,0x31,0x72,0xc1,0x0d,0x5e,0x78,0x27,0x47,0x65,0x36,0xa4,0x8c,0x4f,0x37,0x5c,
+		0x8c,0xdf,0x3c,0x40,0xa8,0xbd,0x70,0x50,0x2f,0xc9,0xaf,0x1f,0x19,0x34,0x88,0xa3,0xd9,0x1a,0xf8,0xbc,
+		0x7e,0x38,0x18,0xb2,0x5e,0x9a,0x88,0x88,0x44,0xda,0x51,0x91,0x0f,0x70,0x12,0x04,0x52,0x80,0x0f,0xb6,
+		0x74,0xaf,0xf4,0x36,0x0c,0x8c,0xb9,0xb7,0xb3,0xb9,0x70,0xed,0xf1,0xbc,0x53,0x91,0x8d,0x15,0x9a,0xc0,
+		0xf0,0x1b,0xa0,0xb4,0x3e,0x3f,0xc8,0x2d,0xce,0xbe,0x4a,0x41,0x70,0x77,0xf0,0x9b,0x14,0x86,0x56,0x51,
+		0x03,0xfa,0xfa,0x62,0x14,0xb0,0x03,0x27,0x67,0xa1,0x1f,0x51,0x5c,0x86,0xe2,0xae,0xcf,0xdb,0x07,0xef,
+		0x72,0x9d,0x5a,0xbc,0x16,0x47,0x44,0xdd,0xe7,0x85,0x37,0x6e,0x6a,0x10,0xeb,0x3e,0x45,0xb7,0xfc,0x51,
+		0x84,0x8f,0xba,0x7e,0x6a,0x3a,0x6e,0xa3,0x81,0x94,0xe6,0x99,0xb6,0x44,0x6a,0xba,0xc3,0x8f,0x68,0xc1,
+		0xde,0x5a,0xb5,0xeb,0x89,0xaa,0xec,0x7b,0x63,0xc4,0xa0,0xf5,0x97,0x3c,0x0f,0x45,0x34,0xb7,0x32,0x1f,
+		0x95,0x8b,0xb1,0x5e,0xa8,0xb2,0x4f,0xb9,0xbf,0x5a,0x80,0x65,0x3a,0xbe,0x3c,0x3b,0x2f,0x73,0x34,0x3d,
+		0xa9,0xc0,0xec,0x07,0x1c,0x86,0xdb,0x2c,0x6c,0xa7,0xa9,0x52,0x68,0x33,0x1c,0xd0,0x4e,0x33,0xe2,0x3d,
+		0x13,0x1a,0x26,0x8b,0x9f,0x66,0xf2,0x24,0xe1,0x8f,0x2c,0x67,0x47,0xa7,0xa7,0x45,0xd5,0xb3,0xc2,0x9c,
+		0x6b,0x6e,0x65,0x36,0xa9,0x36,0x62,0xb5,0x55,0x74,0xe6,0xf6,0x8f,0x60,0x73,0x25,0xa7,0x7d,0xfb,0x9a,
+		0xe1,0xc0,0x5c,0xca,0x07,0xd8,0x50,0xc2,0x58,0xfb,0x4b,0xc9,0x94,0xad,0x32,0x62,0x60,0x08,0x36,0xc9,
+		0xb0,0x2f,0x41,0x71,0x36,0x74,0x76,0xf1,0x43,0x22,0x18,0x77,0xe4,0x9d,0x21,0x99,0xc7,0xa1,0xdc,0x46,
+		0x6c,0x42,0xe9,0xc7,0x3f,0xd8,0x18,0xa8,0x4f,0xc0,0xb4,0x3c,0xa8,0xfd,0x17,0xda,0xd7,0x8f,0x2d,0xe0,
+		0x1e,0x00,0x00,
+	};
+
+	//turnout.htm 14388 bytes, minified 7079, gzip 2287
+	static const uint8_t asset_turnout_htm[] PROGMEM = {
+		0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x19,0xfd,0x73,0xe2,0xb6,0xf2,0x77,0xff,0x15,
+		0xaa,0x66,0x7a,0x07,0x13,0x62,0x1b,0xf2,0x75,0xe1,0xab,0x93,0xcb,0xe5,0x7a,0xbc,0xb9,0x7c,0x4c,0x48,
+		0xda,0xeb,0xcb,0x64,0x3a,0xc2,0x16,0xa0,0xc6,0xd8,0x3e,0x59,0x40,0x78,0x6d,0xfe,0xf7,0xee,0x4a,0xb6,
+		0xb1,0x09,0x84,0x36,0x93,0xd7,0x9b,0xc6,0xf6,0x6a,0x77,0xb5,0xdf,0xbb,0x12,0xed,0xb1,0x9a,0x04,0xe4,
+		0x71,0x12,0x84,0x49,0x87,0x8e,0x95,0x8a,0x9b,0x8e,0x33,0x9f,0xcf,0xed,0xf9,0x9e,0x1d,0xc9,0x91,0x53,
+		0x3f,0x3e,0x3e,0x76,0x1e,0x11,0x87,0x76,0xad,0xf6,0x98,0x33,0x1f,0x1e,0x13,0xae,0x18,0x09,0xd9,0x84,
+		0x77,0xe8,0x4c,0xf0,0x79,0x1c,0x49,0x45,0x89,0x17,0x85,0x8a,0x87,0xaa,0x43,0xe7,0xc2,0x57,0xe3,0x8e,
+		0xcf,0x67,0xc2,0xe3,0xbb,0xfa,0xa3,0x46,0x44,0x28,0x94,0x60,0xc1,0x6e,0xe2,0xb1,0x80,0x77,0xea,0xb6,
+		0x8b,0xdc,0x94,0x50,0x01,0xef,0x7e,0x3a,0x3d,0x25,0x67,0xfd,0x2b,0x4d,0x2f,0xa3,0x20,0xe0,0x92,0xec,
+		0x12,0x35,0x95,0x61,0x34,0x55,0x44,0x46,0x89,0xe2,0xb2,0xed,0x18,0x54,0xab,0x9d,0xa8,0x05,0x3e,0x6d,
+		0x58,0x03,0xbc,0x3f,0xad,0x41,0x24,0x7d,0x2e,0x9b,0x24,0x89,0x02,0xe1,0xb7,0xd2,0x4f,0xb3,0x69,0x93,
+		0xd4,0xe3,0xc7,0x96,0x15,0x33,0xdf,0x17,0xe1,0x68,0x37,0xe0,0x43,0xd5,0x24,0x8d,0xd9,0xbc,0x65,0x3d,
+		0xa5,0xf4,0xdf,0x80,0x81,0x2f,0x92,0x38,0x60,0x8b,0x26,0x19,0x06,0x1c,0xb0,0xf1,0xef,0xae,0x2f,0x24,
+		0xf7,0x94,0x88,0xc2,0x26,0x08,0x15,0x4c,0x27,0x21,0x30,0x66,0xde,0xc3,0x48,0x46,0xd3,0xd0,0x6f,0x92,
+		0x30,0x0a,0x79,0xcb,0x1a,0x73,0x31,0x1a,0x03,0xc7,0xba,0xeb,0xfe,0xa8,0x59,0x2a,0x29,0x62,0x94,0x28,
+		0xc7,0xdc,0x05,0xe2,0x08,0x64,0x8b,0x24,0x0b,0x47,0x5c,0x72,0xdf,0xec,0x1c,0xae,0x45,0x0a,0x90,0xdb,
+		0x48,0x72,0x1e,0x6a,0x2c,0x11,0xde,0x26,0xfc,0x25,0x44,0xb6,0xd0,0x78,0x61,0x34,0x11,0x21,0x0b,0x00,
+		0x73,0x26,0x12,0x31,0x10,0x81,0x50,0xa0,0xcb,0x58,0xf8,0xbe,0x61,0x24,0xc2,0x78,0xaa,0xee,0xd4,0x22,
+		0xe6,0x1d,0xc5,0x1f,0xd5,0x7d,0x8d,0xd8,0x60,0x0f,0xc9,0x93,0x04,0x48,0x86,0x60,0xf1,0xdd,0x44,0xfc,
+		0x8f,0x37,0xc9,0xfe,0x0c,0xf8,0xb4,0xac,0xd4,0x70,0x0d,0x17,0xcd,0x94,0x5a,0xae,0x49,0xdc,0xf8,0x11,
+		0xff,0x6f,0x59,0x13,0x26,0x47,0x22,0x4c,0x01,0x68,0xed,0x47,0x24,0xd7,0x38,0xa9,0xe5,0x01,0xb4,0xb2,
+		0xed,0x60,0xaa,0x54,0x14,0xde,0xc3,0x76,0x25,0xe6,0xcf,0xf7,0x2e,0x51,0x79,0x63,0xee,0x3d,0x00,0x33,
+		0xa4,0x53,0x60,0xbf,0x64,0x18,0xc9,0x09,0xb8,0x19,0xc3,0xa7,0xd2,0xa8,0x22,0xf6,0xc7,0xcb,0x4f,0xbf,
+		0xc1,0xea,0xe7,0xcb,0x8b,0x9b,0xdd,0x7e,0xef,0xbf,0x67,0x39,0x23,0x0d,0xf9,0x7c,0x72,0xde,0xfb,0xfa,
+		0x5b,0x93,0xfc,0xc2,0xa5,0xcf,0x42,0x56,0x23,0x27,0x12,0xe2,0xaf,0x46,0xbe,0xf0,0x60,0xc6,0x95,0xf0,
+		0x00,0x92,0x00,0xdb,0xdd,0x84,0x4b,0x31,0x04,0x6e,0xf1,0x5a,0x7b,0x3c,0x59,0x8a,0x0d,0x02,0xbe,0x61,
+		0xad,0xed,0xa4,0xe1,0xd8,0x4e,0x3c,0x70,0xbe,0x22,0x5a,0x74,0x8a,0x86,0x76,0xfe,0x60,0x33,0x66,0xa0,
+		0x10,0xe9,0x10,0xda,0x89,0x22,0xe7,0x27,0xdf,0x7e,0xbf,0xbe,0xfc,0xb5,0x4f,0x3a,0xe4,0x43,0xcb,0x9a,
+		0x31,0x49,0xe6,0xc9,0xad,0x14,0xf0,0x49,0xe7,0x09,0x64,0x5d,0xfd,0xb8,0x61,0xd7,0x0f,0x3f,0xd8,0x87,
+		0x76,0xbd,0x59,0x6f,0xb8,0x1f,0x5c,0x87,0x1a,0xb4,0x31,0x93,0xfe,0x9c,0x49,0x0e,0x98,0x7f,0x12,0x8a,
+		0x9b,0xd0,0x26,0xa1,0xbe,0xe7,0xdd,0xf6,0x68,0x8d,0x50,0x6f,0xe2,0xe3,0x77,0x86,0x85,0xa0,0x7e,0xbf,
+		0xf7,0x09,0x61,0x90,0x5b,0xbf,0xbb,0x0d,0x84,0xf4,0xae,0xf0,0x3b,0xdb,0xe2,0xc8,0xae,0x23,0xf0,0xfc,
+		0xe4,0x94,0x36,0xa9,0xe4,0x98,0x6d,0x24,0x1a,0x12,0x35,0xd6,0xd4,0xf1,0x5c,0x33,0xc4,0xd7,0x79,0x72,
+		0x85,0xc9,0x0d,0x61,0x8e,0x02,0x21,0x40,0x2c,0x01,0xc7,0x08,0x60,0x3a,0x53,0x10,0x3f,0x86,0xe4,0xa5,
+		0xe4,0xc9,0xc8,0x6c,0x12,0x17,0x25,0xde,0x28,0x70,0x9a,0xe3,0x08,0x49,0x5f,0x13,0x00,0xdf,0xdd,0x97,
+		0x38,0xf4,0xf9,0x77,0x60,0xb2,0x5b,0x37,0x30,0xa6,0x14,0x9f,0xc4,0x2a,0x01,0x10,0xc4,0xdf,0x70,0x1a,
+		0xea,0xcd,0x21,0xf8,0x22,0x55,0xa9,0x82,0x97,0xc4,0x90,0x54,0x72,0x9c,0x2e,0xe4,0x26,0x00,0x89,0xd1,
+		0xaf,0x45,0x9e,0xac,0x6c,0x69,0x67,0xa7,0xb5,0x8a,0xda,0xd0,0xe4,0x50,0xa5,0x7e,0xe5,0x83,0x24,0xf2,
+		0x1e,0x38,0x30,0x04,0x1f,0x13,0x1e,0xe8,0x3c,0xc4,0xc2,0xf8,0x33,0xc0,0xa8,0x93,0x99,0xf9,0xa7,0xa1,
+		0xe0,0x81,0x9f,0x74,0x7a,0x57,0xb5,0xd4,0x48,0x80,0x9f,0x70,0x75,0x23,0x26,0x1c,0x54,0xa9,0xe4,0xc2,
+		0xa1,0x60,0xa9,0x84,0x20,0x43,0x8d,0xec,0xb9,0xae,0xab,0x03,0xf8,0x69,0xa9,0x40,0xc6,0x1e,0x1c,0x70,
+		0x2b,0x83,0x4c,0x93,0xb9,0x08,0xfd,0x68,0x6e,0x7f,0x3b,0xff,0xfa,0x05,0xd6,0xaf,0xf9,0xf7,0x29,0x4f,
+		0x14,0x2c,0x3a,0x0e,0xd4,0x25,0x9f,0x13,0xc8,0x09,0xd2,0x3b,0x3b,0xda,0xa9,0x91,0xcf,0x50,0xb1,0x86,
+		0xd1,0x63,0x8d,0x9c,0x8e,0x65,0x34,0xe1,0x35,0x72,0x19,0x73,0x09,0x21,0xde,0x67,0x43,0x26,0x85,0x05,
+		0xd5,0x1d,0x77,0x00,0xab,0x85,0x7c,0x4e,0xca,0xfc,0xb4,0x9a,0x96,0x51,0xb3,0xcc,0xf8,0xb0,0x06,0x7f,
+		0x0e,0x56,0x88,0x4f,0x40,0xe0,0x19,0xff,0x76,0x39,0xf8,0x03,0x4a,0x64,0x85,0x9e,0x0b,0x0f,0xfc,0x14,
+		0x0d,0x95,0x96,0xf2,0xe6,0xe6,0x8a,0x6a,0x76,0x29,0x0d,0x14,0x3b,0x09,0x1d,0x63,0x91,0x28,0xa6,0xb8,
+		0x37,0xc6,0x32,0x08,0x6c,0x4a,0x96,0x81,0xec,0x5e,0xa4,0xea,0x66,0x44,0x9a,0xa4,0x8f,0x24,0xa4,0xd3,
+		0x21,0xfb,0xe4,0xdd,0x3b,0x92,0x2d,0x21,0xa3,0x69,0x82,0xe0,0x86,0xeb,0x66,0x66,0xc2,0xec,0x8a,0x02,
+		0x8e,0x66,0x4e,0x5f,0xed,0x20,0x1a,0x15,0xd8,0x25,0x31,0x80,0xf9,0x0d,0xa4,0x65,0x35,0x0b,0xcf,0xc9,
+		0x02,0x34,0x00,0x59,0xfe,0xd3,0xbf,0xbc,0xb0,0x63,0x26,0x13,0xbe,0x1e,0xdf,0xc4,0xc9,0x0f,0x1a,0xdd,
+		0xc6,0x40,0xae,0x66,0xe1,0xa4,0x17,0x96,0x70,0xf2,0x43,0x27,0x8b,0xf0,0x25,0x4a,0x21,0x71,0x35,0x26,
+		0x14,0xd8,0x52,0xc6,0x53,0xb2,0x93,0x27,0xb7,0xdd,0xbb,0x82,0x2f,0x48,0xc7,0x22,0xcc,0x44,0x56,0x59,
+		0xcb,0xa2,0x8e,0x9a,0x1d,0x0a,0xf9,0x2c,0x70,0xe1,0x9f,0xc7,0x94,0x37,0x26,0x15,0xfe,0xcc,0x4e,0x45,
+		0x0e,0xdc,0x9e,0x40,0x33,0x60,0x23,0x9e,0x12,0xe5,0x9e,0x8b,0x79,0x58,0xa1,0x3f,0x9f,0xdd,0x40,0x7a,
+		0x9a,0xa8,0x84,0xa7,0x9c,0x22,0x5a,0xee,0x0c,0x1e,0xfa,0x66,0xaf,0xdc,0xa3,0x2b,0x72,0xbc,0xec,0x20,
+		0x5a,0xc2,0xa6,0xda,0x37,0x85,0x04,0xaf,0x43,0x86,0xcf,0xb3,0xd5,0x34,0xfa,0x00,0xbb,0x6f,0x78,0x67,
+		0x9a,0xe7,0x18,0x10,0x6b,0x28,0x73,0x29,0xbe,0xf8,0x0c,0xd3,0xc5,0x8a,0xc2,0x4b,0xd4,0x06,0xbf,0xac,
+		0xa7,0x32,0x89,0x17,0x44,0x09,0x5f,0x4f,0x73,0x8a,0x4b,0x6b,0x89,0x52,0x8b,0xad,0x27,0x3b,0x37,0x8b,
+		0x6b,0x09,0xb9,0x94,0x91,0x5c,0x4f,0x76,0x86,0x4b,0x39,0x51,0xc1,0xa4,0x05,0xe1,0xb1,0x87,0xe6,0xdc,
+		0xb4,0xf5,0x75,0xf8,0x26,0x30,0x79,0x84,0x23,0x31,0x5c,0x54,0x5e,0xe8,0x0e,0xc9,0x74,0x80,0xed,0x68,
+		0xa0,0x0b,0xbc,0x8a,0x62,0xe1,0xe9,0x62,0x9b,0x17,0xe1,0x7b,0xf2,0x54,0x4d,0xa3,0x7d,0xe9,0x2e,0xab,
+		0xe4,0xae,0xa5,0x33,0xd0,0xd0,0x26,0xd1,0xb1,0xe6,0x5f,0xeb,0x42,0xbd,0x12,0x09,0x45,0xfb,0x3d,0x0b,
+		0x83,0x4d,0x7c,0xb5,0x37,0xe8,0x6a,0x71,0x2c,0x1a,0xe7,0x1f,0xb3,0xd2,0xa6,0x5e,0xc3,0xaa,0xe8,0x1e,
+		0x1c,0xff,0xf8,0x60,0x3a,0x82,0x69,0x0b,0x5c,0xf3,0xe5,0xe6,0xfc,0x2b,0xf8,0x06,0x16,0x6c,0x9f,0x29,
+		0xd6,0xb2,0x24,0x8f,0x99,0x08,0xd5,0x6d,0x6f,0x45,0xb5,0xa2,0xce,0x38,0x78,0xe9,0x72,0x82,0x9e,0xc8,
+		0xea,0xc9,0xd2,0x21,0xa6,0x87,0x01,0xf9,0xf3,0x7d,0x0c,0x49,0x6b,0xd5,0xa3,0x06,0x5c,0xde,0x50,0x9a,
+		0x4a,0x5d,0xd8,0x73,0xb5,0x37,0xbe,0x3a,0x2c,0x32,0xf7,0x1b,0xef,0x17,0xf6,0x1c,0x40,0xef,0xb9,0x8e,
+		0xe6,0x15,0xa1,0xad,0x14,0x79,0xd3,0x09,0xcc,0xf6,0xf6,0x88,0xab,0xb3,0x80,0xe3,0xeb,0xc7,0x45,0xcf,
+		0xaf,0xbc,0x67,0xef,0xa1,0x5a,0x89,0xaa,0x3d,0x63,0xc1,0x14,0xf3,0xc1,0xc8,0x65,0x67,0xed,0xfc,0x4e,
+		0xdc,0x67,0xe3,0x66,0x6b,0x33,0x93,0x70,0x3b,0x13,0x3c,0x6b,0xbc,0xc0,0x61,0xb0,0x9d,0x83,0x6e,0x41,
+		0x2b,0x56,0xcd,0xdd,0x9b,0xb7,0xa1,0x0d,0xad,0x61,0xc5,0x7b,0xeb,0xba,0x02,0xf8,0x24,0x2d,0xfa,0x4f,
+		0x2f,0x75,0x86,0xf5,0x68,0xe0,0x0c,0xec,0x69,0xb9,0x37,0xb6,0x85,0x79,0x8e,0xd7,0x2a,0xc1,0x9f,0x8b,
+		0xf9,0x64,0xe5,0x73,0x58,0xda,0x80,0x8a,0x91,0x63,0x36,0x4f,0xf8,0x77,0xd3,0x13,0xd5,0x20,0xf2,0x17,
+		0xd7,0x7c,0x08,0x2b,0x1b,0x2d,0x0d,0x2f,0x52,0xf0,0xe4,0x7d,0xb5,0xb0,0x92,0x7c,0x5c,0xdc,0xb0,0xd1,
+		0x05,0xb8,0xa8,0xf2,0x5e,0xf3,0x78,0x5f,0xbd,0x73,0xef,0x0d,0x4f,0x91,0x4e,0x6a,0x50,0xf6,0x2a,0xe6,
+		0x1d,0x40,0xed,0x55,0x07,0xd9,0x01,0x0f,0x47,0x6a,0xdc,0x22,0x3b,0x3b,0x3a,0xde,0x96,0xc1,0xa7,0x3d,
+		0x96,0x11,0x0b,0x43,0x9c,0xcd,0xd1,0x39,0xba,0x9e,0x16,0x5f,0x92,0x5a,0x9a,0xf8,0x00,0xed,0x6d,0x3d,
+		0xb1,0x63,0x03,0x2e,0x9c,0x97,0xe0,0x64,0x15,0xb0,0x18,0x2a,0x8f,0xa9,0x16,0x1b,0xfd,0xf2,0x89,0x07,
+		0x8a,0xe5,0xce,0x59,0x5a,0xb2,0x4d,0xdc,0x75,0x63,0x01,0x18,0x16,0x7d,0x5f,0x29,0x60,0xee,0x90,0x7a,
+		0x95,0xbc,0x23,0xee,0xe3,0x67,0xf8,0xaf,0x4a,0xfe,0xfa,0x2b,0xf3,0x41,0x10,0x29,0xd2,0xed,0x6c,0xb0,
+		0xcb,0xb6,0x3e,0x9a,0x1f,0x96,0x79,0xb2,0x08,0x3d,0x8a,0x63,0xa6,0xb5,0x52,0x33,0x5a,0x85,0xb8,0x7b,
+		0x29,0x04,0xd6,0x24,0xcf,0x52,0x42,0xf0,0xe9,0x1d,0x4d,0xf3,0x19,0x6b,0x08,0x66,0x25,0x3e,0x75,0x6e,
+		0xd1,0x7b,0x1b,0x1c,0x75,0xc6,0xbc,0x71,0x61,0xf4,0x7d,0xc8,0x44,0x7f,0x80,0xd1,0xc0,0x6c,0x56,0x25,
+		0xea,0xee,0xe1,0x3e,0xdb,0x1a,0x5e,0x41,0x24,0x10,0x2f,0x73,0xf9,0x72,0xb7,0x6d,0x53,0x4c,0x39,0x27,
+		0x56,0xe7,0x98,0x42,0xa2,0x63,0x49,0x2c,0xd4,0xce,0x7f,0x19,0x8b,0xec,0xa5,0xc0,0x2a,0xd5,0x3f,0x2d,
+		0x9e,0x48,0x2e,0xd8,0x45,0x85,0x55,0xf5,0x94,0xa5,0x44,0x38,0xe5,0xe9,0x51,0x83,0xfc,0x48,0xea,0x18,
+		0x0e,0x6e,0x61,0x85,0x10,0xc7,0x81,0x12,0xc4,0x47,0x90,0xa1,0x51,0x18,0x2c,0x52,0xcc,0x76,0x09,0x29,
+		0x05,0xc2,0x11,0xc5,0xdd,0xdf,0xaf,0x12,0x94,0x07,0xdf,0xb2,0x54,0x5e,0x57,0x6c,0x01,0x85,0xad,0x5d,
+		0xd7,0x77,0x36,0xe4,0x9f,0x55,0xe2,0xb5,0x0c,0xb4,0xab,0x5f,0xe0,0x30,0x28,0x73,0x78,0x5a,0x8d,0xdb,
+		0x4a,0x29,0x70,0x97,0x9e,0xa1,0xd5,0xc2,0x68,0xfe,0xff,0xec,0xa5,0x7e,0x74,0xaa,0xcf,0x21,0x15,0x55,
+		0x85,0xa2,0x6f,0xe4,0xec,0x64,0x4f,0x38,0xbb,0xc3,0xf9,0x69,0x1e,0xd2,0x9f,0xa8,0x1e,0x45,0xa0,0x45,
+		0x66,0x10,0x3c,0xdb,0x2d,0xc3,0x28,0x3d,0xfd,0xeb,0xf3,0x3d,0x1c,0xff,0x9d,0xf4,0x5e,0x0c,0x8b,0x1f,
+		0x3a,0x32,0x62,0x7e,0x87,0x9a,0x23,0x1f,0xde,0x73,0xf9,0x62,0x06,0xa3,0x0d,0x4b,0x92,0x0e,0xd5,0xf7,
+		0x4e,0x08,0x8b,0xbb,0xed,0x41,0x7e,0xf5,0xb5,0x7a,0xdb,0x35,0xe8,0xb6,0x9d,0x18,0x2f,0xc8,0xf4,0xe5,
+		0x83,0x00,0x66,0x69,0xdd,0xa5,0xe9,0x3d,0x4b,0x87,0xba,0x94,0xe8,0x52,0x96,0x5e,0xb7,0x35,0xf1,0x1a,
+		0x4a,0xdf,0xa9,0x69,0x51,0x48,0x5b,0xc9,0x6e,0x5b,0xf9,0x5d,0x4c,0xa4,0xb6,0x03,0x2f,0xf8,0x91,0x46,
+		0x47,0xfe,0x8d,0xd1,0x90,0x7f,0x68,0xcf,0x9a,0x2f,0x07,0x88,0x09,0xfc,0x4d,0xb5,0xd2,0x35,0x1d,0x9f,
+		0x52,0x8b,0x22,0x5d,0xaa,0x09,0xdc,0x9c,0xb4,0xad,0x2f,0x6e,0x0a,0xb7,0x1f,0x54,0x23,0x32,0x90,0xd1,
+		0xe9,0xbe,0x84,0x35,0x61,0x8f,0x26,0xdb,0x3a,0xf4,0x83,0xa1,0x09,0xd7,0xd2,0xe0,0xca,0x00,0x56,0x0c,
+		0xad,0xb9,0x51,0xa2,0xc4,0xf8,0x8c,0x4e,0xc3,0x87,0x10,0x3d,0x44,0x70,0x9a,0x17,0xde,0x43,0x87,0x2e,
+		0x7d,0x3c,0x16,0x49,0x95,0x66,0xfc,0x50,0xad,0xa5,0x16,0x75,0xa3,0x45,0x7d,0xab,0x16,0xf5,0x57,0x68,
+		0x51,0xdf,0xa8,0x45,0xfd,0x6d,0xb5,0x68,0x18,0x2d,0x1a,0x5b,0xb5,0x68,0xbc,0x42,0x8b,0xc6,0x46,0x2d,
+		0x1a,0x6f,0xab,0xc5,0x9e,0xd1,0x62,0x6f,0xab,0x16,0x7b,0xaf,0xd0,0x62,0x6f,0xa3,0x16,0x7b,0x6f,0xab,
+		0xc5,0xbe,0xd1,0x62,0x7f,0xab,0x16,0xfb,0xaf,0xd0,0x62,0x7f,0xa3,0x16,0xfb,0x6f,0xab,0xc5,0x81,0xd1,
+		0xe2,0x60,0xab,0x16,0x07,0xaf,0xd0,0xe2,0x60,0xa3,0x16,0x07,0x6f,0xab,0xc5,0xa1,0xd1,0xe2,0x70,0xab,
+		0x16,0x87,0xaf,0xd0,0xe2,0x70,0xa3,0x16,0x87,0x6f,0xab,0xc5,0x91,0xd1,0xe2,0x68,0xab,0x16,0x47,0xaf,
+		0xd0,0xe2,0x68,0xa3,0x16,0x47,0x6f,0xa3,0x85,0x93,0x35,0x0e,0x47,0xf7,0x31,0xec,0x8f,0x12,0xb6,0xb4,
+		0x4a,0xe2,0xad,0x6c,0xd1,0x3f,0xf9,0xe5,0xac,0xc0,0xbf,0xd4,0x73,0xa9,0x26,0xd6,0x3c,0x48,0xca,0xea,
+		0x26,0x22,0x3e,0x0f,0xb8,0xe2,0x30,0x16,0xa5,0x4d,0xb4,0x06,0xf3,0x1e,0xe8,0xa1,0x12,0x92,0x0d,0x43,
+		0x2a,0x22,0xae,0x9d,0x6f,0x9e,0x3e,0x18,0x19,0x4b,0x3e,0x04,0x1b,0x9b,0x19,0x67,0xac,0x26,0xb4,0x1b,
+		0x44,0x5e,0x94,0xf7,0x60,0xd6,0x35,0xa8,0xab,0x04,0x30,0xa7,0xf2,0x47,0x83,0x3f,0x8e,0xb0,0x7f,0xae,
+		0x22,0xc6,0xda,0x88,0x7a,0x48,0xc9,0x7b,0x74,0xe1,0xb0,0x91,0xfe,0x36,0x43,0x96,0x3f,0x28,0x34,0xf0,
+		0xf7,0x04,0x8a,0x1d,0x17,0x7b,0xbe,0x03,0xd3,0x02,0x3e,0x32,0xdb,0xe9,0x9f,0xe7,0xba,0xd6,0xdf,0x1d,
+		0xc4,0x4b,0x00,0xa7,0x1b,0x00,0x00,
+	};
+
+	static constexpr ASSET assets[] = {
+		{ "/hardware.htm", "text/html", "\"7cc60e6f319bdeaf\"", asset_hardware_htm, 3158 },
+		{ "/index.htm", "text/html", "\"fcd6dcfd13d7d73d\"", asset_index_htm, 2109 },
+		{ "/pom.htm", "text/html", "\"b8342cb766c5b2ac\"", asset_pom_htm, 2471 },
+		{ "/roster.htm", "text/html", "\"92427363c6331b0e\"", asset_roster_htm, 2884 },
+		{ "/service.htm", "text/html", "\"5437763fb83c85d2\"", asset_service_htm, 2347 },
+		{ "/throttle.htm", "text/html", "\"206e002618decc80\"", asset_throttle_htm, 2843 },
+		{ "/turnout.htm", "text/html", "\"55cb3a4fcd8c6711\"", asset_turnout_htm, 2287 },
+	};
+
+	static constexpr uint8_t assetCount = sizeof(assets) / sizeof(assets[0]);
+
+}
+#endif
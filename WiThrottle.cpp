@@ -10,10 +10,8 @@ https://www.jmri.org/help/en/package/jmri/jmrit/withrottle/Protocol.shtml
 
 /*
  Note ESPasyncTCP can be blocking on a single client if you wish to send a second message.  The fix employed
- here in sendToClient is to send all messages to any given client as one large block message via a message queue
-
- vector message queue implementing std::string.  This will avoid memory leaks and allow variable length
- messages compared to using char arrays.  vector.clear() will not clean up the memory that the pointers reference.
+ here is to accumulate all messages to any given client in a per client ring buffer which is pumped
+ out as the TCP window allows, see txWrite and txPump.
 
 
  Modue supports the following EngineDriver/WiThrottle features;
@@ -64,6 +62,10 @@ ESTOP after 6 seconds.  If he comes back, an hour later he can pick up driving t
 
 It is a feature of this system, that a loco under ED or WiThrottle control can also be controlled from the local hardware unit
 think of this as 'dual-control'.  the local hardware display will remain synchronised to the ED throttle.
+
+2026-10-19 throttles survive a warm reset of the server.  They are restored from the RTC snapshot without a client and
+are claimed by the client sending the same HU on reconnect.  If it has not done so within the heartbeat timeout their
+locos are stopped, and the throttles are then held in the same way as those of a client that has gone to lunch.
 */
 
 
@@ -72,9 +74,12 @@ think of this as 'dual-control'.  the local hardware display will remain synchro
 #include "Global.h"
 #include "WiThrottle.h"
 #include "DCCcore.h"
+#include "DCCbus.h"
+#include "JsonThrottle.h"
+#include "HeapStats.h"
+#include "LocoRoster.h"
 #include <ESP8266WiFi.h>
 #include <ESPAsyncTCP.h>
-#include <vector>
 
 using namespace nsWiThrottle;
 
@@ -87,12 +92,28 @@ enum MTACTION {
 	MT_GARBAGE
 };
 
-/*use a vector to hold associations between loco slots and MT / clients*/
-static std::vector<THROTTLE> throttles;
+/*associations between loco slots and MT / clients.  2026-10-19 a fixed pool rather than a vector, so joining,
+leaving and garbage collection do not touch the heap.  Free records are chained through THROTTLE.nextFree,
+records in use never move so their index is stable*/
+static THROTTLE throttles[WITHROTTLE_MAX_THROTTLES];
+static int16_t m_throttleFree = -1;
+static int16_t m_throttleCount = 0;
+
+/*2026-10-19 fixed table of clients.  Entries do not move, so a CLIENT_T* is given to AsyncTCP as the
+callback arg.  An entry with client==nullptr is free*/
+static CLIENT_T clients[WITHROTTLE_MAX_CLIENTS];
 
-static std::vector<CLIENTMESSAGE> messages;
+/*head of the list of throttles holding each loco slot, chained through THROTTLE.nextOnSlot.
+Together with CLIENT_T.firstThrottle this is rebuilt by indexThrottles whenever throttles changes*/
+static int16_t m_slotFirst[MAX_LOCO];
 
-static std::vector<CLIENT_T> clients;
+/*2026-10-19 runs once after the throttles are restored from the RTC snapshot, see resumeTimeout*/
+static nsTimerWheel::TIMER m_resumeTimer;
+
+/*set when any throttle has an add, steal or release pending for broadcastChanges*/
+static bool m_actionPending = false;
+/*set when a speed echo is being held back by the rate limit*/
+static bool m_echoPending = false;
 
 
 
@@ -122,9 +143,17 @@ void nsWiThrottle::dumpLoco(void) {
 		Serial.printf("\naddr %d speed %f step %d consist %d flag %d \n", loco[i].address,loco[i].speed, loco[i].speedStep,loco[i].consistID,loco[i].changeFlag?1:0);
 	}
 	Serial.printf("heap %d \n\n", ESP.getFreeHeap());
-	Serial.printf("clients size %d \n\n", clients.size());
+	Serial.printf("clients size %d \n\n", clientCount());
+	for (auto &c : clients) {
+		if (c.client == nullptr) continue;
+		Serial.printf("client %s rx lines %d dropped %d, tx depth %d high %d evicted %d dropped %d\n", c.HU,
+			c.rx.lines, c.rx.dropped, c.tx.count, c.tx.highWater, c.tx.evicted, c.tx.dropped);
+	}
+	const nsDCCbus::BUSSTATS &bus = nsDCCbus::getStats();
+	Serial.printf("bus posted %d coalesced %d dropped %d high %d maxLatency %dus\n\n", bus.posted, bus.coalesced, bus.dropped, bus.highWater, bus.maxLatency_us);
 	//dump throttle entries
-	for (auto throttle : throttles) {
+	for (auto &throttle : throttles) {
+		if (!throttle.inUse) continue;
 		int sa=0;
 		if (throttle.locoSlot >= 0) sa = loco[throttle.locoSlot].address;
 		Serial.printf("T-entry-slot %d, slot-addr %d, T-addr %s, MT %d, IP %s \n", throttle.locoSlot, sa, throttle.address, throttle.MT, "no known");
@@ -133,6 +162,157 @@ void nsWiThrottle::dumpLoco(void) {
 
 }
 
+#ifdef WITHROTTLE_TEST
+/*2026-10-19 exercise the line assembler.  A script of typical commands is fed through rxFeed in randomly
+sized fragments, as TCP may deliver it, and every assembled line is checked against the script.  Then random
+bytes are fed to confirm the assembler and separator search stay in bounds.  A manual aid, not an automated
+test, the counts go to Serial and are for the caller to read.  Needs no client or network*/
+void nsWiThrottle::testParser(uint32_t iterations) {
+	static const char *script[] = {
+		"HUa1b2c3d4",
+		"NEngine Driver",
+		"*",
+		"PPA1",
+		"PTA2129",
+		"M0+L341<;>L341",
+		"M0AL341<;>V99",
+		"M0A*<;>R1",
+		"M0A*<;>F112",
+		"M0A*<;>qV",
+		"M0-*<;>r",
+		"Q"
+	};
+	const uint8_t scriptLen = sizeof(script) / sizeof(script[0]);
+
+	//build the stream once, with mixed terminators and an oversize line that must be discarded
+	static char stream[512];
+	size_t sLen = 0;
+	for (uint8_t k = 0; k < scriptLen; ++k) {
+		size_t n = strlen(script[k]);
+		memcpy(stream + sLen, script[k], n);
+		sLen += n;
+		stream[sLen++] = (k & 1) ? '\n' : '\r';
+		if (k % 3 == 0) stream[sLen++] = '\n';
+	}
+	memset(stream + sLen, 'X', WITHROTTLE_RX_SIZE + 10);
+	sLen += WITHROTTLE_RX_SIZE + 10;
+	stream[sLen++] = '\n';
+
+	RXLINE rx;
+	uint32_t seed = 0x2545F491;
+	uint32_t lines = 0;
+	uint32_t errors = 0;
+	uint32_t bytes = 0;
+	uint32_t t = micros();
+
+	for (uint32_t it = 0; it < iterations; ++it) {
+		uint8_t k = 0;
+		size_t pos = 0;
+		while (pos < sLen) {
+			//xorshift, fragment size 1-64
+			seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+			size_t frag = (seed % 64) + 1;
+			if (pos + frag > sLen) frag = sLen - pos;
+			for (size_t i = pos; i < pos + frag; ++i) {
+				if (!rxFeed(rx, stream[i])) continue;
+				lines++;
+				if ((k >= scriptLen) || (strcmp(rx.buf, script[k]) != 0)) errors++;
+				if ((rx.buf[0] == 'M') && (findSeparator(rx.buf, rx.lineLen) == nullptr)) errors++;
+				k++;
+			}
+			pos += frag;
+		}
+		if (k != scriptLen) errors++;
+		bytes += sLen;
+	}
+	t = micros() - t;
+
+	//fuzz with random bytes, the assembler must never exceed its buffer
+	for (uint32_t i = 0; i < iterations * 256; ++i) {
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		char ch = (seed & 0x0F) == 0 ? '\n' : char(seed >> 8);
+		if (rxFeed(rx, ch)) findSeparator(rx.buf, rx.lineLen);
+		if (rx.len >= WITHROTTLE_RX_SIZE) errors++;
+	}
+
+	Serial.printf("parser lines %d dropped %d errors %d bytes %d in %dus\n", lines, rx.dropped, errors, bytes, t);
+}
+
+/*2026-10-19 time broadcastChanges and checkDoSteal with a synthetic set of clients and throttles.  Runs only
+with no WiThrottle clients or throttles, and puts loco[] back afterwards.  Build with WITHROTTLE_MAX_CLIENTS
+defined as 20 to run 20 clients x 4 MT.  A manual aid like testParser, the timings go to Serial.  The clients
+never connect, so the figures cover the throttle bookkeeping and not the TCP writes*/
+void nsWiThrottle::benchThrottles(uint8_t benchClients, uint8_t mtPerClient) {
+	if (clientCount() > 0 || m_throttleCount > 0) {
+		Serial.println(F("bench needs no WiThrottle clients or throttles"));
+		return;
+	}
+	if (benchClients > WITHROTTLE_MAX_CLIENTS) benchClients = WITHROTTLE_MAX_CLIENTS;
+	static LOCO saved[MAX_LOCO];
+	memcpy(saved, loco, sizeof(saved));
+	seedLoco();
+
+	//unconnected clients, canSend() is false so nothing goes on the wire
+	for (uint8_t c = 0; c < benchClients; ++c) {
+		clients[c].client = new AsyncClient();
+		clients[c].connected = true;
+		snprintf(clients[c].HU, sizeof(clients[c].HU), "bench%c", 'A' + c);
+	}
+	uint16_t k = 0;
+	for (uint8_t c = 0; c < benchClients; ++c) {
+		for (uint8_t m = 0; m < mtPerClient; ++m) {
+			THROTTLE t;
+			t.toClient = clients[c].client;
+			t.MT = '0' + m;
+			t.locoSlot = k++ % MAX_LOCO;
+			sprintf(t.address, "S%d", loco[t.locoSlot].address);
+			t.addrKey = addrKey(t.address);
+			t.fnValid = false;
+			t.echoAt = 0;
+			t.echoPending = false;
+			t.MTaction = MT_NORMAL;
+			addThrottle(t);
+		}
+	}
+	indexThrottles();
+	broadcastChanges(true);
+
+	const uint16_t runs = 1000;
+	uint32_t t0 = micros();
+	for (uint16_t r = 0; r < runs; ++r) {
+		loco[r % MAX_LOCO].changeFlag = true;
+		broadcastChanges(true);
+	}
+	uint32_t tBroadcast = micros() - t0;
+
+	t0 = micros();
+	for (uint16_t r = 0; r < runs; ++r) {
+		broadcastChanges(true);
+	}
+	uint32_t tIdle = micros() - t0;
+
+	bool isConsist;
+	char address[8];
+	t0 = micros();
+	for (uint16_t r = 0; r < runs; ++r) {
+		sprintf(address, "S%d", loco[r % MAX_LOCO].address);
+		checkDoSteal(address, true, isConsist);
+	}
+	uint32_t tSteal = micros() - t0;
+
+	Serial.printf("bench %d clients x %d MT, us per %d calls: broadcast 1 loco %d, idle %d, checkDoSteal %d\n",
+		benchClients, mtPerClient, runs, tBroadcast, tIdle, tSteal);
+
+	//tidy up, the bench clients never connected so there is nothing to close
+	clearThrottles();
+	for (uint8_t c = 0; c < benchClients; ++c) {
+		delete clients[c].client;
+		releaseClient(&clients[c]);
+	}
+	memcpy(loco, saved, sizeof(saved));
+}
+#endif
+
 /*debug for testing, send minimal response to boot client*/
 void nsWiThrottle::sendWiMinimal(AsyncClient* client) {
 	if (client->space() > 100 && client->canSend()) {
@@ -161,190 +341,181 @@ static void handleError(void* arg, AsyncClient* client, int8_t error) {
 }
 
 
+/*2026-10-19 line assembler.  TCP gives no guarantee that a segment holds whole commands, so bytes are
+accumulated per client until \r or \n.  Returns true when rx.buf holds a complete, null terminated line
+of rx.lineLen chars.  The line stays valid until the next call.  Lines too long for the buffer are
+discarded in full rather than truncated, as a truncated command could be misinterpreted*/
+bool nsWiThrottle::rxFeed(RXLINE &rx, char ch) {
+	if (ch == '\r' || ch == '\n') {
+		bool ok = (rx.len > 0) && !rx.overflow;
+		if (rx.overflow) rx.dropped++;
+		rx.buf[rx.len] = '\0';
+		rx.lineLen = rx.len;
+		rx.len = 0;
+		rx.overflow = false;
+		if (ok) rx.lines++;
+		return ok;
+	}
+	if (rx.len < WITHROTTLE_RX_SIZE - 1) {
+		rx.buf[rx.len++] = ch;
+	}
+	else {
+		rx.overflow = true;
+	}
+	return false;
+}
+
+/*find the client_t parent to client, nullptr if not known*/
+static CLIENT_T *findClient(AsyncClient *client) {
+	if (client == nullptr) return nullptr;
+	for (auto &c : clients) {
+		if (c.client == client) return &c;
+	}
+	return nullptr;
+}
+
 //inbound data from client
 static void handleData(void* arg, AsyncClient* client, void *data, size_t len) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_WITHROTTLE);
 	//2021-01-30 timeout handling. If we see any message from a client, reset its timeout
 	//2021-02-03 keep seeing timeouts. Make timeout double the period that the client was instructed to respond on. 
-	//2021-09-09 if you have say MAX_LOCO=8 the buffer may not be big enough to capture all incoming data from loco.htm
-		for (auto &c : clients) {
-			if (c.client == client) {
-				//reset the client timeout, timeout is set in seconds, but the timebase is 250mS
-				//add 100% margin because ED does not reliably send commands or heartbeat with the 
-				//timeout period
-				c.timeout = 2 *(4 * WITHROTTLE_TIMEOUT);
-
-			}
-		}
-
-		trace(Serial.printf("\ndata from client %s \n", client->remoteIP().toString().c_str());)
-	
-	/*each chunk of data is terminated with newline so for WiThrottle its a discrete command
-	split the incoming data into message elements. delimiter is \n or \r
-	Generally WiThrottle only sends multiple elements for consists
-	
-	2020-12-30 strtok modifies its input char* and this is unsafe because it operates beyond len
-	as *data is not null terminated.
-	for this reason we copy the data(len) into buffer which is null terminated*/
-				
-	
-	char *msg;
-	//assume 512 is large enough for anticipated data
-	char buffer[512];
-	int cnt = 0;
-	memset(buffer, '\0', sizeof(buffer));
-	if (len > 511) len = 511;
-
-	//incoming *data was void, need to cast to const char
-	strncpy(buffer, (const char*)data, len);
-	
-	//msg = strtok((char*)data, "\r\n");  //this overruns len of *data because *data is not null terminated
-	msg = strtok(buffer, "\r\n");
-	while (msg != NULL)
-	{
-
-		trace(Serial.printf("element %s\n",msg);)
-
-		if ((msg[0] == 'H') && msg[1] == 'U') {
-			//pick up the unique identifier.  BUT if we already have this, it means the prior client
-			//is back again but with a new IP.  Problem is we may have disco'd that client already
-			//If a client walks out of the building, we'd hold their  client_t and throttles indefinately
-			//others would have to request a steal to break any consists and take the locos
-
-			for (auto &c : clients) {
-				if (c.client == client) c.HU = msg;
-				trace(Serial.printf("NEW ID %s\r\n", msg);)
-			}
+	//arg is our client_t entry, it may have been released by Q
+	CLIENT_T *cp = (CLIENT_T*)arg;
+	if (cp == nullptr || cp->client != client) return;
+	//restart the client heartbeat, timeout is set in seconds
+	//add 100% margin because ED does not reliably send commands or heartbeat with the 
+	//timeout period
+	nsTimerWheel::start(cp->heartbeat, 2 * 1000UL * WITHROTTLE_TIMEOUT, &clientTimeout, cp);
+
+	trace(Serial.printf("\ndata from client %s \n", client->remoteIP().toString().c_str());)
+
+	/*2026-10-19 a command may be split across segments, or a segment may carry many commands (consists)
+	so assemble lines per client.  *data is not null terminated, and is never modified*/
+	const char *d = (const char*)data;
+	for (size_t i = 0; i < len; ++i) {
+		if (!rxFeed(cp->rx, d[i])) continue;
+		dispatchLine(cp->rx.buf, cp->rx.lineLen, client);
+		//Q will have released our entry
+		if (cp->client != client) return;
+	}
+}
 
-			//ensure HU identifier is unique
-			checkClientID(client);
+/*act on one complete line from a client. msg is null terminated and len chars long.
+dispatch is on the leading characters, no copy of the line is taken*/
+void nsWiThrottle::dispatchLine(char *msg, size_t len, AsyncClient *client) {
+	trace(Serial.printf("element %s\n",msg);)
+
+	switch (msg[0]) {
+	case 'H':
+		if (msg[1] != 'U') return;
+		//pick up the unique identifier.  BUT if we already have this, it means the prior client
+		//is back again but with a new IP.  Problem is we may have disco'd that client already
+		//If a client walks out of the building, we'd hold their  client_t and throttles indefinately
+		//others would have to request a steal to break any consists and take the locos
+		{
+			CLIENT_T *cp = findClient(client);
+			if (cp == nullptr) return;
+			if (len >= sizeof(cp->HU)) len = sizeof(cp->HU) - 1;
+			memcpy(cp->HU, msg, len);
+			cp->HU[len] = '\0';
+			cp->huHash = nsRtcSnapshot::huHash(cp->HU);
+			trace(Serial.printf("NEW ID %s\r\n", msg);)
 		}
+		//ensure HU identifier is unique.  this may erase another client_t, so msg is not used after this
+		checkClientID(client);
+		return;
 
-		//deal with this message element
+	case 'N':
+	{//scope block
 		//NEW client. Note this might not always be the case, as *heartbeat can case the client to keep emitting its name
 		//N is actually the device name and H the device ID, these are always transmitted when a client wants to join
 		//but my also be a heartbeat poll.  So strictly we don't want to keep sending the rosters, we need to check if the client exists
-		if (msg[0]=='N') {
-			//note, no throttle objects are created on the client until the client selects their first loco. so in the meantime
-			//on every 10 sec timeout, the client sends Nsomename and we broadcast the turnout roster to all clients
-	
-			//does this client have any throttle objects yet?
-		bool newClient = true;
-		for (auto t : throttles) {
-			if (t.toClient == client) { 
-					newClient = false;
-					break;
-					}
-		}
+		//note, no throttle objects are created on the client until the client selects their first loco. so in the meantime
+		//on every 10 sec timeout, the client sends Nsomename and we broadcast the turnout roster to all clients
+
+		//does this client have any throttle objects yet?
+		CLIENT_T *cp = findClient(client);
+		bool newClient = (cp == nullptr) || (cp->firstThrottle < 0);
 
 		//no throttles so send the rosters
 		if (newClient) {
-
 			trace(Serial.write("New WiThrottle client");)
-	
 			broadcastLocoRoster(client);
 			broadcastTurnoutRoster(client);
 			//2021-01-29 don't send a welcome message, it seems to confuse some clients
-			//queueMessage("HMJMRI: Welcome to ESP DCC", client);  
 			//send immediately
 			broadcastChanges(false);
 		}
 		else {
 			//no need to send anything back as client will next send qR qV
-				trace(Serial.println("N");)
-			}
-
+			trace(Serial.println("N");)
 		}
+	}//end scope block
+		return;
 
+	case 'Q':
 		/*CLIENT QUIT*/
-		if (msg[0] == 'Q') {
-			//WiThrottle has quit, release all locos on this IP client. Engine Driver will release all locos before sending
-			//the Q message anyway
-			nsWiThrottle::addReleaseThrottle(client, 0xFF, NULL, false);	
-			
-			//2021-02-03 delete the client_t object from clients vector.  This is a CLEAN exit
-			//as opposed to an app crash or wifi dropout
-			for (auto it = clients.begin(); it != clients.end(); ) {
-				if (it->client == client) {
-					it = clients.erase(it);
-				}
-				else {
-					++it;
-				}
-			}
-					   
+		//WiThrottle has quit, release all locos on this IP client. Engine Driver will release all locos before sending
+		//the Q message anyway
+		nsWiThrottle::addReleaseThrottle(client, 0xFF, NULL, false);
+
+		//2021-02-03 delete the client_t object from clients table.  This is a CLEAN exit
+		//as opposed to an app crash or wifi dropout
+		releaseClient(findClient(client));
+		return;
+
+	case '*':
+		//HEARTBEAT.  2020-12-30 we don't do anything with this at present
+		trace(Serial.println(F("heartbeat"));)
+		return;
+
+	case 'P':
+		if (len < 4 || msg[2] != 'A') return;
+		//POWER command
+		if (msg[1] == 'P') {
+			/*post new setting, DCCcore will broadcast it. this also handles PPA2 unknown*/
+			nsDCCbus::setPower(msg[3] == '1' ? true : false, nsDCCbus::BUS_WITHROTTLE);
+			return;
 		}
-	
-
-	//HEARTBEAT.  2020-12-30 we don't do anything with this at present
-	if (msg[0] == '*') {
-				trace(Serial.println(F("heartbeat"));)
-	}
-
-	//POWER command
-	char *p = strstr(msg, "PPA"); 
-	if (p) {
-		/*emit new setting. this also handles PPA2 unknown*/
-		nsWiThrottle::setPower(msg[3]=='1'?true:false);
-	}
-
-	/*TURNOUT command*/
-	p = strstr(msg, "PTA");
-	if (p) {
-		/*will see 2 toggle, C close or T throw. first decode address which is msg[4]*/
-		char *a = p + 4;
-		if (a) {
-			//find matching turnout or assign one
-			
+		/*TURNOUT command*/
+		if (msg[1] == 'T') {
+			/*will see 2 toggle, C close or T throw. address is msg[4]*/
 			//2021-02-05 WiThrottle can send alphanumeric characters.  This system does not support
 			//set-up with a name,  it needs an integer address.  We must validate this
-			uint16_t t = atoi(a);
-
+			uint16_t t = atoi(msg + 4);
 			if (t > 2047) t = 0;
 			if (t != 0) {
 				//address is in the valid 1-2047 range
-
-				uint8_t i;
-				//find a match or assign a new turnout slot
-				i = findTurnout(atoi(a));
-
-				switch (p[3]) {
-				case 'T':
-					turnout[i].thrown = true;
-					break;
-
-				case 'C':
-					turnout[i].thrown = false;
-					break;
-
-				default:
-					/*toggle*/
-					turnout[i].thrown = !turnout[i].thrown;
-				}
-				/*set change flag*/
-				turnout[i].changeFlag = true;
-				trace(Serial.printf("turnout slot %d state %d\n", i, turnout[i].thrown);)
+				//DCCcore will find a match or assign a new turnout slot.  T throw, C close, else toggle
+				nsDCCbus::setTurnout(-1, t, msg[3] == 'T' ? 1 : (msg[3] == 'C' ? 0 : 2), nsDCCbus::BUS_WITHROTTLE);
 			}
 		}
-	}
+		return;
 
-	/*LOCOMOTIVE commands*/
-	if (msg[0] == 'M') {
-		/*handle loco commands*/
-		nsWiThrottle::doThrottleCommand(msg, client);
-	}
-	
-	/*more data?*/
-	msg = strtok(NULL, "\r\n");
+	case 'M':
+		/*LOCOMOTIVE commands*/
+		nsWiThrottle::doThrottleCommand(msg, len, client);
+		return;
 	}
+}
 
-	
+/*bounded search for the <;> separator in a throttle command, returns nullptr if not present*/
+char *nsWiThrottle::findSeparator(char *msg, size_t len) {
+	for (size_t i = 0; i + 2 < len; ++i) {
+		if (msg[i] == '<' && msg[i + 1] == ';' && msg[i + 2] == '>') return msg + i;
+	}
+	return nullptr;
 }
 
 static void handleDisconnect(void* arg, AsyncClient* client) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_WITHROTTLE);
 	//Serial.printf("\n client %s disconnected \n", client->remoteIP().toString().c_str());
 	//the client always seems to report as 0.0.0.0 so no point doing anything more than a message
 	Serial.println(F("client disconnected"));
 
+	CLIENT_T *cp = (CLIENT_T*)arg;
+	if (cp != nullptr && cp->client == client) cp->connected = false;
+
 	//2021-02-03 take no further action.  Do not delete the client_t element from the clients vector, because we don't know if 
 	//this was a clean exit, or a wifi dropout (which causes a connection reset and then a client-disco on reconnect, followed by 
 	//a new connect.   given that we want to persist the throttles through a Wifi drop out, we cannot erase the client_t
@@ -357,102 +528,296 @@ static void handleTimeOut(void* arg, AsyncClient* client, uint32_t time) {
 	Serial.printf("\n client ACK timeout ip: %s \n", client->remoteIP().toString().c_str());
 }
 
+/*client has acknowledged data, so the window has opened.  continue sending*/
+static void handleAck(void* arg, AsyncClient* client, size_t len, uint32_t time) {
+	CLIENT_T *cp = (CLIENT_T*)arg;
+	if (cp != nullptr && cp->client == client) txPump(*cp);
+}
+
 static void handleNewClient(void* arg, AsyncClient* client) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_WITHROTTLE);
 	Serial.printf("\n new client ip: %s", client->remoteIP().toString().c_str());
-	// add to list
-	CLIENT_T client_t;
-	client_t.client = client;
-	clients.push_back(client_t);
+	// add to table. if full, reuse an entry for a client that has gone and holds no throttles
+	CLIENT_T *cp = nullptr;
+	for (auto &c : clients) {
+		if (c.client == nullptr) { cp = &c; break; }
+	}
+	if (cp == nullptr) {
+		for (auto &c : clients) {
+			if (!c.connected && c.firstThrottle < 0) { cp = &c; break; }
+		}
+	}
+	if (cp == nullptr) {
+		Serial.println(F("client table full"));
+		client->close(true);
+		return;
+	}
+	releaseClient(cp);
+	cp->client = client;
+	cp->connected = true;
 	
-	// register events
-	client->onData(&handleData, NULL);
-	client->onError(&handleError, NULL);
-	client->onDisconnect(&handleDisconnect, NULL);
-	client->onTimeout(&handleTimeOut, NULL);
+	// register events. our table entry is passed as the arg
+	client->onData(&handleData, cp);
+	client->onError(&handleError, cp);
+	client->onDisconnect(&handleDisconnect, cp);
+	client->onTimeout(&handleTimeOut, cp);
+	client->onAck(&handleAck, cp);
+}
+
+/*return a client_t entry to the free state*/
+void nsWiThrottle::releaseClient(CLIENT_T *cp) {
+	if (cp == nullptr) return;
+	cp->client = nullptr;
+	cp->connected = false;
+	cp->HU[0] = '\0';
+	cp->huHash = 0;
+	nsTimerWheel::cancel(cp->heartbeat);
+	cp->rx.len = 0;
+	cp->rx.overflow = false;
+	cp->rx.lines = 0;
+	cp->rx.dropped = 0;
+	cp->tx.head = 0;
+	cp->tx.tail = 0;
+	cp->tx.count = 0;
+	cp->tx.highWater = 0;
+	cp->tx.midLine = false;
+	cp->tx.sent = 0;
+	cp->tx.evicted = 0;
+	cp->tx.dropped = 0;
+	cp->rosterNext = WITHROTTLE_RL_IDLE;
+	cp->rosterAgain = false;
+	//any throttles it held are now orphans, drop them from the index
+	indexThrottles();
 }
 
 /*boot the WiThrottle system*/
 void nsWiThrottle::startThrottle(void) {
+	clearThrottles();
+	//2026-10-19 after a warm reset, throttles held before it wait for their clients
+	nsRtcSnapshot::resumeThrottles();
 	AsyncServer *server = new AsyncServer(bootController.tcpPort); // start listening on tcp port
 	server->onClient(&handleNewClient, server);
 	server->begin();
 }
 
 uint8_t nsWiThrottle::clientCount(void) {
-	return clients.size();
+	uint8_t n = 0;
+	for (auto &c : clients) {
+		if (c.client != nullptr) n++;
+	}
+	return n;
 }
 
 
-/*send data to a specific client, or all if client=nullptr*/
-void nsWiThrottle::sendToClient(char *data, AsyncClient *client) {
-	for (auto c : clients) {
-		//if no client specified, send to all
-		if ((client == nullptr) || (client == c.client)) {
-			if (c.client->space() > sizeof(data) && c.client->canSend()) {
-				c.client->add(data, strlen(data));
-				c.client->send();
-			}
+/*2026-10-19 outbound path.  Each client has a fixed ring of WITHROTTLE_TX_SIZE bytes, so no allocation is
+made per message.  Lines are written to the ring and pumped to AsyncTCP as the TCP window allows, the onAck
+callback continues the pump as the client acknowledges data.
+If a line will not fit, the oldest complete lines are evicted.  Later lines carry newer loco and turnout
+state so this is preferable to dropping the new data.  A line that has been partially sent cannot be
+evicted, as the client would then see a corrupt command*/
+
+/*append one or more complete lines to a client ring, returns false if dropped*/
+bool nsWiThrottle::txWrite(CLIENT_T &c, const char *data, size_t len) {
+	TXRING &tx = c.tx;
+	if (len == 0) return true;
+	if (len > WITHROTTLE_TX_SIZE) {
+		tx.dropped++;
+		return false;
+	}
+
+	while (WITHROTTLE_TX_SIZE - tx.count < len) {
+		//evict the oldest line, unless its first part is already with AsyncTCP
+		if (tx.count == 0 || tx.midLine) {
+			tx.dropped++;
+			return false;
 		}
+		uint16_t n = 0;
+		uint16_t i = tx.tail;
+		while (n < tx.count) {
+			n++;
+			if (tx.buf[i] == '\n') break;
+			i = (i + 1) % WITHROTTLE_TX_SIZE;
+		}
+		tx.tail = (tx.tail + n) % WITHROTTLE_TX_SIZE;
+		tx.count -= n;
+		tx.evicted++;
 	}
-}
 
-//send data to a specific client, or all if client=nullptr. overload takes std::string
-//std::string::max_size() will tell you the theoretical limit imposed by the architecture your program is running under. 
-//internet says ESP will truncate at Ethernet frame buffer len of 1500 bytes
-void nsWiThrottle::sendToClient(std::string s, AsyncClient *client) {
-	//const char *data = s.c_str(); will cause a crash if you use it to call sendToClient
-	//need to copy the data to a new array
-
-	if (s.size() > 0) {
-		char *data = new char[s.size() + 1];
-		copy(s.begin(), s.end(), data);
-		data[s.size()] = '\0';
-		sendToClient(data, client);
-			
-		//we used new to create *data.  delete now else you create a memory leak
-		delete data;
+	//copy in, in at most two parts if the ring wraps
+	uint16_t first = WITHROTTLE_TX_SIZE - tx.head;
+	if (first > len) first = len;
+	memcpy(tx.buf + tx.head, data, first);
+	memcpy(tx.buf, data + first, len - first);
+	tx.head = (tx.head + len) % WITHROTTLE_TX_SIZE;
+	tx.count += len;
+	if (tx.count > tx.highWater) tx.highWater = tx.count;
+	return true;
+}
 
-		//2021-09-09 instead, would this work?  std::string.data is a const pointer to the data
-		//warning: anything that modifies string.data will cause a crash
-		//sendToClient(s.data, client);
+/*hand as much of the ring to AsyncTCP as the window allows.  data is copied by AsyncTCP.
+where possible only whole lines are handed over, so that eviction remains possible in txWrite*/
+void nsWiThrottle::txPump(CLIENT_T &c) {
+	TXRING &tx = c.tx;
+	if (c.client == nullptr) return;
+	//an RL line goes out whole, and starts once the ring is empty
+	if (c.rosterNext >= 0 || (c.rosterNext == WITHROTTLE_RL_START && tx.count == 0)) {
+		if (!rosterPump(c)) return;
+	}
+	if (tx.count == 0 || !c.client->canSend()) return;
+
+	size_t allow = c.client->space();
+	if (allow == 0) return;
+	if (allow < tx.count) {
+		//trim back to the last line end within the window. if a single line exceeds the window, send it in parts
+		size_t n = allow;
+		while (n > 0 && tx.buf[(tx.tail + n - 1) % WITHROTTLE_TX_SIZE] != '\n') n--;
+		if (n > 0) allow = n;
+	}
+	else {
+		allow = tx.count;
+	}
 
+	//at most two parts if the ring wraps
+	while (allow > 0) {
+		size_t chunk = WITHROTTLE_TX_SIZE - tx.tail;
+		if (chunk > allow) chunk = allow;
+		size_t n = c.client->add(tx.buf + tx.tail, chunk, ASYNC_WRITE_FLAG_COPY);
+		if (n == 0) break;
+		tx.tail = (tx.tail + n) % WITHROTTLE_TX_SIZE;
+		tx.count -= n;
+		tx.sent += n;
+		allow -= n;
 	}
+	//remember if we stopped part way through a line
+	tx.midLine = (tx.count > 0) && (tx.buf[(tx.tail + WITHROTTLE_TX_SIZE - 1) % WITHROTTLE_TX_SIZE] != '\n');
+	c.client->send();
+	if (tx.count == 0 && c.rosterNext == WITHROTTLE_RL_START) rosterPump(c);
+}
 
+/*sum of dropped messages across all clients, for the hardware status page*/
+uint32_t nsWiThrottle::txDropped(void) {
+	uint32_t n = 0;
+	for (auto &c : clients) {
+		n += c.tx.dropped;
+	}
+	return n;
 }
 
 /*check new throttle IDs and deal with duplicates caused by Wifi dropouts*/
 void nsWiThrottle::checkClientID(AsyncClient *client) {
 	//find the client_t parent to client
-	CLIENT_T *cp = nullptr;
-	for (auto ct : clients) {
-		if (ct.client == client) {
-			cp = &ct;
-			break;
-		}
-	}
+	CLIENT_T *cp = findClient(client);
 	if (cp == nullptr) return;
 
+	//2026-10-19 throttles restored after a warm reset of the server, this client held them before it
+	bool claimed = false;
+	for (auto &t : throttles) {
+		if (!t.inUse || t.resumeHU == 0 || t.resumeHU != cp->huHash) continue;
+		t.toClient = cp->client;
+		t.resumeHU = 0;
+		//confirm the loco to the client, with its speed and functions
+		t.MTaction = MT_NEWADD;
+		claimed = true;
+	}
+	if (claimed) {
+		indexThrottles();
+		m_actionPending = true;
+	}
+
 	//HU should be unique.  kill any 'old' one
-	for (auto it = clients.begin(); it != clients.end();) {
+	for (auto &old : clients) {
 		//does the new ID match an existing one? and is not self
-		if (it->client == cp->client) goto skip;
-		if (it->HU.compare(cp->HU) != 0) goto skip;
-			//have a match on the 'old' client_t object
-			//move all the throttles under it.client over to cp.client
-			for (auto &t : throttles) {
-				if (t.toClient==it->client) t.toClient = cp->client;
-			}
-			//delete the old client_t
-			it = clients.erase(it);
-			return;
-		skip:
-			++it;
+		if (old.client == nullptr || old.client == cp->client) continue;
+		if (strcmp(old.HU, cp->HU) != 0) continue;
+		//have a match on the 'old' client_t object
+		//move all the throttles under it.client over to cp.client
+		//the client may have missed function changes whilst away, so resync these in full
+		for (auto &t : throttles) {
+			if (!t.inUse || t.toClient != old.client) continue;
+			t.toClient = cp->client;
+			t.fnValid = false;
+			if (t.locoSlot >= 0 && t.locoSlot < MAX_LOCO) loco[t.locoSlot].functionFlag = true;
+		}
+		//delete the old client_t, this also rebuilds the index
+		releaseClient(&old);
+		return;
 	}
 		
 	//Note: the only other time a client_t is erased, is on a clean-exit invoked through
 	//the Q command.
 }
 
+/*2026-10-19 rebuild the per-client and per-slot throttle lists.  Called whenever throttles are added or
+removed, or move client.  Lists are in pool order*/
+void nsWiThrottle::indexThrottles(void) {
+	for (auto &c : clients) {
+		c.firstThrottle = -1;
+	}
+	for (auto &h : m_slotFirst) {
+		h = -1;
+	}
+	for (int16_t i = WITHROTTLE_MAX_THROTTLES - 1; i >= 0; --i) {
+		THROTTLE &t = throttles[i];
+		t.clientIdx = -1;
+		t.nextOnClient = -1;
+		t.nextOnSlot = -1;
+		if (!t.inUse) continue;
+		for (int8_t c = 0; c < WITHROTTLE_MAX_CLIENTS; ++c) {
+			if (clients[c].client != nullptr && clients[c].client == t.toClient) {
+				t.clientIdx = c;
+				t.nextOnClient = clients[c].firstThrottle;
+				clients[c].firstThrottle = i;
+				break;
+			}
+		}
+		if (t.locoSlot >= 0 && t.locoSlot < MAX_LOCO) {
+			t.nextOnSlot = m_slotFirst[t.locoSlot];
+			m_slotFirst[t.locoSlot] = i;
+		}
+	}
+}
+
+/*2026-10-19 copy t into a free pool record.  false if the pool is full.  The caller rebuilds the index*/
+bool nsWiThrottle::addThrottle(const THROTTLE &t) {
+	if (m_throttleFree < 0) {
+		trace(Serial.println(F("throttle pool full"));)
+		return false;
+	}
+	int16_t i = m_throttleFree;
+	m_throttleFree = throttles[i].nextFree;
+	throttles[i] = t;
+	throttles[i].inUse = true;
+	throttles[i].nextFree = -1;
+	++m_throttleCount;
+	return true;
+}
+
+/*return every record to the free list*/
+void nsWiThrottle::clearThrottles(void) {
+	m_throttleFree = -1;
+	for (int16_t i = WITHROTTLE_MAX_THROTTLES - 1; i >= 0; --i) {
+		throttles[i].inUse = false;
+		throttles[i].nextFree = m_throttleFree;
+		m_throttleFree = i;
+	}
+	m_throttleCount = 0;
+	indexThrottles();
+}
+
+/*numeric key for a WiThrottle address L341 or S3.  long addresses have bit 15 set*/
+uint16_t nsWiThrottle::addrKey(const char *address) {
+	if (address == nullptr) return 0;
+	uint16_t k = atoi(address + 1) & 0x3FFF;
+	if (address[0] == 'L') k |= 0x8000;
+	return k;
+}
+
+/*key for the address currently held in a loco slot, comparable with addrKey*/
+uint16_t nsWiThrottle::locoKey(int8_t slot) {
+	if (slot < 0 || slot >= MAX_LOCO) return 0;
+	return loco[slot].address | (loco[slot].useLongAddress ? 0x8000 : 0);
+}
+
 #pragma endregion
 
 
@@ -464,14 +829,16 @@ int8_t nsWiThrottle::addReleaseThrottle(AsyncClient* toClient, char MT, char *ad
 	trace(Serial.println("addRT");)
 
 	//re-write.  we flag for release, we don't delete throttle items here
-	for (auto& throttle : throttles) {
-		if (toClient == throttle.toClient) {
+	CLIENT_T *cp = findClient(toClient);
+	uint16_t key = addrKey(address);
+	for (int16_t i = (cp == nullptr) ? -1 : cp->firstThrottle; i >= 0; i = throttles[i].nextOnClient) {
+		THROTTLE &throttle = throttles[i];
+		{
 			/*client matches, check address and MT.  MT value of 0xFF signifies ALL*/
 			if ((MT == throttle.MT) || (MT == 0xFF)) {
-				/*order of precedence and short-circuiting.  if address==NULL we don't want to evaluate next condition
-				strcmp because its behaviour with NULL is undefined, i.e. a crash*/
+				/*order of precedence and short-circuiting.  if address==NULL we don't want to evaluate next condition*/
 
-				if ((address == NULL) || (address == "") || (strcmp(address, throttle.address) == 0)) {
+				if ((address == NULL) || (address[0] == '\0') || (key == throttle.addrKey)) {
 					/*found a hit, now for drop, we erase it*/
 					if (doAdd) {
 						/*bail, item exists we don't wish to add again*/
@@ -481,6 +848,7 @@ int8_t nsWiThrottle::addReleaseThrottle(AsyncClient* toClient, char MT, char *ad
 					{
 						/*flag item for release and subqeuent deletion*/
 						throttle.MTaction = MT_RELEASE;
+						m_actionPending = true;
 
 						/*2020-05-26 remove the consistID*/
 						if (throttle.locoSlot >= 0 && throttle.locoSlot < MAX_LOCO) {
@@ -503,6 +871,10 @@ int8_t nsWiThrottle::addReleaseThrottle(AsyncClient* toClient, char MT, char *ad
 	/*adding a throttle.   It is assumed 'safe' to do so, i.e. doCheckSteal was called prior*/
 	THROTTLE myT;
 	strncpy(myT.address, address, 7);
+	myT.addrKey = addrKey(address);
+	myT.fnValid = false;
+	myT.echoAt = 0;
+	myT.echoPending = false;
 	myT.MT = MT;
 	myT.toClient = toClient;
 	/*find matching loco slot, or assign one*/
@@ -515,18 +887,20 @@ int8_t nsWiThrottle::addReleaseThrottle(AsyncClient* toClient, char MT, char *ad
 	/*add item if valid slot found, i.e. positive slot value*/
 	if ((myT.locoSlot >= 0) && (myT.locoSlot < MAX_LOCO)) {
 		//2020-05-26 assign a consistID to underlying loco slot
+		if (!addThrottle(myT)) return -1;
 		nsWiThrottle::setConsistID(&myT);
-		throttles.push_back(myT);
+		indexThrottles();
+		m_actionPending = true;
 		/*UPDATE the appropriate loco array element.*/
 		/*Note: Engine Driver expects to pick up an existing loco from a roster, which predfines the speed steps
 		 *ED cannot send a message to set 28/128 steps.  it appears to work natively in 128 mode
 		 *So, if the loco was not defined in the local UI, we just have to leave the use128 setting as is on the slot*/
-		loco[myT.locoSlot].address = atoi(address + 1);
-		loco[myT.locoSlot].useLongAddress = address[0] == 'L' ? true : false;
+		//2026-10-19 paged from the roster, which supplies name and speed steps if it knows the loco
+		nsLocoRoster::page(myT.locoSlot, atoi(address + 1), address[0] == 'L');
 		/*flag a change, this will cause the existing values to transmit and get picked up by the MT*/
 		loco[myT.locoSlot].changeFlag = true;
 		//2021-1-15 flag the roster has changed
-		bootController.flagLocoRoster = true;
+		locoRosterChanged();
 	}
 	trace(Serial.println("addRT4");)
 
@@ -534,18 +908,17 @@ int8_t nsWiThrottle::addReleaseThrottle(AsyncClient* toClient, char MT, char *ad
 }
 
 /*process wiThrottle loco commands against specific toClient, return -1 if fail*/
-int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
+int8_t nsWiThrottle::doThrottleCommand(char *msg, size_t len, AsyncClient *toClient) {
 	//new message comes in over a client/throttle,this might have an impact on multiple outgoing throttles.
-	if (data == NULL) return -1;
+	if (msg == NULL) return -1;
 	if (toClient == nullptr) return -1;
 
-	char* msg = (char*)data;
-	int8_t i;
-
 	/*doesn't matter if we are using a literal DCC address entry or a roster entry, we can index off the loco address*/
 
-	char *p = strstr(msg, "<;>");   //returns <;>and characters to right
+	char *p = findSeparator(msg, len);   //returns <;>and characters to right
 	if (!p) { return -1; }  //didn't find <;> means this is not a valid command
+	//address field is msg+3 to p, it must fit the address buffers below
+	if ((p - msg) < 3 || (p - msg) - 3 > 8) { return -1; }
 
 
 	/*STEAL. S denotes client wishes to proceed with a steal operation MTSL341<;>L341*/
@@ -558,6 +931,8 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 		bool isConsist;
 		/*proceed with the steal operation*/
 		nsWiThrottle::checkDoSteal(address, false, isConsist);
+		/*2026-10-19 and from any browser throttle*/
+		nsJsonThrottle::releaseLoco(address);
 		/*and assign the loco to requesting client*/
 
 		/*2020-11-25 expect a numeric throttle value, but T denoting a single throttle is also valid and will map to 36d ='T'-'0'*/
@@ -592,7 +967,7 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 
 		/*check if we need to steal from another MT? We use the slotAddress, which will match address if the slot is already
 		in use, or will be the existing slotaddress if we need to bump one.*/
-		if (nsWiThrottle::checkDoSteal(slotAddress, true, isConsist)) {
+		if (nsWiThrottle::checkDoSteal(slotAddress, true, isConsist) || nsJsonThrottle::isLocoHeld(slotAddress)) {
 			/*a steal is required from an existing MT*/
 			myT.locoSlot = -1; //no slot assigned
 			myT.MTaction = MT_STEAL;
@@ -600,9 +975,15 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 			/*e.g. if all slots are full and we want to add L999, then we may need to bump S3 from another throttle
 			but the steal command itself will relate to L999*/
 			strncpy(myT.address, address, 7);
+			myT.addrKey = addrKey(address);
+			myT.fnValid = false;
+			myT.echoAt = 0;
+			myT.echoPending = false;
 			myT.MT = msg[1];
 			myT.toClient = toClient;
-			throttles.push_back(myT);
+			if (!addThrottle(myT)) return -1;
+			indexThrottles();
+			m_actionPending = true;
 
 		}
 		else
@@ -643,86 +1024,52 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 
 	//2020-05-20 need to process as * or individual addresses.  this is important for consists
 	//as speed is sent using * denotion and direcion is specific to individual locos in the consist
-
-	//2020-11-24 find highest history value
-	uint16_t age = 0;
-	for (auto h : loco) {
-		if (h.history > age) age = h.history;
-	}
-
-
-	for (auto throttle : throttles) {
-		/*matches our target client*/
-		if (throttle.toClient != toClient) { continue; }
-		/*yes, how about the MT id?*/
+	uint16_t key = addrKey(address);
+	bool all = (msg[3] == '*');
+
+	/*walk the throttles on our target client*/
+	CLIENT_T *cp = findClient(toClient);
+	for (int16_t i = (cp == nullptr) ? -1 : cp->firstThrottle; i >= 0; i = throttles[i].nextOnClient) {
+		THROTTLE &throttle = throttles[i];
+		/*how about the MT id?*/
 		if (msg[1]  != throttle.MT) { continue; }
 		/*points to a valid loco slot?*/
 		if (throttle.locoSlot < 0) { continue; }
 
-		LOCO &loc = loco[throttle.locoSlot];
-
 		/*We have confirmed matching client and same MT, now process specific commands*/
 		/*M0A*<;>V22 or M0AS23<;>R0 for example. 'A' signifies a loco action.*/
 		/*p points at the <;>command part*/
+		/*commands are posted to the bus, DCCcore applies them on its next tick*/
 
 		//2020-01-29 also see M0A*<;>qV and qR which are queries for values held on server
 		if (msg[2] == 'A') {
-			if (p[3] == 'V' && (msg[3] == '*' || (strcmp(address, throttle.address) == 0))) {
-				/*SPEED command, respond to * or match address exactly */
-
+			if (p[3] == 'V' && (all || key == throttle.addrKey)) {
+				/*SPEED command, respond to * or match address exactly. negative speed is an estop*/
 				int8_t speedCode = atoi(p + 4);
 
 				trace(Serial.printf("speed cmd %d\\r\n", speedCode);)
 
-				if (speedCode < 0) {
-					/*handle estop*/
-					loc.speed = 0;
-					/*set the timer, this tells the packet engine to send the estop code*/
-					loc.eStopTimer = LOCO_ESTOP_TIMEOUT;
-					loc.changeFlag = true;
-					changeFlag = true;
-					continue;
-				}
-
-				/*it seems WiThrottle works with 126 speed steps natively*/
-				loc.speed = speedCode / 126.0;
-				/*deal with 128 step codes*/
-				if (loc.use128)
-				{
-					loc.speedStep = speedCode;
-					loc.speed = speedCode / 126.0;
-					loc.changeFlag = true;
-					changeFlag = true;
-					loc.history = ++age;
-					continue;
-				}
-
-				/*else calculate 28 step display code.
-				2020-05-27 correct and simplified. max speed is display code 28*/
-				loc.speedStep = 28 * loc.speed;
-				loc.changeFlag = true;
+				nsDCCbus::locoSpeed(throttle.locoSlot, speedCode, nsDCCbus::BUS_WITHROTTLE);
 				changeFlag = true;
-				loc.history = ++age;
 				continue;
-
-
 			}
 
 			//2021-01-29 handle <;>qR and <;>qV
-			if (p[3] == 'q' && (msg[3] == '*' || (strcmp(address, throttle.address) == 0))) {
+			if (p[3] == 'q' && (all || key == throttle.addrKey)) {
 				//cient asking for current direction R or velocity V.
 				//all we need do is set the changeFlag on the corresponding loco slots, the regular
-				//broadcastChanges will send out the message
+				//broadcastChanges will send out the message.  This is a read, so it does not go via the bus
 	
 				if ((p[4] == 'R')|| (p[4] == 'V') ){
 					//need to queue a response message M0AL341<;>V23 or M0AL341<;>R1 for example
-					for (auto t : throttles) {
-						if (t.toClient == toClient) {
-							//don't set directionFlag, this would cause a direction toggle (used in consists)
-							loco[t.locoSlot].changeFlag = true;
-							//send the function settings for good measure
-							loco[t.locoSlot].functionFlag = true;
-						}
+					for (int16_t j = cp->firstThrottle; j >= 0; j = throttles[j].nextOnClient) {
+						int8_t slot = throttles[j].locoSlot;
+						if (slot < 0 || slot >= MAX_LOCO) continue;
+						//don't set directionFlag, this would cause a direction toggle (used in consists)
+						loco[slot].changeFlag = true;
+						//send the full function settings for good measure
+						loco[slot].functionFlag = true;
+						throttles[j].fnValid = false;
 					}
 				}
 			}
@@ -733,57 +1080,39 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 			/*so the format is differen for solo throttles.  these are MTAS6<;>I as opposed to MOA*<;>I
 			but i suppose M0A*<;>I is also valid
 			p[3] will point at I  msg[3] will be S*/
-			if (p[3] == 'I' && (msg[3] == '*' || (strcmp(address, throttle.address) == 0))) {
+			if (p[3] == 'I' && (all || key == throttle.addrKey)) {
 
 				trace(Serial.printf("Idle command\r\n");)
-				loc.speed = 0;
-				loc.speedStep = 0;
-				loc.changeFlag = true;
-				loc.eStopTimer = LOCO_ESTOP_TIMEOUT;
+				nsDCCbus::locoEstop(throttle.locoSlot, nsDCCbus::BUS_WITHROTTLE);
 				changeFlag = true;
-				loc.history = ++age;
 				continue;	 			
 			}
 			
 			/*ESTOP emergency stop command X  element MTAS6<;>X*/
-			if (p[3] == 'X' && (msg[3] == '*' || (strcmp(address, throttle.address) == 0))) {
+			if (p[3] == 'X' && (all || key == throttle.addrKey)) {
 				trace(Serial.printf("ESTOP command\r\n");)
-				for (auto &L : loco) {
-					L.speed = 0;
-					L.speedStep = 0;
-					L.changeFlag = true;
-					changeFlag = true;
-					//2021-01-29 no need to display eStop on the local UI
-					//all speeds will go to zero and power is not shut off
-				}
-				continue;
+				//2021-01-29 no need to display eStop on the local UI
+				//all speeds will go to zero and power is not shut off.  Applies to all locos, so post once
+				nsDCCbus::stopAll(nsDCCbus::BUS_WITHROTTLE);
+				changeFlag = true;
+				break;
 			}
 
 
 			/*FUNCTION commands*/
 			if (p[3] == 'F') {
 				/*function command M0A*<;>F012 where first char after F 0|1 is state, of f12 in this example */
-				/*loco[].function is 16 bit mapped functions*/
 				uint8_t b = atoi(p + 5);
 
 				trace(Serial.printf("func cmd %d\r\n", b);)
 
-#ifdef NOT_USED				
-				/*this is immediate tracking of finger-on-button state*/
-				if (p[4] == '1') { loc.function |= (1 << b); }
-				else
-				{
-					loc.function &= ~(1 << b);
-				}
-#endif					
 				/*2020-04-25 revised.  if we see keydown, toggle state*/
 				/*we ignore keyup, however it would be possible to set a timer and if user holds down for >1sec
 				then we obey keyup rather than leaving state as set*/
-				if (p[4] == '1') { loc.function ^= (1 << b); }
-
-				loc.functionFlag = true;
-				loc.history = ++age;
-				changeFlag = true;
+				if (p[4] == '1') {
+					nsDCCbus::locoFunction(throttle.locoSlot, b, nsDCCbus::BUS_WITHROTTLE);
+					changeFlag = true;
+				}
 				continue;
 			}//function set
 
@@ -791,13 +1120,10 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 			actually throttle seems to send as one or more loco-address commands
 			M0AS5<;>R0  this is because locos in a consist may be facing in opposite directions*/
 			if (p[3] == 'R') {
-				if (msg[3] == '*' || (strcmp(address, throttle.address) == 0)) {
+				if (all || key == throttle.addrKey) {
 					/*R0 indicates reverse, R1 or anything else is forward*/
-					loc.forward = (p[4] == '0') ? false : true;
-					loc.changeFlag = true;
-					loc.directionFlag = true;
+					nsDCCbus::locoDirection(throttle.locoSlot, (p[4] == '0') ? 0 : 1, nsDCCbus::BUS_WITHROTTLE);
 					changeFlag = true;
-					loc.history = ++age;
 				}
 				continue;
 			}
@@ -807,72 +1133,75 @@ int8_t nsWiThrottle::doThrottleCommand(void *data, AsyncClient *toClient) {
 	}//loop for throttle
 
 
-	/*we have executed the command on one or more slots*/
+	/*we have posted the command for one or more slots*/
 	if (changeFlag) { return 99; }
 	return -1;
 	/*net outcome is all loco slots which were impacted by the command will have their changeFlag or functionFlag set
-	these all need to be broadcast and the local UI updated*/
+	once DCCcore applies them.  these all need to be broadcast and the local UI updated*/
 
 }
 
 
 /*return true if steal required and can also indicate that address is part of consist*/
 bool nsWiThrottle::checkDoSteal(char *address, bool checkOnly, bool &isConsist) {
-	int c = 0;
 	int c_max = 0;
 	/*for a given loco address, find which MT(s) it is on, and then for a given MT find how many other entries that MT has*/
 	/*if not checkOnly, we set the slot references to -1 to force that throttle to release its loco(s)*/
+	/*2026-10-19 the MT entries are found from the per-client list, rather than rescanning all throttles*/
+	uint16_t key = addrKey(address);
 
-	trace(Serial.printf("chkDS %d\r\n", throttles.size());)
-	for (auto throttle : throttles)
+	trace(Serial.printf("chkDS %d\r\n", m_throttleCount);)
+	for (auto &throttle : throttles)
 	{
-		c = 0;
 		/*outer loop, find all instances of that addr on a MT.  should only be one*/
-		if (strcmp(throttle.address, address) == 0) {
-			/*found a hit, now check whether this MT on this client has >1 slot*/
-
-			/*inner loop, for this particular throttle is it running a consist?*/
-			for (auto& th : throttles) {
-				/*confirm its our target throttle.  Note we will find-self as one of these*/
-				if ((th.toClient == throttle.toClient) && (th.MT == throttle.MT)) {
-					c++;
-					/*force throttle to release its loco(s)*/
-					if (!checkOnly) { th.MTaction = MT_RELEASE;
-					trace(Serial.println(F("##7 force release\r\n"));)
-					}
-				}
+		if (!throttle.inUse || throttle.addrKey != key) continue;
+		/*found a hit, now check whether this MT on this client has >1 slot*/
+		int c = 0;
+		if (throttle.clientIdx < 0) {
+			//orphan with no client, it is its own MT
+			c = 1;
+			if (!checkOnly) { throttle.MTaction = MT_RELEASE; }
+		}
+
+		/*inner loop, for this particular throttle is it running a consist?*/
+		for (int16_t i = (throttle.clientIdx < 0) ? -1 : clients[throttle.clientIdx].firstThrottle; i >= 0; i = throttles[i].nextOnClient) {
+			THROTTLE &th = throttles[i];
+			/*confirm its our target throttle.  Note we will find-self as one of these*/
+			if (th.MT != throttle.MT) continue;
+			c++;
+			/*force throttle to release its loco(s)*/
+			if (!checkOnly) {
+				th.MTaction = MT_RELEASE;
+				trace(Serial.println(F("##7 force release\r\n"));)
 			}
-			if (c > c_max) c_max = c;
 		}
+		if (c > c_max) c_max = c;
 	}
+	if (!checkOnly && c_max > 0) m_actionPending = true;
 
 	isConsist = (c_max > 1) ? true : false;
 	return (c_max == 0) ? false : true;
 }
 
 
-void nsWiThrottle::setPower(bool powerOn) {
-	if (powerOn) {
-		/*turn on track power*/
-		power.trackPower = true;
-		power.trip = false;
-		//2021-10-27 also zero all loco speeds in anticipation of power being restored
-		//broadcasting of this is dealt with elsewhere
-		for (auto &loc : loco) {
-			loc.speed = 0;
-			loc.speedStep = 0;
-			loc.changeFlag = true;
-		}
-	}
-	else {
-		/*turn off track power*/
-		power.trackPower = false;
-		power.trip = false;
-		
-	}
-	nsWiThrottle::broadcastPower();
+/*2026-10-19 steal check and forced release for other throttle modules, see JsonThrottle*/
+bool nsWiThrottle::isLocoHeld(const char *address) {
+	char a[10];
+	bool isConsist;
+	strncpy(a, address, sizeof(a));
+	a[sizeof(a) - 1] = '\0';
+	return checkDoSteal(a, true, isConsist);
+}
+
+void nsWiThrottle::releaseLoco(const char *address) {
+	char a[10];
+	bool isConsist;
+	strncpy(a, address, sizeof(a));
+	a[sizeof(a) - 1] = '\0';
+	checkDoSteal(a, false, isConsist);
 }
 
+
 void nsWiThrottle::broadcastPower(void) {
 	if (power.trackPower) {
 		queueMessage("PPA1\r\n", nullptr);
@@ -882,25 +1211,33 @@ void nsWiThrottle::broadcastPower(void) {
 	}
 }
 
-/*queue a message for a specific client, or all if client=nullptr*/
-void nsWiThrottle::queueMessage(std::string s, AsyncClient *client) {
-	CLIENTMESSAGE m;
-	m.toClient = client;
-	m.msg = s;
-	messages.push_back(m);
+/*queue a message for a specific client, or all if client=nullptr.  message must be whole lines
+it is sent on the next broadcastChanges*/
+void nsWiThrottle::queueMessage(const char *s, size_t len, AsyncClient *client) {
+	for (auto &c : clients) {
+		if ((client == nullptr) || (client == c.client)) {
+			txWrite(c, s, len);
+		}
+	}
+}
+
+void nsWiThrottle::queueMessage(const char *s, AsyncClient *client) {
+	queueMessage(s, strlen(s), client);
 }
 
 /*a consist ID is assigned to indicate a loco slot is tied to a WiThrottle.  It is also used to manage ad-hoc consists on a throttle*/
 void nsWiThrottle::setConsistID(THROTTLE *t) {
 	if (t == nullptr) return;
-	if (t->locoSlot<0 || t->locoSlot>MAX_LOCO) return;
+	if (t->locoSlot<0 || t->locoSlot>=MAX_LOCO) return;
 	trace(Serial.println("setCID");)
 
-	/*scan throttles, is this a consist and does it have an ID?*/
-	for (auto throttle : throttles) {
-		if (throttle.toClient != t->toClient) continue;
+	/*scan throttles on the same client, is this a consist and does it have an ID?*/
+	CLIENT_T *cp = findClient(t->toClient);
+	for (int16_t i = (cp == nullptr) ? -1 : cp->firstThrottle; i >= 0; i = throttles[i].nextOnClient) {
+		THROTTLE &throttle = throttles[i];
 		if (throttle.MT != t->MT) continue;
 		if (throttle.locoSlot == t->locoSlot) continue;  //ignore self
+		if (throttle.locoSlot < 0) continue;
 		/*found a loco in this throttle consist, pick up the consistID*/
 		if (loco[throttle.locoSlot].consistID != 0) {
 			/*this member is carrying the ID, apply it*/
@@ -911,7 +1248,7 @@ void nsWiThrottle::setConsistID(THROTTLE *t) {
 
 	//reach here if no consist exists, i.e. first member, so allocate a consistID
 	uint8_t high = 0;
-	for (auto loc : loco) {
+	for (auto &loc : loco) {
 		if (loc.consistID > high) { high = loc.consistID; }
 	}
 	loco[t->locoSlot].consistID = ++high;
@@ -921,117 +1258,126 @@ void nsWiThrottle::setConsistID(THROTTLE *t) {
 
 /*send out the current loco roster to all clients, also sends throttle-boot preamble and power status*/
 void nsWiThrottle::broadcastLocoRoster(AsyncClient *client) {
-	CLIENTMESSAGE m;
-	m.toClient = client;   //if nullptr will send to all clients
+	//if client is nullptr will send to all clients
 	
 	//JRMI Version 2.0, and set WITHROTTLE_TIMEOUT which is defined in the header file
 	//Note that *6 is from server to client. client needs to respond *+ or *- to activate/deactivate heartbeat monitoring
 	//2021-12-01 added PW80 to indicate webserver is on port 80
 	//2021-12-01 also added HTDCCESP as a server message to the client.  Steve Todd, the author of Engine Driver has
 	//kindly agreed to recognise this token in his app so that the Web menu item appears as DCC ESP
-	char buff[30];
-	snprintf(buff, 29, "VN2.0\r\nPW80\r\n*%d\r\nDCCESP\r\n", WITHROTTLE_TIMEOUT);
-	m.msg = buff;
-	
-	//example 2 entry roster list RL2]\[RGS 41}|{41}|{L]\[Test Loco}|{1234}|{L
-	
-	if (power.trackPower) {
-		m.msg.append("PPA1\r\nRL");
-	}
-	else
-	{
-		m.msg.append("PPA0\r\nRL");
-	}
+	char buff[40];
+	snprintf(buff, sizeof(buff), "VN2.0\r\nPW80\r\n*%d\r\nDCCESP\r\nPPA%d\r\n", WITHROTTLE_TIMEOUT, power.trackPower ? 1 : 0);
+	queueMessage(buff, client);
 
-	/*calculate roster count now, as its easier to append to string as we go*/
-	int8_t rosterCount = 0;
-	for (auto loc : loco) {
-		if (loc.address != 0) {
-			++rosterCount;
-		}
+	//2026-10-19 the RL line follows once the lines queued ahead of it have gone, see rosterPump
+	for (auto &c : clients) {
+		if (c.client == nullptr || (client != nullptr && client != c.client)) continue;
+		if (c.rosterNext >= 0) c.rosterAgain = true;
+		else c.rosterNext = WITHROTTLE_RL_START;
 	}
+}
 
-	char buffer[20];
-	itoa(rosterCount, buffer, 10);
-	m.msg.append(buffer);
-
-	//roster example, 2 entries  
-	// RL2
-	// ]\[state rl }|{8005 }|{L
-	// ]\[class 70 }|{7003 }|{L
-	
-	//send non-zero loco slots
-	for (auto loc : loco) {
-		if (loc.address != 0) {
-			itoa(loc.address, buffer, 10);
-			m.msg.append("]\\[");  //escape the backslash
+/*2026-10-19 stream the RL line from the flash roster straight to AsyncTCP, an entry at a time as the TCP
+window allows.  The roster can be far longer than the client ring, so it bypasses it.  Nothing from the ring is
+sent while a line is in progress.  returns true once the line is complete*/
+bool nsWiThrottle::rosterPump(CLIENT_T &c) {
+	char line[WITHROTTLE_RL_ENTRY];
+	while (c.rosterNext != WITHROTTLE_RL_IDLE) {
+		int n;
+		uint16_t count = nsLocoRoster::count();
+		//example 2 entry roster list RL2]\[RGS 41}|{41}|{L]\[Test Loco}|{1234}|{L
+		if (c.rosterNext == WITHROTTLE_RL_START) {
+			n = snprintf(line, sizeof(line), "RL%u", count);
+		}
+		else if (c.rosterNext >= count) {
+			n = snprintf(line, sizeof(line), "\r\n");
+		}
+		else {
+			nsLocoRoster::LOCOREC r;
+			nsLocoRoster::get(c.rosterNext, r);
 			//loco name comes first. If name is null, use address. There's a bug in EngineDriver which means
 			//locos with a null name sometimes do not display in the roster.
-			if (loc.name[0] == '\0') { 
-				m.msg.append(buffer); }
-			else {
-				m.msg.append(loc.name);
+			if (r.name[0] == '\0') {
+				n = snprintf(line, sizeof(line), "]\\[%u", r.address);
 			}
-			m.msg.append("}|{");
-			//loco address
-			m.msg.append(buffer);
-			m.msg.append("}|{");
-			if (loc.useLongAddress) {
-				m.msg.append("L");
+			else {
+				n = snprintf(line, sizeof(line), "]\\[%s", r.name);
 			}
-			else { m.msg.append("S"); }
+			n += snprintf(line + n, sizeof(line) - n, "}|{%u}|{%c", r.address, (r.flags & ROSTER_LONG) ? 'L' : 'S');
 		}
-	}
 
-	m.msg.append("\r\n");
-	messages.push_back(m);
+		//wait for the window to open, the entry is rebuilt next time
+		if (c.client->space() < (size_t)n) {
+			c.client->send();
+			return false;
+		}
+		c.client->add(line, n, ASYNC_WRITE_FLAG_COPY);
+
+		if (c.rosterNext == WITHROTTLE_RL_START) {
+			c.rosterNext = 0;
+		}
+		else if (c.rosterNext >= count) {
+			//the roster changed while this line was in progress
+			c.rosterNext = c.rosterAgain ? WITHROTTLE_RL_START : WITHROTTLE_RL_IDLE;
+			c.rosterAgain = false;
+		}
+		else {
+			++c.rosterNext;
+		}
+	}
+	c.client->send();
+	return true;
 }
 
 /*send current turnout roster to all clients*/
 void nsWiThrottle::broadcastTurnoutRoster(AsyncClient *client) {
-	CLIENTMESSAGE m;
-	m.toClient = client;  //if nullptr send to all clients
-	char buffer[8];
+	//if client is nullptr send to all clients
+	uint16_t len;
+	const char *m = turnoutRosterText(len);
+	queueMessage(m, len, client);
+}
+
+/*2026-10-19 the PTT and PTL roster lines, serialized once per roster generation.  The turnout states are
+part of PTL so a state change also bumps the generation*/
+const char *nsWiThrottle::turnoutRosterText(uint16_t &len) {
+	static char m[WITHROTTLE_PT_SIZE];
+	static uint16_t n = 0;
+	static uint16_t gen = 0;
+	len = n;
+	if (gen == turnoutRosterGen && n > 0) return m;
+	gen = turnoutRosterGen;
 
 	//first string defines the states and their numeric equivalents
 	//PTT]\[Turnouts}|{Turnout]\[Closed}|{2]\[Thrown}|{4
 	
-	m.msg.append("PTT]\\[Turnouts}|{Turnout]\\[Closed}|{2]\\[Thrown}|{4\r\n");
+	n = snprintf(m, sizeof(m), "PTT]\\[Turnouts}|{Turnout]\\[Closed}|{2]\\[Thrown}|{4\r\n");
 
 	//second string defines the turnouts themselves as an array. There's no count, whereas for locos there is.
 	//PTL]\[LT12}|{Rico Station N}|{1]\[LT324}|{Rico Station S}|{2
 	//PTL]\[512}|{512}|{4]\[513}|{513}|{2  should work.
 	//in this context we are sending absolute state of those turnouts either 2 or 4
 	
-	m.msg.append("PTL");
-	for (auto turn : turnout) {
+	n += snprintf(m + n, sizeof(m) - n, "PTL");
+	for (auto &turn : turnout) {
 		if (turn.address != 0) {
-			m.msg.append("]\\[");  //escape the backslash
-			itoa(turn.address, buffer, 10);
-			m.msg.append(buffer);
-			m.msg.append("}|{");
 			//2021-02-07 if name is null, it will fail to display in ED, use the address instead
-			if (turn.name[0] == '\0') {	m.msg.append(buffer);}
-			else 
-			{ m.msg.append(turn.name); }
-
-			if (turn.thrown) {
-				m.msg.append("}|{4");
+			if (turn.name[0] == '\0') {
+				n += snprintf(m + n, sizeof(m) - n, "]\\[%d}|{%d", turn.address, turn.address);
 			}
-			else
-			{
-				m.msg.append("}|{2");
+			else {
+				n += snprintf(m + n, sizeof(m) - n, "]\\[%d}|{%.*s", turn.address, (int)strnlen(turn.name, sizeof(turn.name)), turn.name);
 			}
+			n += snprintf(m + n, sizeof(m) - n, turn.thrown ? "}|{4" : "}|{2");
 		}
 	}
-	m.msg.append("\r\n");
-	messages.push_back(m);
-
+	n += snprintf(m + n, sizeof(m) - n, "\r\n");
+	if (n >= sizeof(m)) n = sizeof(m) - 1;
+	len = n;
+	return m;
 }
 
 /*sub-processing routine for broadcastWiChanges*/
 void queueTurnouts(bool clearFlags) {
-	std::string s;
 	char buf[20];
 	for (auto& turn : turnout) {
 		if (!turn.changeFlag) { continue; }
@@ -1044,18 +1390,65 @@ void queueTurnouts(bool clearFlags) {
 		else {
 			sprintf(buf, "PTA2%d\r\n", turn.address);
 		}
-		s.append(buf);
+		//send msg to ALL clients
+		queueMessage(buf, nullptr);
 		if (clearFlags) { turn.changeFlag = false; }
 	}//turnout loop
+}
 
-	 //send msg to ALL clients
-	queueMessage(s, nullptr);
+/*2026-10-19 queue function states for a throttle.  Only functions that differ from those last sent to this
+throttle are queued, unless full is set or the throttle has been marked for resync*/
+void nsWiThrottle::queueFunctions(CLIENT_T &c, THROTTLE &t, bool full) {
+	if (t.locoSlot < 0 || t.locoSlot >= MAX_LOCO) return;
+	uint32_t fn = loco[t.locoSlot].function;
+	uint32_t diff = (full || !t.fnValid) ? 0xFFFFFFFF : (fn ^ t.fnSent);
+	char buf[32];
+	char myT[2] = { t.MT, '\0' };
+
+	//for function, can shorten base to be MTA* instead of full loco address
+	/*2020-11-25 that may not work for single throttles.  may have to send the full loco addr. BUG*/
+	for (uint8_t f = 0; f < WITHROTTLE_FUNCTIONS; f++) {
+		if ((diff & (1UL << f)) == 0) continue;
+		sprintf(buf, "M%sA*<;>F%d%d\r\n", myT, (fn & (1UL << f)) == 0 ? 0 : 1, f);
+		txWrite(c, buf, strlen(buf));
+	}
+	t.fnSent = fn;
+	t.fnValid = true;
+}
+
+/*2026-10-19 function labels from the roster, MTLaddr<;>]\[Headlight]\[Bell.  Not sent if the roster has none*/
+void nsWiThrottle::queueLabels(CLIENT_T &c, THROTTLE &t) {
+	if (t.locoSlot < 0 || t.locoSlot >= MAX_LOCO) return;
+	char buf[16 + ROSTER_LABELS * (ROSTER_LABEL_LEN + 3)];
+	bool any = false;
+	int n = snprintf(buf, sizeof(buf), "M%cL%s<;>", t.MT, t.address);
+	for (uint8_t f = 0; f < ROSTER_LABELS; ++f) {
+		const char *l = nsLocoRoster::label(t.locoSlot, f);
+		if (l[0] != '\0') any = true;
+		n += snprintf(buf + n, sizeof(buf) - n, "]\\[%s", l);
+	}
+	if (!any) return;
+	n += snprintf(buf + n, sizeof(buf) - n, "\r\n");
+	txWrite(c, buf, n);
+}
+
+/*2026-10-19 queue speed and direction for a throttle and restart its echo interval*/
+void nsWiThrottle::queueSpeed(CLIENT_T &c, THROTTLE &t) {
+	t.echoAt = millis();
+	t.echoPending = false;
+	if (t.locoSlot < 0 || t.locoSlot >= MAX_LOCO) return;
+	char buf[32];
+	sprintf(buf, "M%cA%s<;>V%d\r\n", t.MT, t.address, uint8_t(126 * loco[t.locoSlot].speed));
+	txWrite(c, buf, strlen(buf));
+	sprintf(buf, "M%cA%s<;>R%d\r\n", t.MT, t.address, loco[t.locoSlot].forward ? 1 : 0);
+	txWrite(c, buf, strlen(buf));
 }
 
 /*builds a datagram per client from the loco and turnout changes and any queued messages. Call regularly from main loop.*/
 void nsWiThrottle::broadcastChanges(bool clearFlags) {
+	nsHeapStats::TAG tag(nsHeapStats::HEAP_WITHROTTLE);
 	//sending to a specific client is blocking if you attempt to send more data before the first transmission
-	//has completed.  for this reason we need to group all messages per client and send as a jumbo message
+	//has completed.  2026-10-19 messages are now accumulated per client in its tx ring and pumped out
 
 		//deal with turnout changes, put these in the message queue
 	queueTurnouts(clearFlags);
@@ -1071,156 +1464,139 @@ void nsWiThrottle::broadcastChanges(bool clearFlags) {
 		if (clearFlags) bootController.flagLocoRoster = false;
 	}
 
-	std::string m;
 	char buf[32];
 	char myT[4];  //target throttle 
+	memset(myT, '\0', sizeof(myT));
+
+	/*2026-10-19 loco changes.  Only the throttles holding a changed slot are visited, via the slot index.
+	consistency of the throttle with its slot is a numeric key compare*/
+	for (int8_t s = 0; s < MAX_LOCO; ++s) {
+		LOCO &loc = loco[s];
+		if (!loc.changeFlag && !loc.functionFlag) continue;
+
+		for (int16_t i = m_slotFirst[s]; i >= 0; i = throttles[i].nextOnSlot) {
+			THROTTLE &throttle = throttles[i];
+			//throttles with an action pending are dealt with below
+			if (throttle.MTaction != MT_NORMAL || throttle.locoSlot != s) continue;
+			if (throttle.clientIdx < 0) continue;
+			CLIENT_T &c = clients[throttle.clientIdx];
+
+			//does loco[].address no longer	match throttle.address?  In which case, issue a release command to the MT
+			if (locoKey(s) != throttle.addrKey) {
+				throttle.MTaction = MT_RELEASE;
+				m_actionPending = true;
+				continue;
+			}
 
-	//loop for client; we build messages on a per-client basis
-	for (auto c : clients) {
-		//clear msg
-		m.clear();
-
-		//loop through all throttles per specific client, then for each loco found thereunder, add it to
-		//the block message
-		for (auto& throttle : throttles) {
-			//2020-11-25 special case for solo throttles, these are stored as 36d but need to be emitted as T
-			memset(myT, '\0', sizeof(myT));
-			
-		
 			//2021-02-01 .MT is a single char, can be alpha numeric, was captured as an ascii code originally
 			myT[0] = throttle.MT;
 
-			if (c.client == throttle.toClient) {
-				//client matches.  we need to transmit all MTs on this client if they have changes
-				bool isConsistent = false;
-
-				//does loco[].address no longer	match throttle.address?  In which case, issue a release command to the MT
-
-				if (throttle.locoSlot < 0 || throttle.locoSlot >= MAX_LOCO) {
-					//loco slot not valid, isConsistent=false
-					isConsistent = false;
+			if (loc.changeFlag) {
+				//Normal operation is send speed and direction. 2026-10-19 speed echoes are rate limited
+				//per throttle, a direction change goes immediately
+				if (loc.directionFlag || (millis() - throttle.echoAt) >= WITHROTTLE_ECHO_MS) {
+					queueSpeed(c, throttle);
 				}
 				else {
-					sprintf(buf, "S%d", loco[throttle.locoSlot].address);
-					if (loco[throttle.locoSlot].useLongAddress) {
-						buf[0] = 'L';
-					}
-					isConsistent = (strcmp(buf, throttle.address) == 0) ? true : false;
+					throttle.echoPending = true;
+					m_echoPending = true;
 				}
-
-				//process the required action on the throttle
-				switch (throttle.MTaction) {
-				case MT_NORMAL:
-					if (loco[throttle.locoSlot].changeFlag == false) { break; }
-					if (!isConsistent) {
-						//flag inconsistent data throttles for release
-						throttle.MTaction = MT_RELEASE;
-						break;
-					}
-					//Normal operation is send speed and direction
-					sprintf(buf, "M%sA%s<;>V%d\r\n", myT, throttle.address, uint8_t(126 * loco[throttle.locoSlot].speed));
-					//test for estop - yet to implement
-					m.append(buf);
-
-					if (loco[throttle.locoSlot].forward) {
-						sprintf(buf, "M%sA%s<;>R1\r\n", myT, throttle.address);
-					}
-					else {
-						sprintf(buf, "M%sA%s<;>R0\r\n", myT, throttle.address);
-					}
-					m.append(buf);
-					break;
-
-				case MT_NEWADD:
-					// MT+addr<;>addr
-					if (!isConsistent) {
-						//flag for release
-						throttle.MTaction = MT_RELEASE;
-						break;
-					}
-					//send add instruction MT+addr<;>addr, this works whether adding from the roster or adding a DCC address direct
-					sprintf(buf, "M%s+%s<;>%s\r\n", myT, throttle.address, throttle.address);
-					m.append(buf);
-					//now send speed and dir
-					sprintf(buf, "M%sA%s<;>V%d\r\n", myT, throttle.address, uint8_t(126 * loco[throttle.locoSlot].speed));
-					//test for estop - yet to implement
-					m.append(buf);
-
-					if (loco[throttle.locoSlot].forward) {
-						sprintf(buf, "M%sA%s<;>R1\r\n", myT, throttle.address);
-					}
-					else {
-						sprintf(buf, "M%sA%s<;>R0\r\n", myT, throttle.address);
-					}
-					m.append(buf);
-
-					throttle.MTaction = MT_NORMAL;
-					break;
-
-				case MT_STEAL:
-					//steal message is not based on the slot addr, rather the throttle addr MTSaddr<;>addr
-					sprintf(buf, "M%sS%s<;>%s\r\n", myT, throttle.address, throttle.address);
-					m.append(buf);
-					//steal throttle placeholder has served its purpose, delete it 
-					throttle.locoSlot = -1;
-					throttle.MTaction = MT_GARBAGE;
-					break;
-
-				case MT_RELEASE:
-					//MT-addr<;>addr
-					sprintf(buf, "M%s-%s<;>%s\r\n", myT, throttle.address, throttle.address);
-					m.append(buf);
-					//tag the slot for garbage collection
-					throttle.locoSlot = -1;
-					throttle.MTaction = MT_GARBAGE;
-					break;
-
-				case MT_GARBAGE:
-					//do nothing, garbage collector is at end of routine
-					break;
-				}//switch for loco changes
-
-
-				//process any function changes on this throttle
-				if (isConsistent && loco[throttle.locoSlot].functionFlag) {
-					//for function, can shorten base to be MTA* instead of full loco address
-
-					/*2020-11-25 that may not work for single throttles.  may have to send the full loco addr. BUG*/
-					int8_t fState = 0;
-					for (int f = 0;f < 17;f++) {
-						//APPEND to msg
-						fState = ((loco[throttle.locoSlot].function & (1 << f)) == 0) ? 0 : 1;
-						sprintf(buf, "M%sA*<;>F%d%d\r\n", myT, fState, f);
-						m.append(buf);
-					}
-				}//function
-			}//ip client match
-		}//loop for throttle
-
-		//2020-11-27 append any client specific message
-		for (auto g : messages) {
-			if ((g.toClient == nullptr) || (g.toClient == c.client)) {
-				m.append(g.msg);
 			}
-		}
-		
-		//have built a jumbo message on a per client basis, send this
 
-trace(
-		if (m.length() > 0) {
-			Serial.println(F("\nWIT BCAST"));
-			Serial.printf("%s\n", m.c_str());
-			Serial.println(F("WIT BCAST END"));
+			//process any function changes on this throttle
+			if (loc.functionFlag) {
+				queueFunctions(c, throttle, false);
+			}
+		}//loop for throttles on slot
+	}//loop for slots
+
+	/*speed echoes held back by the rate limit.  The slot flags are cleared by then, so the latest value is
+	read from loco[] when the interval has expired*/
+	if (m_echoPending) {
+		m_echoPending = false;
+		uint32_t now = millis();
+		for (auto &throttle : throttles) {
+			if (!throttle.inUse || !throttle.echoPending) continue;
+			if (throttle.MTaction != MT_NORMAL || throttle.clientIdx < 0) {
+				throttle.echoPending = false;
+				continue;
+			}
+			if ((now - throttle.echoAt) < WITHROTTLE_ECHO_MS) {
+				m_echoPending = true;
+				continue;
+			}
+			queueSpeed(clients[throttle.clientIdx], throttle);
 		}
-)
-		sendToClient(m, c.client);
+	}
 
-	}//client loop
+	/*add, steal and release actions.  these are infrequent so a scan of throttles is acceptable*/
+	bool garbage = false;
+	if (m_actionPending) {
+		m_actionPending = false;
+		for (auto &throttle : throttles) {
+			if (!throttle.inUse || throttle.MTaction == MT_NORMAL) continue;
+			if (throttle.MTaction == MT_GARBAGE) { garbage = true; continue; }
+			//orphaned throttles, whose client has quit, have no one to tell
+			if (throttle.clientIdx < 0) {
+				throttle.locoSlot = -1;
+				throttle.MTaction = MT_GARBAGE;
+				garbage = true;
+				continue;
+			}
+			CLIENT_T &c = clients[throttle.clientIdx];
+			myT[0] = throttle.MT;
+			bool isConsistent = (throttle.locoSlot >= 0) && (throttle.locoSlot < MAX_LOCO) && (locoKey(throttle.locoSlot) == throttle.addrKey);
+
+			//process the required action on the throttle
+			switch (throttle.MTaction) {
+			case MT_NEWADD:
+				// MT+addr<;>addr
+				if (!isConsistent) {
+					//flag for release, next pass
+					throttle.MTaction = MT_RELEASE;
+					m_actionPending = true;
+					break;
+				}
+				//send add instruction MT+addr<;>addr, this works whether adding from the roster or adding a DCC address direct
+				sprintf(buf, "M%s+%s<;>%s\r\n", myT, throttle.address, throttle.address);
+				txWrite(c, buf, strlen(buf));
+				//now send speed and dir
+				queueSpeed(c, throttle);
+				//a new throttle needs the full function state
+				queueFunctions(c, throttle, true);
+				queueLabels(c, throttle);
+				throttle.MTaction = MT_NORMAL;
+				break;
+
+			case MT_STEAL:
+				//steal message is not based on the slot addr, rather the throttle addr MTSaddr<;>addr
+				sprintf(buf, "M%sS%s<;>%s\r\n", myT, throttle.address, throttle.address);
+				txWrite(c, buf, strlen(buf));
+				//steal throttle placeholder has served its purpose, delete it 
+				throttle.locoSlot = -1;
+				throttle.MTaction = MT_GARBAGE;
+				garbage = true;
+				break;
+
+			case MT_RELEASE:
+				//MT-addr<;>addr
+				sprintf(buf, "M%s-%s<;>%s\r\n", myT, throttle.address, throttle.address);
+				txWrite(c, buf, strlen(buf));
+				//tag the slot for garbage collection
+				throttle.locoSlot = -1;
+				throttle.MTaction = MT_GARBAGE;
+				garbage = true;
+				break;
+			}
+		}//loop for throttle
+	}
 
+	//lines were written straight to the client rings, along with any queued messages.
+	//send what the TCP window allows, onAck will continue
+	for (auto &c : clients) {
+		if (c.client != nullptr && (c.tx.count > 0 || c.rosterNext != WITHROTTLE_RL_IDLE)) txPump(c);
+	}
 
-	//done with all message processing
-	messages.clear();
-	
 	//done with all processing on all throttles and all clients.  Only now can we clear flags at loco-slot level
 	if (clearFlags) {
 		for (auto& loc : loco) {
@@ -1231,46 +1607,88 @@ trace(
 
 	
 	//lowest priority is garbage collection.  Delete any throttles tagged as garbage
-	for (auto it = throttles.begin(); it != throttles.end();) {
-		if (it->MTaction == MT_GARBAGE) {
-			it = throttles.erase(it);
+	if (garbage) {
+		for (int16_t i = 0; i < WITHROTTLE_MAX_THROTTLES; ++i) {
+			THROTTLE &t = throttles[i];
+			if (!t.inUse || t.MTaction != MT_GARBAGE) continue;
+			t.inUse = false;
+			t.nextFree = m_throttleFree;
+			m_throttleFree = i;
+			--m_throttleCount;
 			trace(Serial.println(F("garbage"));)
 		}
-		else
-		{
-			++it;
-		}
+		indexThrottles();
 	}
 }
 
-/*call every second from main loop, will send estop to locos who's throttles have timed out*/
-void nsWiThrottle::processTimeout() {
-	//2021-1-29 client based.  Only process the timeout event once as we hit zero
+/*2026-10-19 throttles for the RTC snapshot.  Only those whose client has sent HU can be matched on reconnect*/
+uint8_t nsWiThrottle::snapshot(nsRtcSnapshot::RTCTHROTTLE *out, uint8_t max) {
+	uint8_t n = 0;
+	for (auto &t : throttles) {
+		if (n >= max) break;
+		if (!t.inUse || t.locoSlot < 0 || t.locoSlot >= MAX_LOCO) continue;
+		if (t.MTaction == MT_RELEASE || t.MTaction == MT_GARBAGE || t.MTaction == MT_STEAL) continue;
+		uint32_t hu = t.resumeHU;
+		if (hu == 0 && t.clientIdx >= 0) hu = clients[t.clientIdx].huHash;
+		if (hu == 0) continue;
+		nsRtcSnapshot::RTCTHROTTLE &r = out[n++];
+		r.hu = hu;
+		r.slot = t.locoSlot;
+		r.MT = t.MT;
+		r.orientation = t.orientation ? 1 : 0;
+		r.spare = 0;
+	}
+	return n;
+}
 
-	for (auto &c : clients) {
-		//loop per client
-		if (c.timeout == 0) continue;
-		c.timeout -= c.timeout > 0 ? 1 : 0;
-		if (c.timeout == 0) {
-			//have timed out. stop all throttles under this client.
-			//the throttles are not deleted and remain associated with the HU identifier of the client
-			//if the client reconnects, we then use the HU to re-associate with the throttles.
-
-			for (auto &t : throttles) {
-				if (t.toClient == c.client) {
-					loco[t.locoSlot].speed = 0;
-					loco[t.locoSlot].speedStep = 0;
-					loco[t.locoSlot].changeFlag = true;
-					//do not flag for garbage collection
-					//t.MTaction = MT_GARBAGE;
-					trace(Serial.printf("clnt timeout %d\r\n", loco[t.locoSlot].address);)
-				}
-				
-			}
+/*2026-10-19 put a throttle held before a warm reset back in the pool, unclaimed until its client sends HU*/
+void nsWiThrottle::resumeThrottle(const nsRtcSnapshot::RTCTHROTTLE &r, uint8_t consistID) {
+	if (r.slot < 0 || r.slot >= MAX_LOCO || loco[r.slot].address == 0) return;
+	THROTTLE t;
+	t.toClient = nullptr;
+	t.MT = r.MT;
+	sprintf(t.address, "%c%d", loco[r.slot].useLongAddress ? 'L' : 'S', loco[r.slot].address);
+	t.addrKey = addrKey(t.address);
+	t.locoSlot = r.slot;
+	t.MTaction = MT_NORMAL;
+	t.orientation = r.orientation != 0;
+	t.fnValid = false;
+	t.echoAt = 0;
+	t.echoPending = false;
+	t.resumeHU = r.hu;
+	if (!addThrottle(t)) return;
+	//the consist the slot belonged to, or a new one
+	if (consistID != 0) loco[r.slot].consistID = consistID;
+	else setConsistID(&t);
+	indexThrottles();
+	nsTimerWheel::start(m_resumeTimer, 2 * 1000UL * WITHROTTLE_TIMEOUT, &resumeTimeout, nullptr);
+}
 
+/*2026-10-19 restored throttles whose client has not reconnected within the heartbeat timeout.  Their locos are
+stopped as clientTimeout would, the throttles stay for the client to claim*/
+void nsWiThrottle::resumeTimeout(void *arg) {
+	for (auto &t : throttles) {
+		if (!t.inUse || t.resumeHU == 0 || t.locoSlot < 0) continue;
+		nsDCCbus::locoSpeed(t.locoSlot, 0, nsDCCbus::BUS_WITHROTTLE);
+		trace(Serial.printf("resume timeout %d\r\n", loco[t.locoSlot].address);)
+	}
+}
 
-		}
-		
+/*2026-10-19 heartbeat expiry from the timer wheel, will stop locos whose throttles have timed out.
+Previously processTimeout walked every client on the 250mS tick*/
+void nsWiThrottle::clientTimeout(void *arg) {
+	CLIENT_T *cp = (CLIENT_T*)arg;
+	if (cp == nullptr || cp->client == nullptr) return;
+	//have timed out. stop all throttles under this client.
+	//the throttles are not deleted and remain associated with the HU identifier of the client
+	//if the client reconnects, we then use the HU to re-associate with the throttles.
+
+	for (int16_t i = cp->firstThrottle; i >= 0; i = throttles[i].nextOnClient) {
+		THROTTLE &t = throttles[i];
+		if (t.locoSlot < 0) continue;
+		//do not flag for garbage collection
+		nsDCCbus::locoSpeed(t.locoSlot, 0, nsDCCbus::BUS_WITHROTTLE);
+		trace(Serial.printf("clnt timeout %d\r\n", loco[t.locoSlot].address);)
 	}
 }
 
@@ -12,16 +12,62 @@
 #endif
 
 #include <ESPAsyncTCP.h>  //Github me-no-dev/ESPAsyncTCP
-#include <string>   //required if you wish to compile in arduino IDE, this is the std::string library
+#include "TimerWheel.h"
+#include "RtcSnapshot.h"
 
 namespace nsWiThrottle {
 
 #define WITHROTTLE_TIMEOUT	3  //3 sec timeout
+#define WITHROTTLE_RX_SIZE	128  //longest inbound line. longer lines are discarded
+#define WITHROTTLE_TX_SIZE	1024 //outbound ring per client
+#define WITHROTTLE_FUNCTIONS	29  //F0-F28
+#define WITHROTTLE_ECHO_MS	100  //min interval between speed echoes to a throttle
+#ifndef WITHROTTLE_MAX_CLIENTS
+#define WITHROTTLE_MAX_CLIENTS	6  //ip clients, including those awaiting reconnect after a wifi dropout
+#endif
+#ifndef WITHROTTLE_MAX_THROTTLES
+#define WITHROTTLE_MAX_THROTTLES	(WITHROTTLE_MAX_CLIENTS * 4)  //throttle records, one per loco on each MT
+#endif
+#define WITHROTTLE_HU_SIZE	40   //HU identifier, longer ones are truncated
+#define WITHROTTLE_RL_ENTRY	40   //one RL roster entry
+#define WITHROTTLE_RL_IDLE	-1   //CLIENT_T.rosterNext, no RL line to send
+#define WITHROTTLE_RL_START	-2   //RL line wanted, not yet started
+#define WITHROTTLE_PT_SIZE	(64 + MAX_TURNOUT * 24)  //PTT and PTL roster lines
+
+	/*per client inbound line assembler*/
+	struct RXLINE {
+		char buf[WITHROTTLE_RX_SIZE];
+		uint16_t len = 0;		//chars held for the line being assembled
+		uint16_t lineLen = 0;	//length of the last complete line
+		bool overflow = false;	//line exceeded buffer, discard until terminator
+		uint32_t lines = 0;
+		uint32_t dropped = 0;
+	};
+
+	/*per client outbound ring, holds whole lines not yet handed to AsyncTCP*/
+	struct TXRING {
+		char buf[WITHROTTLE_TX_SIZE];
+		uint16_t head = 0;
+		uint16_t tail = 0;
+		uint16_t count = 0;
+		uint16_t highWater = 0;
+		bool midLine = false;	//the line at tail has been partially sent
+		uint32_t sent = 0;
+		uint32_t evicted = 0;	//old lines discarded to make room
+		uint32_t dropped = 0;	//new messages that could not be queued
+	};
 
 	struct CLIENT_T {
-		AsyncClient *client;
-		std::string HU;  //HU identifier from client
-		uint8_t timeout;
+		AsyncClient *client = nullptr;  //nullptr if this table entry is free
+		char HU[WITHROTTLE_HU_SIZE];  //HU identifier from client, empty if not yet sent
+		uint32_t huHash = 0;	//of HU, see nsRtcSnapshot::huHash
+		nsTimerWheel::TIMER heartbeat;  //restarted on every inbound message, see clientTimeout
+		bool connected = false;
+		int16_t firstThrottle = -1;  //index into throttles, chained through THROTTLE.nextOnClient
+		RXLINE rx;
+		TXRING tx;
+		int16_t rosterNext = WITHROTTLE_RL_IDLE;  //next roster entry of the RL line, see rosterPump
+		bool rosterAgain = false;	//roster changed while the RL line was in progress
 	};
 
 
@@ -31,18 +77,26 @@ namespace nsWiThrottle {
 		//int8_t MT;			//multi throttle designator on the client 0-9. -1 signifies ALL
 		char MT;		//typically identifiers are M0 through M9 or MT for solo throttles
 		char address[8];  //L10293 is the longest poss addr
+		uint16_t addrKey;	//numeric form of address, see addrKey()
 		int8_t locoSlot;
 		uint8_t	MTaction;
 		bool orientation;
+		uint32_t fnSent;	//function states last sent to this throttle
+		bool fnValid;		//false forces a full function resync
+		uint32_t echoAt;	//millis() of the last speed echo
+		bool echoPending;	//an echo was held back by WITHROTTLE_ECHO_MS
 	//	uint8_t timeout;   //now done at client level
+		/*index links, maintained by indexThrottles*/
+		int8_t clientIdx;
+		int16_t nextOnClient;
+		int16_t nextOnSlot;
+		/*2026-10-19 pool record, see addThrottle*/
+		bool inUse;
+		int16_t nextFree;
+		/*2026-10-19 HU hash of the client that held this throttle before a warm reset, 0 once claimed*/
+		uint32_t resumeHU = 0;
 		};
 
-	struct CLIENTMESSAGE
-	{
-		std::string msg;   //safer inside a vector, will avoid memory leaks
-		AsyncClient* toClient;  //pointer to specific client, nullptr=all clients
-	};
-
 		
 	
 	/*function prototypes*/
@@ -54,22 +108,48 @@ namespace nsWiThrottle {
 	void broadcastLocoRoster(AsyncClient *client);
 	void broadcastTurnoutRoster(AsyncClient *client);
 	void sendWiMinimal(AsyncClient* client);  //do i need this?
-	void processTimeout();
 	uint8_t clientCount(void);
+	uint32_t txDropped(void);
+	/*2026-10-19 manual on-device aids, built only with WITHROTTLE_TEST defined.  Nothing calls them, call one from
+	setup() in a bench build and read the result on Serial*/
+#ifdef WITHROTTLE_TEST
+	void testParser(uint32_t iterations);
+	void benchThrottles(uint8_t benchClients, uint8_t mtPerClient);
+#endif
+	bool isLocoHeld(const char *address);
+	void releaseLoco(const char *address);
+	uint8_t snapshot(nsRtcSnapshot::RTCTHROTTLE *out, uint8_t max);
+	void resumeThrottle(const nsRtcSnapshot::RTCTHROTTLE &r, uint8_t consistID);
 
 
 
 
 	/*local scope, hence declared static*/
-	static int8_t doThrottleCommand(void *data, AsyncClient *client);
-	static void sendToClient(char *data, AsyncClient *client);
-	static void sendToClient(std::string s, AsyncClient *client);
-	static void	queueMessage(std::string s, AsyncClient *client);
-	static void setPower(bool powerOn);
+	static int8_t doThrottleCommand(char *msg, size_t len, AsyncClient *client);
+	static bool rxFeed(RXLINE &rx, char ch);
+	static void dispatchLine(char *msg, size_t len, AsyncClient *client);
+	static char *findSeparator(char *msg, size_t len);
+	static bool txWrite(CLIENT_T &c, const char *data, size_t len);
+	static void txPump(CLIENT_T &c);
+	static void	queueMessage(const char *s, size_t len, AsyncClient *client);
+	static void	queueMessage(const char *s, AsyncClient *client);
 	static int8_t addReleaseThrottle(AsyncClient *client, char MT, char *address, bool doAdd);
 	static bool checkDoSteal(char *address, bool checkOnly, bool &isConsist);
 	static void setConsistID(THROTTLE *t);
 	static void checkClientID(AsyncClient *client);
+	static void releaseClient(CLIENT_T *cp);
+	static void clientTimeout(void *arg);
+	static void resumeTimeout(void *arg);
+	static void indexThrottles(void);
+	static bool addThrottle(const THROTTLE &t);
+	static void clearThrottles(void);
+	static uint16_t addrKey(const char *address);
+	static uint16_t locoKey(int8_t slot);
+	static void queueFunctions(CLIENT_T &c, THROTTLE &t, bool full);
+	static void queueSpeed(CLIENT_T &c, THROTTLE &t);
+	static bool rosterPump(CLIENT_T &c);
+	static void queueLabels(CLIENT_T &c, THROTTLE &t);
+	static const char *turnoutRosterText(uint16_t &len);
 	
 	
 
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# embed_assets.py
+# 2026-10-19 minify, gzip and embed the web pages in data/ as WebAssets.h
+#
+# run from the repository root after editing any page in data/, and commit the regenerated header
+#   python3 tools/embed_assets.py
+#
+# The pages are still uploaded to LittleFS as before.  Embedded copies are served first, gzipped with a strong
+# ETag, unless HTTP_FS_OVERRIDE is defined in HttpServer.h in which case a LittleFS copy takes priority.
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DATA = os.path.join(ROOT, "data")
+OUT = os.path.join(ROOT, "WebAssets.h")
+
+TYPES = {
+    ".htm": "text/html",
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".ico": "image/x-icon",
+}
+
+
+def minify(text):
+    """conservative, safe for the inline script in the pages.  drops html comments, indentation,
+    whole-line // comments and blank lines.  code within a line is left alone"""
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    assets = []
+    for name in sorted(os.listdir(DATA)):
+        ext = os.path.splitext(name)[1].lower()
+        if ext not in TYPES:
+            continue
+        raw = open(os.path.join(DATA, name), "rb").read()
+        if ext in (".htm", ".html", ".css", ".js"):
+            raw = minify(raw.decode("utf-8-sig")).encode("utf-8")
+        # mtime=0 so the output, and the ETag, only change when the page does
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        etag = '"' + hashlib.sha1(gz).hexdigest()[:16] + '"'
+        ident = "asset_" + re.sub(r"[^0-9A-Za-z]", "_", name)
+        assets.append((name, TYPES[ext], etag, ident, gz, len(raw)))
+
+    with open(OUT, "w", newline="\r\n") as f:
+        f.write("// WebAssets.h\n")
+        f.write("//GENERATED by tools/embed_assets.py from data/, do not edit\n\n")
+        f.write("#ifndef _WEBASSETS_h\n#define _WEBASSETS_h\n\n")
+        f.write("#if defined(ARDUINO) && ARDUINO >= 100\n\t#include \"Arduino.h\"\n#else\n\t#include \"WProgram.h\"\n#endif\n\n")
+        f.write("namespace nsWebAssets {\n\n")
+        f.write("\tstruct ASSET {\n")
+        f.write("\t\tconst char *path;\n\t\tconst char *contentType;\n\t\tconst char *etag;\n")
+        f.write("\t\tconst uint8_t *data;\t//gzip, in flash\n\t\tuint32_t length;\n\t};\n\n")
+        for name, ctype, etag, ident, gz, rawlen in assets:
+            f.write("\t//%s %d bytes, minified %d, gzip %d\n" % (name, os.path.getsize(os.path.join(DATA, name)), rawlen, len(gz)))
+            f.write("\tstatic const uint8_t %s[] PROGMEM = {\n" % ident)
+            for i in range(0, len(gz), 20):
+                f.write("\t\t" + ",".join("0x%02x" % b for b in gz[i:i + 20]) + ",\n")
+            f.write("\t};\n\n")
+        f.write("\tstatic constexpr ASSET assets[] = {\n")
+        for name, ctype, etag, ident, gz, rawlen in assets:
+            f.write("\t\t{ \"/%s\", \"%s\", \"%s\", %s, %d },\n" % (name, ctype, etag.replace('"', '\\"'), ident, len(gz)))
+        f.write("\t};\n\n")
+        f.write("\tstatic constexpr uint8_t assetCount = sizeof(assets) / sizeof(assets[0]);\n\n")
+        f.write("}\n#endif\n")
+
+    total = sum(len(a[4]) for a in assets)
+    print("%d assets, %d bytes gzip, written to %s" % (len(assets), total, os.path.relpath(OUT, ROOT)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())